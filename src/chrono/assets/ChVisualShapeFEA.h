@@ -156,6 +156,9 @@ class ChApi ChVisualShapeFEA {
     /// Update the triangle visualization mesh so that it matches with the FEM mesh.
     void Update(ChPhysicsItem* updater, const ChFrame<>& frame);
 
+    /// Get the triangle mesh shape used to visualize the FEM mesh.
+    std::shared_ptr<ChTriangleMeshShape> GetTriangleMeshShape() const { return m_trimesh_shape; }
+
   private:
     double ComputeScalarOutput(std::shared_ptr<fea::ChNodeFEAxyz> mnode,
                                int nodeID,
@@ -0,0 +1,162 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2022 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Radu Serban
+// =============================================================================
+
+#include "chrono/assets/ChVisualSnapshot.h"
+#include "chrono/assets/ChVisualShapeFEA.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+ChVisualSnapshot::ChVisualSnapshot() : m_time(0) {}
+
+void ChVisualSnapshot::Capture(const ChSystem& sys) {
+    m_time = sys.GetChTime();
+
+    // Body frames (the body lookup table is rebuilt only if the list of bodies changed)
+    const auto& bodies = sys.Get_bodylist();
+    bool changed = bodies.size() != m_bodies.size();
+    m_bodies.resize(bodies.size());
+    m_body_frames.resize(bodies.size());
+    m_body_cog_frames.resize(bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        if (m_bodies[i] != bodies[i].get()) {
+            m_bodies[i] = bodies[i].get();
+            changed = true;
+        }
+        m_body_frames[i] = bodies[i]->GetVisualModelFrame();
+        m_body_cog_frames[i] = bodies[i]->GetFrame_COG_to_abs();
+    }
+    if (changed) {
+        m_body_map.clear();
+        for (size_t i = 0; i < m_bodies.size(); i++)
+            m_body_map[m_bodies[i]] = i;
+    }
+
+    size_t num_clouds = 0;
+    size_t num_meshes = 0;
+
+    for (const auto& item : sys.Get_otherphysicslist()) {
+        // Particle positions and colors
+        if (auto pcloud = dynamic_cast<ChParticleCloud*>(item.get())) {
+            if (num_clouds == m_clouds.size())
+                m_clouds.emplace_back();
+            auto& data = m_clouds[num_clouds++];
+            data.cloud = pcloud;
+            auto num_particles = (unsigned int)pcloud->GetNparticles();
+            data.positions.resize(num_particles);
+            for (unsigned int k = 0; k < num_particles; k++)
+                data.positions[k] = pcloud->GetParticle(k).GetPos();
+            if (pcloud->UseDynamicColors()) {
+                data.colors.resize(num_particles);
+                for (unsigned int k = 0; k < num_particles; k++)
+                    data.colors[k] = pcloud->GetVisualColor(k);
+            } else {
+                data.colors.clear();
+            }
+        }
+
+        // Deformable triangle meshes (e.g., SCM terrain)
+        if (auto model = item->GetVisualModel()) {
+            for (const auto& shape_instance : model->GetShapes()) {
+                auto trimesh = dynamic_cast<ChTriangleMeshShape*>(shape_instance.first.get());
+                if (trimesh && trimesh->IsMutable())
+                    CaptureMesh(trimesh, num_meshes);
+            }
+        }
+    }
+
+    // FEA mesh visualization
+    for (const auto& mesh : sys.Get_meshlist()) {
+        if (auto model = mesh->GetVisualModel()) {
+            for (const auto& shapeFEA : model->GetShapesFEA()) {
+                if (auto trimesh = shapeFEA->GetTriangleMeshShape())
+                    CaptureMesh(trimesh.get(), num_meshes);
+            }
+        }
+    }
+
+    m_clouds.resize(num_clouds);
+    m_meshes.resize(num_meshes);
+}
+
+void ChVisualSnapshot::CaptureMesh(ChTriangleMeshShape* shape, size_t& num_meshes) {
+    if (num_meshes == m_meshes.size())
+        m_meshes.emplace_back();
+    auto& data = m_meshes[num_meshes++];
+    auto mesh = shape->GetMesh();
+    data.shape = shape;
+    data.vertices = mesh->getCoordsVertices();
+    data.normals = mesh->getCoordsNormals();
+    data.colors = mesh->getCoordsColors();
+}
+
+const ChFrame<>* ChVisualSnapshot::GetBodyFrame(const ChBody* body) const {
+    auto it = m_body_map.find(body);
+    if (it == m_body_map.end())
+        return nullptr;
+    return &m_body_frames[it->second];
+}
+
+const ChFrame<>* ChVisualSnapshot::GetBodyCOGFrame(const ChBody* body) const {
+    auto it = m_body_map.find(body);
+    if (it == m_body_map.end())
+        return nullptr;
+    return &m_body_cog_frames[it->second];
+}
+
+const ChVisualSnapshot::ParticleCloud* ChVisualSnapshot::GetParticleCloud(const ChParticleCloud* cloud) const {
+    for (const auto& data : m_clouds) {
+        if (data.cloud == cloud)
+            return &data;
+    }
+    return nullptr;
+}
+
+const ChVisualSnapshot::TriangleMesh* ChVisualSnapshot::GetTriangleMesh(const ChTriangleMeshShape* shape) const {
+    for (const auto& data : m_meshes) {
+        if (data.shape == shape)
+            return &data;
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+// Initially, the producer owns slot 0, the consumer owns slot 2, and slot 1 is published (but not fresh).
+ChVisualSnapshotRing::ChVisualSnapshotRing()
+    : m_ready(1), m_write(0), m_read(2), m_has_data(false), m_num_published(0), m_num_dropped(0) {}
+
+// Swap the producer slot with the published one. If the previously published snapshot was never acquired, it is
+// dropped (its slot will be overwritten by the producer).
+void ChVisualSnapshotRing::Publish() {
+    unsigned int prev = m_ready.exchange(m_write | FRESH, std::memory_order_acq_rel);
+    if (prev & FRESH)
+        m_num_dropped++;
+    m_write = prev & ~FRESH;
+    m_num_published++;
+}
+
+// Swap the consumer slot with the published one, but only if a new snapshot was published since the last call.
+const ChVisualSnapshot* ChVisualSnapshotRing::Acquire() {
+    if (m_ready.load(std::memory_order_acquire) & FRESH) {
+        unsigned int prev = m_ready.exchange(m_read, std::memory_order_acq_rel);
+        m_read = prev & ~FRESH;
+        m_has_data = true;
+    }
+    return m_has_data ? &m_slots[m_read] : nullptr;
+}
+
+}  // namespace chrono
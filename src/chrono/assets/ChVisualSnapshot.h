@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2022 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Radu Serban
+// =============================================================================
+
+#ifndef CH_VISUAL_SNAPSHOT_H
+#define CH_VISUAL_SNAPSHOT_H
+
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChFrame.h"
+#include "chrono/assets/ChColor.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+
+namespace chrono {
+
+// Forward references
+class ChSystem;
+class ChBody;
+class ChParticleCloud;
+
+/// State of the visualized objects in a Chrono system at a given simulation time.
+/// A snapshot holds copies of the body frames (visual model and COG), the particle positions (and dynamic colors) of all
+/// particle clouds, and the vertex buffers of all deformable triangle meshes (FEA mesh visualization shapes and mutable
+/// triangle mesh shapes of other physics items). Once published in a ChVisualSnapshotRing, a snapshot can be read by
+/// a rendering thread without accessing the Chrono system.
+class ChApi ChVisualSnapshot {
+  public:
+    /// Visualization data for a particle cloud.
+    struct ParticleCloud {
+        const ChParticleCloud* cloud;       ///< associated particle cloud (used as key only)
+        std::vector<ChVector<>> positions;  ///< particle positions
+        std::vector<ChColor> colors;        ///< particle colors (empty if the cloud does not use dynamic colors)
+    };
+
+    /// Buffers of a deformable triangle mesh.
+    struct TriangleMesh {
+        const ChTriangleMeshShape* shape;  ///< associated visual shape (used as key only)
+        std::vector<ChVector<>> vertices;  ///< mesh vertices
+        std::vector<ChVector<>> normals;   ///< mesh normals
+        std::vector<ChColor> colors;       ///< mesh vertex colors
+    };
+
+    ChVisualSnapshot();
+
+    /// Record the current state of the visualized objects in the given system.
+    /// Buffers are reused between captures; no memory is allocated if the system structure does not change.
+    void Capture(const ChSystem& sys);
+
+    /// Return the simulation time at which this snapshot was captured.
+    double GetTime() const { return m_time; }
+
+    /// Return the number of bodies in this snapshot.
+    size_t GetNumBodies() const { return m_bodies.size(); }
+
+    /// Return the visual model frame of the specified body, or nullptr if the body is not in this snapshot.
+    const ChFrame<>* GetBodyFrame(const ChBody* body) const;
+
+    /// Return the COG frame of the specified body, or nullptr if the body is not in this snapshot.
+    const ChFrame<>* GetBodyCOGFrame(const ChBody* body) const;
+
+    /// Return the data for the specified particle cloud, or nullptr if the cloud is not in this snapshot.
+    const ParticleCloud* GetParticleCloud(const ChParticleCloud* cloud) const;
+
+    /// Return the buffers of the specified deformable mesh, or nullptr if the shape is not in this snapshot.
+    const TriangleMesh* GetTriangleMesh(const ChTriangleMeshShape* shape) const;
+
+    /// Get the list of particle clouds in this snapshot.
+    const std::vector<ParticleCloud>& GetParticleClouds() const { return m_clouds; }
+
+    /// Get the list of deformable meshes in this snapshot.
+    const std::vector<TriangleMesh>& GetTriangleMeshes() const { return m_meshes; }
+
+  private:
+    void CaptureMesh(ChTriangleMeshShape* shape, size_t& num_meshes);
+
+    double m_time;                                         ///< simulation time
+    std::vector<const ChBody*> m_bodies;                   ///< bodies, in system order
+    std::vector<ChFrame<>> m_body_frames;                  ///< body visual model frames
+    std::vector<ChFrame<>> m_body_cog_frames;              ///< body COG frames
+    std::unordered_map<const ChBody*, size_t> m_body_map;  ///< body index in snapshot
+    std::vector<ParticleCloud> m_clouds;                   ///< particle cloud data
+    std::vector<TriangleMesh> m_meshes;                    ///< deformable mesh buffers
+};
+
+/// Lock-free exchange of visualization snapshots between a simulation thread (producer) and a rendering thread
+/// (consumer).
+/// The ring holds three snapshots: one being filled by the producer, one being read by the consumer, and the most
+/// recently published one. Neither side ever waits on the other: the producer always has a free slot to write into
+/// (an unread snapshot is simply replaced by a newer one) and the consumer always gets the latest published snapshot.
+class ChApi ChVisualSnapshotRing {
+  public:
+    ChVisualSnapshotRing();
+
+    /// Producer: get the snapshot to be filled.
+    ChVisualSnapshot& GetWriteSnapshot() { return m_slots[m_write]; }
+
+    /// Producer: publish the snapshot filled since the last call.
+    void Publish();
+
+    /// Consumer: get the most recently published snapshot.
+    /// The returned snapshot is not modified by the producer until the next call to Acquire. Returns nullptr if no
+    /// snapshot was published yet.
+    const ChVisualSnapshot* Acquire();
+
+    /// Return the number of published snapshots.
+    size_t GetNumPublished() const { return m_num_published; }
+
+    /// Return the number of published snapshots that were replaced before being acquired by the consumer.
+    size_t GetNumDropped() const { return m_num_dropped; }
+
+  private:
+    static const unsigned int FRESH = 4;  ///< flag marking an unread published snapshot
+
+    ChVisualSnapshot m_slots[3];
+    std::atomic<unsigned int> m_ready;  ///< index of the published slot (plus FRESH flag)
+    unsigned int m_write;               ///< slot owned by the producer
+    unsigned int m_read;                ///< slot owned by the consumer
+    bool m_has_data;                    ///< true once the consumer acquired a snapshot
+
+    std::atomic<size_t> m_num_published;
+    std::atomic<size_t> m_num_dropped;
+};
+
+}  // namespace chrono
+
+#endif
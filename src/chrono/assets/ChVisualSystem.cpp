@@ -14,8 +14,12 @@
 
 #include "chrono/assets/ChVisualSystem.h"
 
+#include <cmath>
+
 namespace chrono {
 
+ChVisualSystem::ChVisualSystem() : m_snapshots(false), m_snapshot_rate(60), m_snapshot_next(0) {}
+
 ChVisualSystem ::~ChVisualSystem() {
     for (auto s : m_systems)
         s->visual_system = nullptr;
@@ -36,6 +40,34 @@ void ChVisualSystem::UpdateCamera(const ChVector<>& pos, ChVector<> target) {
     SetCameraTarget(target);
 }
 
+void ChVisualSystem::EnableSnapshots(bool val, double rate) {
+    m_snapshots = val;
+    m_snapshot_rate = rate;
+    m_snapshot_next = 0;
+}
+
+// Snapshots are recorded at simulation times on a grid of spacing 1/rate. This function may be called more than once
+// per step (see ChSystem::Update), so a snapshot is recorded only when the next grid point was reached.
+void ChVisualSystem::Synchronize(ChSystem* sys) {
+    if (!m_snapshots) {
+        OnUpdate(sys);
+        return;
+    }
+
+    if (sys != m_systems[0])
+        return;
+
+    if (m_snapshot_rate > 0) {
+        double frame = sys->GetChTime() * m_snapshot_rate;
+        if (frame < m_snapshot_next - 1e-6)
+            return;
+        m_snapshot_next = std::floor(frame + 1e-6) + 1;
+    }
+
+    m_snapshot_ring.GetWriteSnapshot().Capture(*sys);
+    m_snapshot_ring.Publish();
+}
+
 double ChVisualSystem::GetSimulationRTF() const {
     if (m_systems.empty())
         return 0;
@@ -20,6 +20,7 @@
 #include "chrono/core/ChApiCE.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChPhysicsItem.h"
+#include "chrono/assets/ChVisualSnapshot.h"
 
 namespace chrono {
 
@@ -149,6 +150,25 @@ class ChApi ChVisualSystem {
     /// Set the speed of the shown mode (only if some ChModalAssembly is found).
     virtual void SetModalSpeed(double val) {}
 
+    /// Enable/disable decoupled visualization through snapshots (default: false).
+    /// When enabled, an associated system does not call OnUpdate at each step. Instead, the state of the visualized
+    /// objects in the (first) associated system is recorded at the specified rate (snapshots per second of simulated
+    /// time) in a lock-free snapshot ring, from which the rendering thread reads (see AcquireSnapshot). This allows
+    /// running the simulation and the render loop on different threads, with the simulation never waiting on a frame.
+    /// A non-positive rate records a snapshot at every step.
+    void EnableSnapshots(bool val, double rate = 60);
+
+    /// Return true if decoupled visualization through snapshots is enabled.
+    bool SnapshotsEnabled() const { return m_snapshots; }
+
+    /// Get the most recently recorded snapshot (to be called from the rendering thread only).
+    /// The returned snapshot remains valid and unchanged until the next call. Returns nullptr if no snapshot was
+    /// recorded yet.
+    const ChVisualSnapshot* AcquireSnapshot() { return m_snapshot_ring.Acquire(); }
+
+    /// Get the snapshot ring (e.g., to query the number of published or dropped snapshots).
+    const ChVisualSnapshotRing& GetSnapshotRing() const { return m_snapshot_ring; }
+
     /// Get the list of associated Chrono systems.
     std::vector<ChSystem*> GetSystems() const { return m_systems; }
 
@@ -156,7 +176,7 @@ class ChApi ChVisualSystem {
     ChSystem& GetSystem(int i) const { return *m_systems[i]; }
 
   protected:
-    ChVisualSystem() {}
+    ChVisualSystem();
 
     /// Perform any necessary setup operations at the beginning of a time step.
     /// Called by an associated ChSystem.
@@ -172,6 +192,16 @@ class ChApi ChVisualSystem {
 
     std::vector<ChSystem*> m_systems;  ///< associated Chrono system(s)
 
+  private:
+    /// Process the state of an associated system at the end of a step.
+    /// Record a snapshot (if snapshots are enabled and one is due) or call OnUpdate.
+    void Synchronize(ChSystem* sys);
+
+    bool m_snapshots;                      ///< record snapshots instead of calling OnUpdate
+    double m_snapshot_rate;                ///< snapshots per second of simulated time
+    double m_snapshot_next;                ///< index of next snapshot (in units of 1/rate)
+    ChVisualSnapshotRing m_snapshot_ring;  ///< snapshots exchanged with the rendering thread
+
     friend class ChSystem;
 };
 
@@ -27,6 +27,7 @@ ChCollisionInfo::ChCollisionInfo()
       vN(ChVector<>(1, 0, 0)),
       distance(0),
       eff_radius(default_eff_radius),
+      weight(1),
       reaction_cache(nullptr) {}
 
 ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap) {
@@ -50,6 +51,7 @@ ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap)
     }
     distance = other.distance;
     eff_radius = other.eff_radius;
+    weight = other.weight;
     reaction_cache = other.reaction_cache;
 }
 
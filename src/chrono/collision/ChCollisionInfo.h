@@ -35,6 +35,7 @@ class ChApi ChCollisionInfo {
     ChVector<> vN;             ///< coll.normal, respect to A, in abs coords
     double distance;           ///< distance (negative for penetration)
     double eff_radius;         ///< effective radius of curvature at contact (SMC only)
+    double weight;             ///< number of contacts represented by this contact (SMC only, see ChContactReduction)
     float* reaction_cache;     ///< pointer to some persistent user cache of reactions
 
     /// Basic default constructor.
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/collision/ChCollisionModel.h"
+#include "chrono/collision/ChSharedCollisionGeometry.h"
 #include "chrono/physics/ChBody.h"
 
 namespace chrono {
@@ -154,6 +155,20 @@ bool ChCollisionModel::AddConvexHullsFromFile(std::shared_ptr<ChMaterialSurface>
     return true;
 }
 
+bool ChCollisionModel::AddSharedGeometry(std::shared_ptr<ChMaterialSurface> material,
+                                         std::shared_ptr<ChSharedCollisionGeometry> geometry,
+                                         const ChVector<>& pos,
+                                         const ChMatrix33<>& rot) {
+    switch (geometry->GetType()) {
+        case ChSharedCollisionGeometry::Type::CONVEX_HULL:
+            return AddConvexHull(material, geometry->GetPoints(), pos, rot);
+        case ChSharedCollisionGeometry::Type::TRIANGLE_MESH:
+            return AddTriangleMesh(material, geometry->GetMesh(), geometry->IsStatic(), geometry->IsConvex(), pos,
+                                   rot, geometry->GetSphereSweptThickness());
+    }
+    return false;
+}
+
 void ChCollisionModel::SetShapeMaterial(int index, std::shared_ptr<ChMaterialSurface> mat) {
     assert(index < GetNumShapes());
     assert(m_shapes[index]->m_material->GetContactMethod() == mat->GetContactMethod());
@@ -37,6 +37,8 @@ class ChPhysicsItem;
 
 namespace collision {
 
+class ChSharedCollisionGeometry;
+
 /// @addtogroup chrono_collision
 /// @{
 
@@ -196,6 +198,17 @@ class ChApi ChCollisionModel {
         double sphereswept_thickness = 0.0                  ///< outward sphere-swept layer (when supported)
         ) = 0;
 
+    /// Add an instance of a shared collision geometry (convex hull or triangle mesh) to this collision model.
+    /// Derived classes should implement this so that the geometry and any data derived from it (e.g., BVH, shrunk
+    /// hull) are shared, not copied, among all models instancing it. The base implementation adds a copy of the
+    /// geometry through AddConvexHull() or AddTriangleMesh().
+    virtual bool AddSharedGeometry(                           //
+        std::shared_ptr<ChMaterialSurface> material,          ///< surface contact material
+        std::shared_ptr<ChSharedCollisionGeometry> geometry,  ///< shared collision geometry
+        const ChVector<>& pos = ChVector<>(),                 ///< origin position in model coordinates
+        const ChMatrix33<>& rot = ChMatrix33<>(1)             ///< rotation in model coordinates
+    );
+
     /// Add a barrel-like shape to this collision model (main axis on Y direction).
     /// The barrel shape is made by lathing an arc of an ellipse around the vertical Y axis.
     /// The center of the ellipse is on Y=0 level, and it is offsetted by R_offset from
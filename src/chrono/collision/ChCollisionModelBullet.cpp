@@ -18,6 +18,7 @@
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #include "chrono/collision/ChCollisionUtilsBullet.h"
 #include "chrono/collision/ChConvexDecomposition.h"
+#include "chrono/collision/ChSharedCollisionGeometry.h"
 #include "chrono/collision/ChCollisionModelBullet.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/cbtBarrelShape.h"
@@ -115,7 +116,9 @@ void ChCollisionModelBullet::injectShape(const ChVector<>& pos,
     bool centered = (pos.IsNull() && rot.isIdentity());
 
     // This is needed so one can later access the model's GetSafeMargin() and GetEnvelope()
-    shape->m_bt_shape->setUserPointer(this);
+    // (not for shared shapes, which use the margins of the shared geometry)
+    if (!shape->m_bt_shape_shared)
+        shape->m_bt_shape->setUserPointer(this);
 
     // If this is the first shape added to the model...
     if (m_shapes.size() == 0) {
@@ -749,6 +752,147 @@ bool ChCollisionModelBullet::AddTriangleMeshConcaveDecomposed(std::shared_ptr<Ch
     return true;
 }
 
+// Create a Bullet convex hull shape, shrunk by the given safe margin (as in AddConvexHull).
+static std::shared_ptr<cbtCollisionShape> CreateConvexHullShape(const std::vector<ChVector<>>& pointlist,
+                                                                double envelope,
+                                                                double safe_margin) {
+    // adjust inward margin (if object too thin)
+    ChVector<> aabbMax(-1e9, -1e9, -1e9);
+    ChVector<> aabbMin(1e9, 1e9, 1e9);
+    for (size_t i = 0; i < pointlist.size(); ++i) {
+        aabbMax.x() = ChMax(aabbMax.x(), pointlist[i].x());
+        aabbMax.y() = ChMax(aabbMax.y(), pointlist[i].y());
+        aabbMax.z() = ChMax(aabbMax.z(), pointlist[i].z());
+        aabbMin.x() = ChMin(aabbMin.x(), pointlist[i].x());
+        aabbMin.y() = ChMin(aabbMin.y(), pointlist[i].y());
+        aabbMin.z() = ChMin(aabbMin.z(), pointlist[i].z());
+    }
+    ChVector<> aabbsize = aabbMax - aabbMin;
+    double approx_chord = ChMin(ChMin(aabbsize.x(), aabbsize.y()), aabbsize.z());
+    safe_margin = ChMin(safe_margin, approx_chord * 0.2);
+
+    // shrink the convex hull by the safe margin
+    bt_utils::ChConvexHullLibraryWrapper lh;
+    geometry::ChTriangleMeshConnected mmesh;
+    lh.ComputeHull(pointlist, mmesh);
+    mmesh.MakeOffset(-safe_margin);
+
+    std::shared_ptr<cbtConvexHullShape> bt_shape(new cbtConvexHullShape);
+    for (unsigned int i = 0; i < mmesh.m_vertices.size(); i++) {
+        bt_shape->addPoint(cbtVector3((cbtScalar)mmesh.m_vertices[i].x(), (cbtScalar)mmesh.m_vertices[i].y(),
+                                      (cbtScalar)mmesh.m_vertices[i].z()));
+    }
+    bt_shape->setMargin((cbtScalar)(envelope + safe_margin));
+    bt_shape->recalcLocalAabb();
+    return bt_shape;
+}
+
+// Bullet shapes for a shared collision geometry.
+// These shapes are created only once and then shared by all collision models instancing the geometry.
+struct ChSharedBulletShapes {
+    ChCollisionShape::Type type;
+    std::vector<std::shared_ptr<cbtCollisionShape>> shapes;
+};
+
+// Create the Bullet shapes for a shared convex hull or (non-connected) triangle mesh geometry.
+// The shapes are the same as those created by AddConvexHull and AddTriangleMesh, respectively, but with the envelope
+// and safe margin of the shared geometry.
+static std::shared_ptr<ChSharedBulletShapes> CreateSharedBulletShapes(const ChSharedCollisionGeometry& geometry) {
+    double envelope = geometry.GetEnvelope();
+    double safe_margin = geometry.GetSafeMargin();
+
+    auto data = chrono_types::make_shared<ChSharedBulletShapes>();
+
+    if (geometry.GetType() == ChSharedCollisionGeometry::Type::CONVEX_HULL) {
+        if (!geometry.GetPoints().empty()) {
+            data->type = ChCollisionShape::Type::CONVEXHULL;
+            data->shapes.push_back(CreateConvexHullShape(geometry.GetPoints(), envelope, safe_margin));
+        }
+        return data;
+    }
+
+    auto trimesh = geometry.GetMesh();
+    if (!trimesh || !trimesh->getNumTriangles())
+        return data;
+
+    if (!geometry.IsStatic() && !geometry.IsConvex()) {
+        // moving non-convex mesh: convex decomposition (HACDv2) with hulls that are not shrunk (safe margin 0)
+        auto decomposition = chrono_types::make_shared<ChConvexDecompositionHACDv2>();
+        decomposition->Reset();
+        decomposition->AddTriangleMesh(*trimesh);
+        decomposition->SetParameters(  //
+            512,                       // max hull count
+            256,                       // max hull merge
+            64,                        // max hull vettices
+            0.2f,                      // concavity
+            0.0f,                      // small cluster threshold
+            1e-9f                      // fuse tolerance
+        );
+        decomposition->ComputeConvexDecomposition();
+
+        data->type = ChCollisionShape::Type::CONVEXHULL;
+        for (unsigned int j = 0; j < decomposition->GetHullCount(); j++) {
+            std::vector<ChVector<double>> ptlist;
+            decomposition->GetConvexHullResult(j, ptlist);
+            if (ptlist.size())
+                data->shapes.push_back(CreateConvexHullShape(ptlist, envelope, 0));
+        }
+        return data;
+    }
+
+    cbtTriangleMesh* bulletMesh = new cbtTriangleMesh;
+    for (int i = 0; i < trimesh->getNumTriangles(); i++) {
+        bulletMesh->addTriangle(ChVectToBullet(trimesh->getTriangle(i).p1), ChVectToBullet(trimesh->getTriangle(i).p2),
+                                ChVectToBullet(trimesh->getTriangle(i).p3),
+                                true);  // try to remove duplicate vertices
+    }
+
+    data->type = ChCollisionShape::Type::TRIANGLEMESH;
+    if (geometry.IsStatic()) {
+        auto bt_shape = std::shared_ptr<cbtBvhTriangleMeshShape>(new cbtBvhTriangleMeshShape_handlemesh(bulletMesh));
+        bt_shape->setMargin((cbtScalar)safe_margin);
+        data->shapes.push_back(bt_shape);
+    } else {
+        auto bt_shape =
+            std::shared_ptr<cbtConvexTriangleMeshShape>(new cbtConvexTriangleMeshShape_handlemesh(bulletMesh));
+        bt_shape->setMargin((cbtScalar)envelope);
+        data->shapes.push_back(bt_shape);
+    }
+    return data;
+}
+
+bool ChCollisionModelBullet::AddSharedGeometry(std::shared_ptr<ChMaterialSurface> material,
+                                               std::shared_ptr<ChSharedCollisionGeometry> geometry,
+                                               const ChVector<>& pos,
+                                               const ChMatrix33<>& rot) {
+    // Connected meshes are represented by per-model triangle proxies (referencing the shared mesh vertices), exactly
+    // as in AddTriangleMesh. Proxies are always placed in the model frame, so off-center instances are not supported.
+    if (geometry->GetType() == ChSharedCollisionGeometry::Type::TRIANGLE_MESH &&
+        std::dynamic_pointer_cast<geometry::ChTriangleMeshConnected>(geometry->GetMesh())) {
+        if (!pos.IsNull() || !rot.isIdentity())
+            return false;
+        return AddTriangleMesh(material, geometry->GetMesh(), geometry->IsStatic(), geometry->IsConvex(), pos, rot,
+                               geometry->GetSphereSweptThickness());
+    }
+
+    auto data = std::static_pointer_cast<ChSharedBulletShapes>(geometry->GetDerivedData(
+        ChCollisionSystemType::BULLET, [&geometry]() { return CreateSharedBulletShapes(*geometry); }));
+    if (data->shapes.empty())
+        return false;
+
+    if (geometry->GetType() == ChSharedCollisionGeometry::Type::TRIANGLE_MESH)
+        m_trimeshes.push_back(geometry->GetMesh());  // cache pointer to triangle mesh
+
+    for (const auto& bt_shape : data->shapes) {
+        auto shape = new ChCollisionShapeBullet(data->type, material);
+        shape->m_bt_shape = bt_shape.get();
+        shape->m_bt_shape_shared = bt_shape;
+        injectShape(pos, rot, shape);
+    }
+
+    return true;
+}
+
 bool ChCollisionModelBullet::AddCopyOfAnotherModel(ChCollisionModel* other) {
     SetSafeMargin(other->GetSafeMargin());
     SetEnvelope(other->GetEnvelope());
@@ -200,6 +200,19 @@ class ChApi ChCollisionModelBullet : public ChCollisionModel {
         double sphereswept_thickness = 0.0                  ///< outward sphere-swept layer (when supported)
         ) override;
 
+    /// Add an instance of a shared collision geometry to this collision model.
+    /// The Bullet shapes are the same as those created by AddConvexHull() and AddTriangleMesh() (convex hull, BVH
+    /// triangle mesh, convex mesh, or HACDv2 convex decomposition for moving non-convex meshes); they are created only
+    /// once and shared by all collision models instancing the geometry.
+    /// A connected triangle mesh is instead added through AddTriangleMesh() as per-model triangle proxies which use
+    /// the envelope and safe margin of this model. In that case, the instance must be centered (return false otherwise).
+    virtual bool AddSharedGeometry(                           //
+        std::shared_ptr<ChMaterialSurface> material,          ///< surface contact material
+        std::shared_ptr<ChSharedCollisionGeometry> geometry,  ///< shared collision geometry
+        const ChVector<>& pos = ChVector<>(),                 ///< origin position in model coordinates
+        const ChMatrix33<>& rot = ChMatrix33<>(1)             ///< rotation in model coordinates
+        ) override;
+
     /// CUSTOM for this class only: add a concave triangle mesh that will be managed
     /// by GImpact mesh-mesh algorithm. Note that, despite this can work with
     /// arbitrary meshes, there could be issues of robustness and precision, so
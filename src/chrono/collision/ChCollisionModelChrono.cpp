@@ -323,6 +323,31 @@ bool ChCollisionModelChrono::AddConvexHull(std::shared_ptr<ChMaterialSurface> ma
     return true;
 }
 
+bool ChCollisionModelChrono::AddSharedGeometry(std::shared_ptr<ChMaterialSurface> material,
+                                               std::shared_ptr<ChSharedCollisionGeometry> geometry,
+                                               const ChVector<>& pos,
+                                               const ChMatrix33<>& rot) {
+    if (geometry->GetType() != ChSharedCollisionGeometry::Type::CONVEX_HULL)
+        return ChCollisionModel::AddSharedGeometry(material, geometry, pos, rot);
+
+    ChFrame<> frame;
+    TransformToCOG(GetBody(), pos, rot, frame);
+    const ChVector<>& position = frame.GetPos();
+    const ChQuaternion<>& rotation = frame.GetRot();
+
+    // Hull points are not copied in local_convex_data; the collision system stores them once per geometry
+    auto shape = new ChCollisionShapeChrono(ChCollisionShape::Type::CONVEX, material);
+    shape->A = real3(position.x(), position.y(), position.z());
+    shape->B = real3((chrono::real)geometry->GetPoints().size(), 0, 0);
+    shape->C = real3(0, 0, 0);
+    shape->R = quaternion(rotation.e0(), rotation.e1(), rotation.e2(), rotation.e3());
+    shape->geometry = geometry;
+
+    m_shapes.push_back(std::shared_ptr<ChCollisionShape>(shape));
+
+    return true;
+}
+
 bool ChCollisionModelChrono::AddBarrel(std::shared_ptr<ChMaterialSurface> material,
                                        double Y_low,
                                        double Y_high,
@@ -196,6 +196,18 @@ class ChApi ChCollisionModelChrono : public ChCollisionModel {
         double sphereswept_thickness = 0.0                  ///< outward sphere-swept layer (when supported)
         ) override;
 
+    /// Add an instance of a shared collision geometry to this collision model.
+    /// The points of a shared convex hull are stored only once in the collision system, regardless of the number of
+    /// instances. A shared triangle mesh is added as individual triangle shapes (as in AddTriangleMesh), since the
+    /// narrowphase requires per-shape triangle vertices. The envelope of the shared geometry is not used: like all other
+    /// shapes, instances use the envelope of the collision system.
+    virtual bool AddSharedGeometry(                           //
+        std::shared_ptr<ChMaterialSurface> material,          ///< surface contact material
+        std::shared_ptr<ChSharedCollisionGeometry> geometry,  ///< shared collision geometry
+        const ChVector<>& pos = ChVector<>(),                 ///< origin position in model coordinates
+        const ChMatrix33<>& rot = ChMatrix33<>(1)             ///< rotation in model coordinates
+        ) override;
+
     /// Add a barrel-like shape to this collision model (main axis on Y direction).
     /// The barrel shape is made by lathing an arc of an ellipse around the vertical Y axis.
     /// The center of the ellipse is on Y=0 level, and it is offsetted by R_offset from
@@ -30,10 +30,14 @@ class ChCollisionShapeBullet : public ChCollisionShape {
     ChCollisionShapeBullet(Type type, std::shared_ptr<ChMaterialSurface> material)
         : ChCollisionShape(type, material), m_bt_shape(nullptr) {}
 
-    ~ChCollisionShapeBullet() { delete m_bt_shape; }
+    ~ChCollisionShapeBullet() {
+        if (!m_bt_shape_shared)
+            delete m_bt_shape;
+    }
 
   private:
     cbtCollisionShape* m_bt_shape;
+    std::shared_ptr<cbtCollisionShape> m_bt_shape_shared;  ///< owner of m_bt_shape, if shared with other models
 
     friend class ChCollisionModelBullet;
 };
@@ -16,6 +16,7 @@
 #define CH_COLLISION_SHAPE_CHRONO
 
 #include "chrono/collision/ChCollisionShape.h"
+#include "chrono/collision/ChSharedCollisionGeometry.h"
 
 #include "chrono/multicore_math/real3.h"
 #include "chrono/multicore_math/real4.h"
@@ -37,6 +38,8 @@ class ChCollisionShapeChrono : public ChCollisionShape {
     real3 C;        ///< extra
     quaternion R;   ///< rotation
     real3* convex;  ///< pointer to convex data;
+
+    std::shared_ptr<ChSharedCollisionGeometry> geometry;  ///< shared convex hull data (if any)
 };
 
 /// @} collision_mc
@@ -17,6 +17,7 @@
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
+#include "chrono/collision/ChContactReduction.h"
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/assets/ChColor.h"
@@ -151,6 +152,15 @@ class ChApi ChCollisionSystem {
     /// callback object will be called for each collision pair found during narrow phase.
     void RegisterNarrowphaseCallback(std::shared_ptr<NarrowphaseCallback> callback) { narrow_callback = callback; }
 
+    /// Enable contact reduction with the given settings (default: no contact reduction).
+    /// If enabled, the contacts found by the narrowphase (and accepted by the narrowphase callback, if any) are
+    /// clustered in patches per pair of collision models and only a few representative contacts per patch are added to
+    /// the contact container (see ChContactReduction). Pass an empty pointer to disable contact reduction.
+    void SetContactReduction(std::shared_ptr<ChContactReduction> reduction) { contact_reduction = reduction; }
+
+    /// Get the contact reduction stage (empty if contact reduction is not enabled).
+    std::shared_ptr<ChContactReduction> GetContactReduction() const { return contact_reduction; }
+
     /// Recover results from RayHit() raycasting.
     struct ChRayhitResult {
         bool hit;                    ///< if true, there was an hit
@@ -217,10 +227,11 @@ class ChApi ChCollisionSystem {
     void SetSystem(ChSystem* sys) { m_system = sys; }
 
   protected:
-    ChSystem* m_system;                                    ///< associated Chrono system
-    std::shared_ptr<BroadphaseCallback> broad_callback;    ///< user callback for each near-enough pair of shapes
-    std::shared_ptr<NarrowphaseCallback> narrow_callback;  ///< user callback for each collision pair
-    std::shared_ptr<VisualizationCallback> vis_callback;   ///< user callback for debug visualization
+    ChSystem* m_system;                                     ///< associated Chrono system
+    std::shared_ptr<BroadphaseCallback> broad_callback;     ///< user callback for each near-enough pair of shapes
+    std::shared_ptr<NarrowphaseCallback> narrow_callback;   ///< user callback for each collision pair
+    std::shared_ptr<ChContactReduction> contact_reduction;  ///< optional contact reduction stage
+    std::shared_ptr<VisualizationCallback> vis_callback;    ///< user callback for debug visualization
     int m_vis_flags;
 };
 
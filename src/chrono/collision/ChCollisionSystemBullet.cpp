@@ -239,6 +239,13 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
                     int indexA = compoundA ? pt.m_index0 : 0;
                     int indexB = compoundB ? pt.m_index1 : 0;
 
+                    // For a triangle mesh child of a compound (e.g., an off-center mesh), Bullet reports the triangle
+                    // index instead of the child index. Fall back to the first shape in that case.
+                    if (indexA < 0 || indexA >= icontact.modelA->GetNumShapes())
+                        indexA = 0;
+                    if (indexB < 0 || indexB >= icontact.modelB->GetNumShapes())
+                        indexB = 0;
+
                     icontact.shapeA = icontact.modelA->GetShape(indexA).get();
                     icontact.shapeB = icontact.modelB->GetShape(indexB).get();
 
@@ -252,7 +259,10 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
                         ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
                         ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" << icontact.shapeB->m_type << std::endl;
 
-                        mcontactcontainer->AddContact(icontact);
+                        if (contact_reduction)
+                            contact_reduction->Add(icontact);
+                        else
+                            mcontactcontainer->AddContact(icontact);
                     }
                 }
             }
@@ -261,6 +271,10 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
         // Uncomment this line to remove all points
         ////contactManifold->clearManifold();
     }
+
+    if (contact_reduction)
+        contact_reduction->Report(mcontactcontainer);
+
     mcontactcontainer->EndAddContact();
 }
 
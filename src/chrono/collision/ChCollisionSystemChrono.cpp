@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <cmath>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
 #include "chrono/collision/chrono/ChRayTest.h"
@@ -24,7 +26,7 @@
 namespace chrono {
 namespace collision {
 
-ChCollisionSystemChrono::ChCollisionSystemChrono() : use_aabb_active(false) {
+ChCollisionSystemChrono::ChCollisionSystemChrono() : use_speculative(false), use_aabb_active(false) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -56,10 +58,19 @@ void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemChrono::SetBroadphaseMultiLevelGrid(double level_ratio) {
+    broadphase.level_ratio = real(level_ratio);
+    broadphase.grid_type = ChBroadphase::GridType::MULTI_LEVEL;
+}
+
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
 
+void ChCollisionSystemChrono::EnableSpeculativeContacts(bool val) {
+    use_speculative = val;
+}
+
 void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max) {
     active_aabb_min = FromChVector(aabb_min);
     active_aabb_max = FromChVector(aabb_max);
@@ -172,7 +183,27 @@ void ChCollisionSystemChrono::Add(ChCollisionModel* model) {
                 shape_data.rbox_like_rigid.push_back(real4(obB, obC.x));
                 break;
             case ChCollisionShape::Type::CONVEX:
-                start = (int)(obB.y + convex_data_offset);
+                if (shape->geometry) {
+                    // Shared convex hull: insert the points only for the first instance of the geometry
+                    auto it = shared_convex_offsets.find(shape->geometry.get());
+                    if (it == shared_convex_offsets.end()) {
+                        // This collision system uses a single envelope for all shapes
+                        if (std::abs(shape->geometry->GetEnvelope() - cd_data->collision_envelope) > 1e-9) {
+                            GetLog() << "WARNING: shared convex hull envelope (" << shape->geometry->GetEnvelope()
+                                     << ") ignored; using the collision system envelope ("
+                                     << (double)cd_data->collision_envelope << ").\n";
+                        }
+                        const auto& points = shape->geometry->GetPoints();
+                        start = (int)shape_data.convex_rigid.size();
+                        for (const auto& p : points)
+                            shape_data.convex_rigid.push_back(real3(p.x(), p.y(), p.z()));
+                        shared_convex_offsets.insert({shape->geometry.get(), start});
+                    } else {
+                        start = it->second;
+                    }
+                } else {
+                    start = (int)(obB.y + convex_data_offset);
+                }
                 length = (int)obB.x;
                 break;
             case ChCollisionShape::Type::TRIANGLE:
@@ -331,6 +362,22 @@ void ChCollisionSystemChrono::PreProcess() {
         active[i] = body->IsActive();
         collide[i] = body->GetCollide();
     }
+
+    // Body velocities, used to expand the shape AABBs over the current step
+    cd_data->speculative_step = use_speculative ? real(m_system->GetStep()) : 0;
+    if (use_speculative) {
+        std::vector<real3>& lin_vel = *cd_data->state_data.lin_vel_rigid;
+        std::vector<real3>& ang_vel = *cd_data->state_data.ang_vel_rigid;
+        lin_vel.resize(nbodies);
+        ang_vel.resize(nbodies);
+
+#pragma omp parallel for
+        for (int i = 0; i < nbodies; i++) {
+            const auto& body = blist[i];
+            lin_vel[i] = FromChVector(body->GetPos_dt());
+            ang_vel[i] = FromChVector(body->GetWvel_par());
+        }
+    }
 }
 
 void ChCollisionSystemChrono::PostProcess() {
@@ -418,10 +465,18 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
         if (this->narrow_callback)
             add_contact = this->narrow_callback->OnNarrowphase(cinfo);
 
-        if (add_contact)
+        if (!add_contact)
+            continue;
+
+        if (contact_reduction)
+            contact_reduction->Add(cinfo);
+        else
             container->AddContact(cinfo);
     }
 
+    if (contact_reduction)
+        contact_reduction->Report(container);
+
     container->EndAddContact();
 }
 
@@ -526,10 +581,17 @@ void ChCollisionSystemChrono::GenerateAABB() {
 
         std::vector<real3>& aabb_min = cd_data->aabb_min;
         std::vector<real3>& aabb_max = cd_data->aabb_max;
+        std::vector<real>& aabb_spec = cd_data->aabb_spec;
 
         aabb_min.resize(num_rigid_shapes);
         aabb_max.resize(num_rigid_shapes);
 
+        const real step = cd_data->speculative_step;
+        if (step > 0)
+            aabb_spec.assign(num_rigid_shapes, 0);
+        else
+            aabb_spec.clear();
+
 #pragma omp parallel for
         for (int index = 0; index < (signed)num_rigid_shapes; index++) {
             // Shape data
@@ -593,6 +655,19 @@ void ChCollisionSystemChrono::GenerateAABB() {
                 continue;
             }
 
+            // Expand the AABB to cover the motion of the shape over the step. The displacement of any point of the
+            // shape is bounded by h * (|v| + |w| * r), with r the largest distance from the body reference point.
+            if (step > 0) {
+                real3 lin_disp = step * (*cd_data->state_data.lin_vel_rigid)[id];
+                real3 center = real(0.5) * (temp_min + temp_max);
+                real radius = Length(center - position) + Length(real(0.5) * (temp_max - temp_min));
+                real ang_disp = step * Length((*cd_data->state_data.ang_vel_rigid)[id]) * radius;
+
+                temp_min = Min(temp_min, temp_min + lin_disp) - ang_disp;
+                temp_max = Max(temp_max, temp_max + lin_disp) + ang_disp;
+                aabb_spec[index] = Length(lin_disp) + ang_disp;
+            }
+
             aabb_min[index] = temp_min;
             aabb_max[index] = temp_max;
         }
@@ -20,6 +20,8 @@
 #ifndef CH_COLLISION_SYSTEM_CHRONO_H
 #define CH_COLLISION_SYSTEM_CHRONO_H
 
+#include <unordered_map>
+
 #include "chrono/core/ChTimer.h"
 
 #include "chrono/collision/ChCollisionSystem.h"
@@ -67,12 +69,25 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Use a hierarchical grid, with cell sizes increasing by the specified ratio (larger than 1) between levels.
+    /// Each shape is binned in the level with cells matching its size. Recommended for scenes with shapes of very
+    /// different sizes (e.g., small particles and large terrain or container shapes).
+    void SetBroadphaseMultiLevelGrid(double level_ratio = 2);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
     /// Minkovski Portal Refinement algorithm (see ChNarrowphaseMPR).
     void SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm);
 
+    /// Enable speculative contacts (default: false).
+    /// If enabled, the AABB of each collision shape is expanded by the distance its points can travel during the
+    /// current step (based on the velocity of the associated body) and contacts are also generated for pairs of shapes
+    /// which are separated by more than the collision envelope but may come in contact during the step. Such contacts
+    /// have a positive separation; with NSC contact, they only limit the approach velocity so that the gap is at most
+    /// closed at the end of the step. This prevents tunneling of fast objects through thin shapes at large step sizes.
+    void EnableSpeculativeContacts(bool val);
+
     /// Enable monitoring of shapes outside active bounding box (default: false).
     /// If enabled, objects whose collision shapes exit the active bounding box are deactivated (frozen).
     /// The size of the bounding box is specified by its min and max extents.
@@ -168,6 +183,10 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
 
     std::vector<char> body_active;
 
+    /// Offsets in the convex data of the points of shared convex hulls (stored once per geometry).
+    std::unordered_map<const ChSharedCollisionGeometry*, int> shared_convex_offsets;
+
+    bool use_speculative;   ///< enable speculative contacts
     bool use_aabb_active;   ///< enable freezing of objects outside the active bounding box
     real3 active_aabb_min;  ///< lower corner of active bounding box
     real3 active_aabb_max;  ///< upper corner of active bounding box
@@ -0,0 +1,186 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+#include "chrono/collision/ChContactReduction.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/physics/ChContactContainer.h"
+
+namespace chrono {
+namespace collision {
+
+// Contacts are grouped per pair of collision models and pair of contact materials (if any), so that all contacts in a
+// group produce the same kind of contact in the container.
+struct PairKey {
+    const void* ptr[4];
+    bool operator==(const PairKey& other) const {
+        return ptr[0] == other.ptr[0] && ptr[1] == other.ptr[1] && ptr[2] == other.ptr[2] && ptr[3] == other.ptr[3];
+    }
+};
+
+struct PairKeyHash {
+    std::size_t operator()(const PairKey& key) const {
+        std::size_t h = 0;
+        for (int i = 0; i < 4; i++)
+            h ^= std::hash<const void*>()(key.ptr[i]) + 0x9e3779b9 + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+static PairKey GetPairKey(const ChCollisionInfo& cinfo) {
+    PairKey key;
+    key.ptr[0] = cinfo.modelA;
+    key.ptr[1] = cinfo.modelB;
+    key.ptr[2] = cinfo.shapeA ? cinfo.shapeA->GetMaterial().get() : nullptr;
+    key.ptr[3] = cinfo.shapeB ? cinfo.shapeB->GetMaterial().get() : nullptr;
+    return key;
+}
+
+ChContactReduction::ChContactReduction()
+    : m_max_contacts(4), m_cos_angle(std::cos(20 * CH_C_DEG_TO_RAD)), m_num_input(0), m_num_output(0) {}
+
+void ChContactReduction::SetMaxContactsPerPatch(int num_contacts) {
+    m_max_contacts = std::max(num_contacts, 1);
+}
+
+void ChContactReduction::SetPatchAngle(double angle) {
+    m_cos_angle = std::cos(angle);
+}
+
+void ChContactReduction::Clear() {
+    m_input.clear();
+}
+
+void ChContactReduction::Add(const ChCollisionInfo& cinfo) {
+    m_input.push_back(cinfo);
+}
+
+void ChContactReduction::Reduce(std::vector<ChCollisionInfo>& contacts) {
+    contacts.clear();
+    m_num_input = (int)m_input.size();
+
+    // Group contacts per pair (in order of first appearance)
+    std::unordered_map<PairKey, int, PairKeyHash> group_map;
+    std::vector<std::vector<int>> groups;
+    for (int i = 0; i < m_num_input; i++) {
+        auto res = group_map.insert({GetPairKey(m_input[i]), (int)groups.size()});
+        if (res.second)
+            groups.push_back(std::vector<int>());
+        groups[res.first->second].push_back(i);
+    }
+
+    // Cluster the contacts of each pair in patches with similar normals and reduce each patch
+    std::vector<std::vector<int>> patches;
+    for (const auto& group : groups) {
+        if ((int)group.size() <= m_max_contacts) {
+            for (auto i : group)
+                contacts.push_back(m_input[i]);
+            continue;
+        }
+
+        patches.clear();
+        for (auto i : group) {
+            bool found = false;
+            for (auto& patch : patches) {
+                if (Vdot(m_input[i].vN, m_input[patch[0]].vN) >= m_cos_angle) {
+                    patch.push_back(i);
+                    found = true;
+                    break;
+                }
+            }
+            if (!found)
+                patches.push_back(std::vector<int>(1, i));
+        }
+
+        for (const auto& patch : patches)
+            ReducePatch(patch, contacts);
+    }
+
+    m_num_output = (int)contacts.size();
+    m_input.clear();
+}
+
+void ChContactReduction::ReducePatch(const std::vector<int>& patch, std::vector<ChCollisionInfo>& contacts) {
+    int n = (int)patch.size();
+    if (n <= m_max_contacts) {
+        for (auto i : patch)
+            contacts.push_back(m_input[i]);
+        return;
+    }
+
+    // Squared distance between two contact points, projected on the patch tangent plane
+    const ChVector<>& normal = m_input[patch[0]].vN;
+    auto dist2 = [&](int i, int j) {
+        ChVector<> d = m_input[patch[i]].vpA - m_input[patch[j]].vpA;
+        d -= Vdot(d, normal) * normal;
+        return d.Length2();
+    };
+
+    // Start with the deepest contact
+    int deepest = 0;
+    for (int k = 1; k < n; k++) {
+        if (m_input[patch[k]].distance < m_input[patch[deepest]].distance)
+            deepest = k;
+    }
+
+    // Add the contacts farthest from the selected ones, keeping track of the nearest selected contact for each
+    std::vector<int> selected(1, deepest);
+    std::vector<int> owner(n, 0);
+    std::vector<double> min_dist2(n);
+    for (int k = 0; k < n; k++)
+        min_dist2[k] = dist2(k, deepest);
+
+    while ((int)selected.size() < m_max_contacts) {
+        int farthest = 0;
+        for (int k = 1; k < n; k++) {
+            if (min_dist2[k] > min_dist2[farthest])
+                farthest = k;
+        }
+        if (min_dist2[farthest] <= 0)
+            break;
+
+        int s = (int)selected.size();
+        selected.push_back(farthest);
+        for (int k = 0; k < n; k++) {
+            double d2 = dist2(k, farthest);
+            if (d2 < min_dist2[k]) {
+                min_dist2[k] = d2;
+                owner[k] = s;
+            }
+        }
+    }
+
+    // Each selected contact represents the contacts nearest to it
+    std::vector<double> weight(selected.size(), 0.0);
+    for (int k = 0; k < n; k++)
+        weight[owner[k]] += m_input[patch[k]].weight;
+
+    for (size_t s = 0; s < selected.size(); s++) {
+        contacts.push_back(m_input[patch[selected[s]]]);
+        contacts.back().weight = weight[s];
+    }
+}
+
+void ChContactReduction::Report(ChContactContainer* container) {
+    Reduce(m_output);
+    for (const auto& cinfo : m_output)
+        container->AddContact(cinfo);
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_CONTACT_REDUCTION_H
+#define CH_CONTACT_REDUCTION_H
+
+#include <vector>
+
+#include "chrono/collision/ChCollisionInfo.h"
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+// forward references
+class ChContactContainer;
+
+namespace collision {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Contact reduction stage between narrowphase and contact container.
+/// Contacts reported by the collision system are grouped per pair of collision models (and pair of contact materials)
+/// and clustered into patches of contacts with similar normals. For each patch with more than the maximum number of
+/// contacts, a small representative set is kept: the deepest contact, followed by the contacts farthest from the
+/// already selected ones (in the patch tangent plane), i.e. extremal points of the patch. Each discarded contact is
+/// assigned to the nearest kept contact, whose weight (ChCollisionInfo::weight) is the number of contacts it represents.
+/// SMC contacts scale their force with this weight, so that the total patch stiffness is approximately preserved; NSC
+/// contacts ignore it.
+class ChApi ChContactReduction {
+  public:
+    ChContactReduction();
+    ~ChContactReduction() {}
+
+    /// Set the maximum number of contacts kept per contact patch (default: 4).
+    void SetMaxContactsPerPatch(int num_contacts);
+
+    /// Set the maximum angle between the normals of contacts in the same patch (default: 20 degrees).
+    void SetPatchAngle(double angle);
+
+    /// Remove all collected contacts.
+    void Clear();
+
+    /// Collect the given contact.
+    void Add(const ChCollisionInfo& cinfo);
+
+    /// Reduce the collected contacts and return the representative contacts.
+    /// The collected contacts are cleared.
+    void Reduce(std::vector<ChCollisionInfo>& contacts);
+
+    /// Reduce the collected contacts and add the representative contacts to the given container.
+    /// The collected contacts are cleared.
+    void Report(ChContactContainer* container);
+
+    /// Return the number of contacts collected in the last reduction.
+    int GetNumInputContacts() const { return m_num_input; }
+
+    /// Return the number of contacts kept in the last reduction.
+    int GetNumOutputContacts() const { return m_num_output; }
+
+  private:
+    /// Select representative contacts of the patch with the given contact indices and append them to the output.
+    void ReducePatch(const std::vector<int>& patch, std::vector<ChCollisionInfo>& contacts);
+
+    int m_max_contacts;   ///< maximum number of contacts per patch
+    double m_cos_angle;   ///< cosine of maximum angle between normals in a patch
+    int m_num_input;      ///< number of contacts collected in last reduction
+    int m_num_output;     ///< number of contacts kept in last reduction
+
+    std::vector<ChCollisionInfo> m_input;   ///< collected contacts
+    std::vector<ChCollisionInfo> m_output;  ///< reduced contacts (reused between reductions)
+};
+
+/// @} chrono_collision
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
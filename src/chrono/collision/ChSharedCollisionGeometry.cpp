@@ -0,0 +1,62 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include "chrono/collision/ChSharedCollisionGeometry.h"
+
+namespace chrono {
+namespace collision {
+
+ChSharedCollisionGeometry::ChSharedCollisionGeometry(Type type, double envelope, double safe_margin)
+    : m_type(type), m_is_static(false), m_is_convex(true), m_sphereswept_thickness(0) {
+    m_envelope = envelope < 0 ? ChCollisionModel::GetDefaultSuggestedEnvelope() : envelope;
+    m_safe_margin = safe_margin < 0 ? ChCollisionModel::GetDefaultSuggestedMargin() : safe_margin;
+}
+
+std::shared_ptr<ChSharedCollisionGeometry> ChSharedCollisionGeometry::CreateConvexHull(
+    const std::vector<ChVector<>>& points,
+    double envelope,
+    double safe_margin) {
+    std::shared_ptr<ChSharedCollisionGeometry> geometry(
+        new ChSharedCollisionGeometry(Type::CONVEX_HULL, envelope, safe_margin));
+    geometry->m_points = points;
+    return geometry;
+}
+
+std::shared_ptr<ChSharedCollisionGeometry> ChSharedCollisionGeometry::CreateTriangleMesh(
+    std::shared_ptr<geometry::ChTriangleMesh> trimesh,
+    bool is_static,
+    bool is_convex,
+    double envelope,
+    double safe_margin,
+    double sphereswept_thickness) {
+    std::shared_ptr<ChSharedCollisionGeometry> geometry(
+        new ChSharedCollisionGeometry(Type::TRIANGLE_MESH, envelope, safe_margin));
+    geometry->m_trimesh = trimesh;
+    geometry->m_is_static = is_static;
+    geometry->m_is_convex = is_convex;
+    geometry->m_sphereswept_thickness = sphereswept_thickness;
+    return geometry;
+}
+
+std::shared_ptr<void> ChSharedCollisionGeometry::GetDerivedData(ChCollisionSystemType type,
+                                                                std::function<std::shared_ptr<void>()> builder) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& data = m_derived[static_cast<int>(type)];
+    if (!data)
+        data = builder();
+    return data;
+}
+
+}  // end namespace collision
+}  // end namespace chrono
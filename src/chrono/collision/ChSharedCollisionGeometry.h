@@ -0,0 +1,114 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_SHARED_COLLISION_GEOMETRY_H
+#define CH_SHARED_COLLISION_GEOMETRY_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector.h"
+#include "chrono/geometry/ChTriangleMesh.h"
+#include "chrono/collision/ChCollisionModel.h"
+
+namespace chrono {
+namespace collision {
+
+/// @addtogroup chrono_collision
+/// @{
+
+/// Immutable collision geometry (convex hull or triangle mesh) that can be instanced on any number of collision models.
+/// Any data derived from the geometry by a collision system (e.g., a Bullet BVH or shrunk convex hull) is built once,
+/// the first time the geometry is added to a collision model, and then shared by all instances. Only the per-instance
+/// transform and contact material are stored in each collision model.
+///
+/// Since derived data is shared, the collision envelope and safe margin used for all instances are those specified at
+/// construction, not those of the individual collision models. The geometry must not be modified after creation.
+/// Note that ChCollisionSystemChrono has a single, system-wide collision envelope (ChCollisionSystemChrono::SetEnvelope)
+/// and no safe margin; with that collision system, the geometry should be created with the system envelope.
+///
+/// Exception: with the Bullet collision system, a ChTriangleMeshConnected is always represented (as in
+/// ChCollisionModel::AddTriangleMesh) by one triangle proxy per face, with winged edges and sphere-swept radius. The
+/// proxies reference the shared mesh vertices but are created for each instance and use the envelope and safe margin
+/// of the instancing collision model; such instances must be centered (identity position and rotation).
+class ChApi ChSharedCollisionGeometry {
+  public:
+    enum class Type {
+        CONVEX_HULL,   ///< convex hull of a point cloud
+        TRIANGLE_MESH  ///< triangle mesh
+    };
+
+    /// Create a shared convex hull geometry from the given point cloud.
+    static std::shared_ptr<ChSharedCollisionGeometry> CreateConvexHull(
+        const std::vector<ChVector<>>& points,  ///< list of hull points
+        double envelope = -1,                   ///< outward envelope (default: ChCollisionModel default envelope)
+        double safe_margin = -1                 ///< inward safe margin (default: ChCollisionModel default margin)
+    );
+
+    /// Create a shared triangle mesh geometry.
+    static std::shared_ptr<ChSharedCollisionGeometry> CreateTriangleMesh(
+        std::shared_ptr<geometry::ChTriangleMesh> trimesh,  ///< the triangle mesh
+        bool is_static,                                     ///< true if instances do not move
+        bool is_convex,                                     ///< if true, a convex hull is used
+        double envelope = -1,               ///< outward envelope (default: ChCollisionModel default envelope)
+        double safe_margin = -1,            ///< inward safe margin (default: ChCollisionModel default margin)
+        double sphereswept_thickness = 0.0  ///< outward sphere-swept layer (connected meshes only)
+    );
+
+    ~ChSharedCollisionGeometry() {}
+
+    Type GetType() const { return m_type; }
+
+    /// Get the hull points (CONVEX_HULL geometry only).
+    const std::vector<ChVector<>>& GetPoints() const { return m_points; }
+
+    /// Get the triangle mesh (TRIANGLE_MESH geometry only).
+    std::shared_ptr<geometry::ChTriangleMesh> GetMesh() const { return m_trimesh; }
+
+    bool IsStatic() const { return m_is_static; }
+    bool IsConvex() const { return m_is_convex; }
+    double GetEnvelope() const { return m_envelope; }
+    double GetSafeMargin() const { return m_safe_margin; }
+    double GetSphereSweptThickness() const { return m_sphereswept_thickness; }
+
+    /// Return the data derived from this geometry by the specified type of collision system, invoking the given
+    /// builder the first time it is requested. This function is thread safe.
+    /// Intended for use by collision model implementations.
+    std::shared_ptr<void> GetDerivedData(ChCollisionSystemType type, std::function<std::shared_ptr<void>()> builder);
+
+  private:
+    ChSharedCollisionGeometry(Type type, double envelope, double safe_margin);
+
+    Type m_type;
+    std::vector<ChVector<>> m_points;
+    std::shared_ptr<geometry::ChTriangleMesh> m_trimesh;
+    bool m_is_static;
+    bool m_is_convex;
+    double m_envelope;
+    double m_safe_margin;
+    double m_sphereswept_thickness;
+
+    std::shared_ptr<void> m_derived[3];  ///< derived data, per collision system type
+    std::mutex m_mutex;                  ///< protects access to derived data
+};
+
+/// @} chrono_collision
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
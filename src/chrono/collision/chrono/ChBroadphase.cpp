@@ -39,6 +39,7 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      level_ratio(2),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -198,6 +199,16 @@ void ChBroadphase::ComputeTopLevelResolution() {
             break;
         case GridType::FIXED_DENSITY:
             bins_per_axis = Compute_Grid_Resolution(num_shapes, diag, grid_density);
+            break;
+        case GridType::MULTI_LEVEL: {
+            // The top-level grid (used for ray intersection tests) has the cell size of the coarsest level
+            ComputeGridLevels();
+            real top_size = 1 / level_inv_size.back();
+            bins_per_axis.x = std::max(1, (int)std::ceil(diag.x / top_size));
+            bins_per_axis.y = std::max(1, (int)std::ceil(diag.y / top_size));
+            bins_per_axis.z = std::max(1, (int)std::ceil(diag.z / top_size));
+            break;
+        }
     }
 
     // Calculate actual bin dimension
@@ -219,29 +230,28 @@ void ChBroadphase::Process() {
     ComputeTopLevelResolution();
 
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (grid_type == GridType::MULTI_LEVEL)
+            MultiLevelBroadphase();
+        else
+            OneLevelBroadphase();
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
     return;
 }
 
-void ChBroadphase::OneLevelBroadphase() {
+// Bin the shape AABBs in the top-level grid.
+// Return false if there are no active bins.
+bool ChBroadphase::BinShapes() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
-
-    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
-    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
 
     const std::vector<real3>& aabb_min = cd_data->aabb_min;
     const std::vector<real3>& aabb_max = cd_data->aabb_max;
-    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
     std::vector<uint>& bin_intersections = cd_data->bin_intersections;
     std::vector<uint>& bin_number = cd_data->bin_number;
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
     std::vector<uint>& bin_active = cd_data->bin_active;
     std::vector<uint>& bin_start_index = cd_data->bin_start_index;
     std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
-    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
 
@@ -250,7 +260,6 @@ void ChBroadphase::OneLevelBroadphase() {
     uint& num_bins = cd_data->num_bins;
     uint& num_active_bins = cd_data->num_active_bins;
     uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
-    uint& num_possible_collisions = cd_data->num_possible_collisions;
 
     num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
@@ -289,16 +298,63 @@ void ChBroadphase::OneLevelBroadphase() {
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
-    if (num_active_bins <= 0) {
-        num_possible_collisions = 0;
-        return;
-    }
+    if (num_active_bins <= 0)
+        return false;
 
     bin_active.resize(num_active_bins);
     bin_start_index.resize(num_active_bins + 1);
     bin_start_index[num_active_bins] = 0;
 
     Thrust_Exclusive_Scan(bin_start_index);
+
+    // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
+    // no shape AABB intersections. 
+    bin_start_index_ext.resize(num_bins + 1);
+
+#pragma omp parallel for
+    for (int j = 0; j <= (signed)bin_active[0]; j++) {
+        bin_start_index_ext[j] = bin_start_index[0];
+    }
+#pragma omp parallel for
+    for (int index = 1; index < (signed)num_active_bins; index++) {
+        // Set the extended array for the current active bin as well as any empty bins before it.
+        for (uint j = bin_active[index - 1] + 1; j <= bin_active[index]; j++)
+            bin_start_index_ext[j] = bin_start_index[index];
+    }
+#pragma omp parallel for
+    for (int j = bin_active[num_active_bins - 1] + 1; j <= (signed)num_bins; j++) {
+        bin_start_index_ext[j] = bin_start_index[num_active_bins];
+    }
+
+    return true;
+}
+
+void ChBroadphase::OneLevelBroadphase() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    const std::vector<uint>& bin_number = cd_data->bin_number;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const std::vector<uint>& bin_active = cd_data->bin_active;
+    const std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    if (!BinShapes()) {
+        num_possible_collisions = 0;
+        return;
+    }
+
     bin_num_contact.resize(num_active_bins + 1);
     bin_num_contact[num_active_bins] = 0;
 
@@ -323,25 +379,287 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 
     pair_shapeIDs.resize(num_possible_collisions);
+}
 
-    // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
-    // no shape AABB intersections. 
-    bin_start_index_ext.resize(num_bins + 1);
+// -----------------------------------------------------------------------------
+// Hierarchical grid
+//
+// Each shape is assigned to the finest level with cells at least twice as large as its AABB, so that it intersects at
+// most 8 cells of its level (and mostly a single one). Candidate pairs are found between shapes in the same cell of a level and, for each shape,
+// with the shapes in the cells of coarser levels overlapped by its AABB. Duplicate pairs are eliminated by only
+// reporting a pair in the cell (of the coarser of the two levels) containing the lower corner of the AABB overlap.
+
+// Key of a cell in the hierarchical grid (6 bits for the level, 19 bits for each cell index)
+static inline unsigned long long LevelCellKey(int level, int i, int j, int k) {
+    return ((unsigned long long)level << 57) | ((unsigned long long)i << 38) | ((unsigned long long)j << 19) |
+           (unsigned long long)k;
+}
+
+static inline unsigned long long LevelCellKey(int level, const vec3& cell) {
+    return LevelCellKey(level, cell.x, cell.y, cell.z);
+}
+
+// Candidate pair generation in the hierarchical grid.
+// If 'pairs' is not null, the pairs are also stored (as in f_Store_AABB_AABB_Intersection).
+struct LevelGridPairs {
+    const std::vector<real3>& aabb_min;
+    const std::vector<real3>& aabb_max;
+    const std::vector<short2>& fam_data;
+    const std::vector<char>& body_active;
+    const std::vector<char>& body_collide;
+    const std::vector<uint>& body_id;
+    const std::vector<int>& shape_level;
+    const std::vector<real>& level_inv_size;
+    const std::vector<char>& level_used;
+    const std::vector<unsigned long long>& cell_used;
+    const std::vector<uint>& cell_start;
+    const std::vector<uint>& cell_shape;
+    const std::vector<uint>& level_cell_start;
+
+    // Check if two shapes are a candidate pair and if the pair is reported in the specified cell of the given level.
+    bool Check(uint shapeA, uint shapeB, int level, unsigned long long cell) const {
+        uint bodyA = body_id[shapeA];
+        uint bodyB = body_id[shapeB];
+        if (bodyA == bodyB)
+            return false;
+        if (!body_active[bodyA] && !body_active[bodyB])
+            return false;
+        if (!collide(fam_data[shapeA], fam_data[shapeB]))
+            return false;
+        if (!overlap(aabb_min[shapeA], aabb_max[shapeA], aabb_min[shapeB], aabb_max[shapeB]))
+            return false;
+        real3 min_p = Max(aabb_min[shapeA], aabb_min[shapeB]);
+        return LevelCellKey(level, HashMin(min_p, real3(level_inv_size[level]))) == cell;
+    }
+
+    // Add a pair and return the updated pair count.
+    static uint Add(uint shapeA, uint shapeB, long long* pairs, uint count) {
+        if (pairs)
+            pairs[count] = ((long long)Min(shapeA, shapeB) << 32) | (long long)Max(shapeA, shapeB);
+        return count + 1;
+    }
 
+    // Pairs of shapes within the same cell (of the same level).
+    uint CellPairs(uint index, long long* pairs) const {
+        unsigned long long cell = cell_used[index];
+        int level = (int)(cell >> 57);
+        uint start = cell_start[index];
+        uint end = cell_start[index + 1];
+        uint count = 0;
+        for (uint i = start; i < end; i++) {
+            for (uint k = i + 1; k < end; k++) {
+                if (Check(cell_shape[i], cell_shape[k], level, cell))
+                    count = Add(cell_shape[i], cell_shape[k], pairs, count);
+            }
+        }
+        return count;
+    }
+
+    // Pairs of the given shape with shapes in coarser levels.
+    uint CrossLevelPairs(uint shape, long long* pairs) const {
+        int shape_lvl = shape_level[shape];
+        if (shape_lvl < 0)
+            return 0;
+        uint count = 0;
+        for (int level = shape_lvl + 1; level < (int)level_used.size(); level++) {
+            if (!level_used[level])
+                continue;
+            real3 inv_size(level_inv_size[level]);
+            vec3 gmin = HashMin(aabb_min[shape], inv_size);
+            vec3 gmax = Max(HashMax(aabb_max[shape], inv_size), gmin);
+            for (int i = gmin.x; i <= gmax.x; i++) {
+                for (int j = gmin.y; j <= gmax.y; j++) {
+                    for (int k = gmin.z; k <= gmax.z; k++) {
+                        unsigned long long cell = LevelCellKey(level, i, j, k);
+                        auto end = cell_used.begin() + level_cell_start[level + 1];
+                        auto it = std::lower_bound(cell_used.begin() + level_cell_start[level], end, cell);
+                        if (it == end || *it != cell)
+                            continue;
+                        size_t index = it - cell_used.begin();
+                        for (uint e = cell_start[index]; e < cell_start[index + 1]; e++) {
+                            if (Check(shape, cell_shape[e], level, cell))
+                                count = Add(shape, cell_shape[e], pairs, count);
+                        }
+                    }
+                }
+            }
+        }
+        return count;
+    }
+};
+
+// Assign shapes to grid levels.
+// The finest level has cells twice the size of the smallest shape AABB (limited to 2^18 cells per direction); the cell
+// size of each subsequent level increases by the specified ratio.
+void ChBroadphase::ComputeGridLevels() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    real3 diag = Abs(cd_data->max_bounding_point - cd_data->global_origin);
+    real diag_max = Max(diag.x, Max(diag.y, diag.z));
+    real ratio = level_ratio > 1 ? level_ratio : 2;
+
+    // Minimum ratio between the cell size and the AABB size of the shapes in a level.
+    // Larger cells reduce the number of shapes spanning several cells (and so the number of cell entries to sort).
+    const real cell_factor = 2;
+
+    shape_level.resize(num_shapes);
+
+    // Exclude inactive shapes and shapes on non-colliding bodies; find the smallest shape AABB.
+    real min_size = diag_max;
+    for (int i = 0; i < num_shapes; i++) {
+        uint body = obj_data_id[i];
+        if (body == UINT_MAX || obj_collide[body] == 0) {
+            shape_level[i] = -1;
+            continue;
+        }
+        real3 size = aabb_max[i] - aabb_min[i];
+        shape_level[i] = 0;
+        min_size = Min(min_size, Max(size.x, Max(size.y, size.z)));
+    }
+    real cell_size = Max(cell_factor * min_size, diag_max / (1 << 18));
+    if (cell_size <= 0)
+        cell_size = 1;
+
+    // Assign each shape to the finest level with cells at least cell_factor times as large as its AABB.
 #pragma omp parallel for
-    for (int j = 0; j <= (signed)bin_active[0]; j++) {
-        bin_start_index_ext[j] = bin_start_index[0];
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_level[i] < 0)
+            continue;
+        real3 size = aabb_max[i] - aabb_min[i];
+        real shape_size = Max(size.x, Max(size.y, size.z));
+        int level = 0;
+        real level_size = cell_size;
+        while (level_size < cell_factor * shape_size && level < 63) {
+            level_size *= ratio;
+            level++;
+        }
+        shape_level[i] = level;
     }
+
+    int num_levels = 1;
+    for (int i = 0; i < num_shapes; i++)
+        num_levels = std::max(num_levels, shape_level[i] + 1);
+
+    level_inv_size.resize(num_levels);
+    level_used.assign(num_levels, 0);
+    real level_size = cell_size;
+    for (int level = 0; level < num_levels; level++) {
+        level_inv_size[level] = 1 / level_size;
+        level_size *= ratio;
+    }
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_level[i] >= 0)
+            level_used[shape_level[i]] = 1;
+    }
+}
+
+void ChBroadphase::MultiLevelBroadphase() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    // Bin shapes in the top-level grid (used in ray intersection tests)
+    BinShapes();
+
+    // Count the number of cells of its level intersected by each shape -> shape_cells
+    shape_cells.resize(num_shapes + 1);
+    shape_cells[num_shapes] = 0;
+
 #pragma omp parallel for
-    for (int index = 1; index < (signed)num_active_bins; index++) {
-        // Set the extended array for the current active bin as well as any empty bins before it.
-        for (uint j = bin_active[index - 1] + 1; j <= bin_active[index]; j++)
-            bin_start_index_ext[j] = bin_start_index[index];
+    for (int i = 0; i < num_shapes; i++) {
+        int level = shape_level[i];
+        if (level < 0) {
+            shape_cells[i] = 0;
+            continue;
+        }
+        real3 inv_size(level_inv_size[level]);
+        vec3 gmin = HashMin(aabb_min[i], inv_size);
+        vec3 gmax = Max(HashMax(aabb_max[i], inv_size), gmin);
+        shape_cells[i] = (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
     }
+
+    Thrust_Exclusive_Scan(shape_cells);
+    uint num_entries = shape_cells.back();
+
+    cell_key.resize(num_entries);
+    cell_shape.resize(num_entries);
+
+    // For each shape, store the cell keys and the shape ID
 #pragma omp parallel for
-    for (int j = bin_active[num_active_bins - 1] + 1; j <= (signed)num_bins; j++) {
-        bin_start_index_ext[j] = bin_start_index[num_active_bins];
+    for (int i = 0; i < num_shapes; i++) {
+        int level = shape_level[i];
+        if (level < 0)
+            continue;
+        real3 inv_size(level_inv_size[level]);
+        vec3 gmin = HashMin(aabb_min[i], inv_size);
+        vec3 gmax = Max(HashMax(aabb_max[i], inv_size), gmin);
+        uint index = shape_cells[i];
+        for (int a = gmin.x; a <= gmax.x; a++) {
+            for (int b = gmin.y; b <= gmax.y; b++) {
+                for (int c = gmin.z; c <= gmax.z; c++) {
+                    cell_key[index] = LevelCellKey(level, a, b, c);
+                    cell_shape[index] = i;
+                    index++;
+                }
+            }
+        }
     }
+
+    // Find the non-empty cells (over all levels) and the start of each cell in the sorted entries
+    Thrust_Sort_By_Key(cell_key, cell_shape);
+    cell_used.resize(num_entries);
+    cell_start.resize(num_entries);
+    uint num_cells = (uint)(Run_Length_Encode(cell_key, cell_used, cell_start));
+
+    cell_used.resize(num_cells);
+    cell_start.resize(num_cells + 1);
+    cell_start[num_cells] = 0;
+    Thrust_Exclusive_Scan(cell_start);
+
+    // Range of each level in the list of non-empty cells
+    int num_levels = (int)level_used.size();
+    level_cell_start.resize(num_levels + 1);
+    for (int level = 0; level <= num_levels; level++) {
+        auto first = level < num_levels ? LevelCellKey(level, 0, 0, 0) : ULLONG_MAX;
+        level_cell_start[level] = (uint)(std::lower_bound(cell_used.begin(), cell_used.end(), first) - cell_used.begin());
+    }
+    level_cell_start[num_levels] = num_cells;
+
+    LevelGridPairs grid{aabb_min,         aabb_max,   cd_data->shape_data.fam_rigid, *cd_data->state_data.active_rigid,
+                        *cd_data->state_data.collide_rigid, cd_data->shape_data.id_rigid, shape_level,
+                        level_inv_size,   level_used, cell_used,  cell_start, cell_shape, level_cell_start};
+
+    // Count the candidate pairs in each non-empty cell and across levels for each shape -> level_pair_count
+    level_pair_count.resize(num_cells + num_shapes + 1);
+    level_pair_count[num_cells + num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_cells; i++)
+        level_pair_count[i] = grid.CellPairs(i, nullptr);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++)
+        level_pair_count[num_cells + i] = grid.CrossLevelPairs(i, nullptr);
+
+    Thrust_Exclusive_Scan(level_pair_count);
+    num_possible_collisions = level_pair_count.back();
+    pair_shapeIDs.resize(num_possible_collisions);
+
+    // Store the list of shape pairs in potential collision
+    long long* pairs = pair_shapeIDs.data();
+#pragma omp parallel for
+    for (int i = 0; i < (signed)num_cells; i++)
+        grid.CellPairs(i, pairs + level_pair_count[i]);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++)
+        grid.CrossLevelPairs(i, pairs + level_pair_count[num_cells + i]);
 }
 
 }  // end namespace collision
@@ -28,13 +28,16 @@ namespace collision {
 /// @{
 
 /// Class for performing broad-phase collision detection.
+/// By default, all shapes are binned in a single uniform grid. For scenes with shapes of very different sizes, a
+/// hierarchical grid (GridType::MULTI_LEVEL) places each shape in the grid level with cells matching its size.
 class ChApi ChBroadphase {
   public:
     /// Method for computing grid resolution
     enum class GridType {
         FIXED_RESOLUTION,  ///< user-specified number of bins in each direction
         FIXED_BIN_SIZE,    ///< user-specified grid bin dimension
-        FIXED_DENSITY      ///< user-specified density of shapes per bin
+        FIXED_DENSITY,     ///< user-specified density of shapes per bin
+        MULTI_LEVEL        ///< hierarchical grid, with cell sizes increasing by a user-specified ratio between levels
     };
 
     ChBroadphase();
@@ -45,6 +48,9 @@ class ChApi ChBroadphase {
 
   private:
     void OneLevelBroadphase();
+    bool BinShapes();
+    void MultiLevelBroadphase();
+    void ComputeGridLevels();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -57,6 +63,19 @@ class ChApi ChBroadphase {
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    real level_ratio;      ///< (input) ratio of cell sizes of consecutive levels (used for GridType::MULTI_LEVEL)
+
+    // Hierarchical grid data (GridType::MULTI_LEVEL)
+    std::vector<int> shape_level;               ///< [num_rigid_shapes] grid level of each shape (-1 if excluded)
+    std::vector<real> level_inv_size;           ///< [num_levels] reciprocal cell size of each level
+    std::vector<char> level_used;               ///< [num_levels] true if at least one shape is in this level
+    std::vector<uint> shape_cells;              ///< [num_rigid_shapes+1] offset of each shape in the cell entries
+    std::vector<unsigned long long> cell_key;   ///< [num_cell_entries] level and cell key of each cell entry
+    std::vector<uint> cell_shape;               ///< [num_cell_entries] shape ID of each cell entry
+    std::vector<unsigned long long> cell_used;  ///< [num_used_cells] key of each non-empty cell (sorted)
+    std::vector<uint> cell_start;               ///< [num_used_cells+1] start of each non-empty cell in the entries
+    std::vector<uint> level_cell_start;         ///< [num_levels+1] start of each level in the non-empty cells
+    std::vector<uint> level_pair_count;         ///< [num_used_cells+num_rigid_shapes+1] candidate pair offsets
 
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
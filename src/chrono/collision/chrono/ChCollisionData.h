@@ -68,6 +68,8 @@ struct state_container {
           rot_rigid(nullptr),
           active_rigid(nullptr),
           collide_rigid(nullptr),
+          lin_vel_rigid(nullptr),
+          ang_vel_rigid(nullptr),
           pos_3dof(nullptr),
           sorted_pos_3dof(nullptr) {}
 
@@ -80,6 +82,8 @@ struct state_container {
     std::vector<quaternion>* rot_rigid;  ///< [num_rigid_bodies] rigid body rotations
     std::vector<char>* active_rigid;     ///< [num_rigid_bodies] flags indicating rigid bodies that active
     std::vector<char>* collide_rigid;    ///< [num_rigid_bodies] flags indicating bodies that participate in collision
+    std::vector<real3>* lin_vel_rigid;   ///< [num_rigid_bodies] rigid body linear velocities (speculative contacts)
+    std::vector<real3>* ang_vel_rigid;   ///< [num_rigid_bodies] rigid body angular velocities (speculative contacts)
 
     // Information for 3dof nodes
     std::vector<real3>* pos_3dof;         ///< [num_fluid_bodies] 3-dof particle positions
@@ -93,6 +97,7 @@ class ChApi ChCollisionData {
         : owns_state_data(owns_data),
           //
           collision_envelope(0),
+          speculative_step(0),
           //
           p_collision_envelope(0),
           p_kernel_radius(real(0.04)),
@@ -125,6 +130,8 @@ class ChApi ChCollisionData {
             state_data.rot_rigid = new std::vector<quaternion>;
             state_data.active_rigid = new std::vector<char>;
             state_data.collide_rigid = new std::vector<char>;
+            state_data.lin_vel_rigid = new std::vector<real3>;
+            state_data.ang_vel_rigid = new std::vector<real3>;
 
             state_data.pos_3dof = new std::vector<real3>;
             state_data.sorted_pos_3dof = new std::vector<real3>;
@@ -137,6 +144,8 @@ class ChApi ChCollisionData {
             delete state_data.rot_rigid;
             delete state_data.active_rigid;
             delete state_data.collide_rigid;
+            delete state_data.lin_vel_rigid;
+            delete state_data.ang_vel_rigid;
 
             delete state_data.pos_3dof;
             delete state_data.sorted_pos_3dof;
@@ -149,6 +158,7 @@ class ChApi ChCollisionData {
     shape_container shape_data;  ///< shape information data arrays
 
     real collision_envelope;  ///< collision envelope for rigid shapes
+    real speculative_step;    ///< step size for speculative contacts (0 if disabled)
 
     real p_collision_envelope;  ///< collision envelope for 3-dof particles
     real p_kernel_radius;       ///< 3-dof particle radius
@@ -159,6 +169,7 @@ class ChApi ChCollisionData {
 
     std::vector<real3> aabb_min;  ///< list of bounding boxes minimum point
     std::vector<real3> aabb_max;  ///< list of bounding boxes maximum point
+    std::vector<real> aabb_spec;  ///< speculative margin of each shape (empty if speculative contacts disabled)
 
     std::vector<long long> pair_shapeIDs;     ///< shape IDs for each shape pair (encoded in a single long long)
     std::vector<long long> contact_shapeIDs;  ///< shape IDs for each contact (encoded in a single long long)
@@ -231,6 +231,11 @@ void ChNarrowphase::Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC)
     }
 }
 
+real ChNarrowphase::SpeculativeMargin(int indexA, int indexB) const {
+    const std::vector<real>& aabb_spec = cd_data->aabb_spec;
+    return aabb_spec.empty() ? 0 : aabb_spec[indexA] + aabb_spec[indexB];
+}
+
 void ChNarrowphase::DispatchMPR() {
     const real envelope = cd_data->collision_envelope;
     std::vector<real3>& norm = cd_data->norm_rigid_rigid;
@@ -250,7 +255,10 @@ void ChNarrowphase::DispatchMPR() {
 
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
-        if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        real margin = SpeculativeMargin(shapeA.index, shapeB.index);
+
+        if (MPRCollision(&shapeA, &shapeB, envelope + margin / 2, norm[icoll], ptA[icoll], ptB[icoll],
+                         contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             // The number of contacts reported by MPR is always 1.
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
@@ -269,16 +277,25 @@ void ChNarrowphase::DispatchPRIMS() {
     ConvexShape shapeA;
     ConvexShape shapeB;
 
+    // Process the pairs supported by the batched kernels
+    DispatchBatches();
+    const char* batch_type = pair_batch_type.data();
+
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
+        if (batch_type[index] != (char)BatchType::NONE)
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
-                           &effective_radius[icoll], nC)) {
+        real margin = SpeculativeMargin(shapeA.index, shapeB.index);
+
+        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope + margin, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                           &contactDepth[icoll], &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
         }
     }
@@ -297,18 +314,28 @@ void ChNarrowphase::DispatchHybridMPR() {
 
     double default_eff_radius = ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
 
+    // Process the pairs supported by the batched kernels
+    DispatchBatches();
+    const char* batch_type = pair_batch_type.data();
+
 #pragma omp parallel for private(shapeA, shapeB)
     for (int index = 0; index < (signed)num_potential_rigid_contacts; index++) {
         uint ID_A, ID_B, icoll;
 
         int nC;
 
+        if (batch_type[index] != (char)BatchType::NONE)
+            continue;
+
         Dispatch_Init(index, icoll, ID_A, ID_B, &shapeA, &shapeB);
 
-        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope, &norm[icoll], &ptA[icoll], &ptB[icoll], &contactDepth[icoll],
-                           &effective_radius[icoll], nC)) {
+        real margin = SpeculativeMargin(shapeA.index, shapeB.index);
+
+        if (PRIMSCollision(&shapeA, &shapeB, 2 * envelope + margin, &norm[icoll], &ptA[icoll], &ptB[icoll],
+                           &contactDepth[icoll], &effective_radius[icoll], nC)) {
             Dispatch_Finalize(icoll, ID_A, ID_B, nC);
-        } else if (MPRCollision(&shapeA, &shapeB, envelope, norm[icoll], ptA[icoll], ptB[icoll], contactDepth[icoll])) {
+        } else if (MPRCollision(&shapeA, &shapeB, envelope + margin / 2, norm[icoll], ptA[icoll], ptB[icoll],
+                                contactDepth[icoll])) {
             effective_radius[icoll] = default_eff_radius;
             Dispatch_Finalize(icoll, ID_A, ID_B, 1);
         }
@@ -44,6 +44,9 @@ namespace collision {
 /// rcyl     |                                              N        N
 /// trimesh  |                                                       N
 /// </pre>
+///
+/// With the PRIMS and HYBRID algorithms, candidate pairs between a sphere and a sphere, box, capsule, or triangle are
+/// binned by pair type and processed in batches, using structure-of-arrays kernels which the compiler can vectorize.
 class ChApi ChNarrowphase {
   public:
     /// Narrowphase algorithm
@@ -103,6 +106,44 @@ class ChApi ChNarrowphase {
                                int& nC                    ///< [output] number of contacts found
     );
 
+    /// Types of candidate pairs processed in batches. The second shape in each batch pair is always a sphere.
+    enum class BatchType { SPHERE_SPHERE, BOX_SPHERE, CAPSULE_SPHERE, TRIANGLE_SPHERE, NONE };
+
+    /// Structure-of-arrays data for a batch of candidate pairs of the same type.
+    /// The first shape in a pair is described by a position (p), a rotation (q), and dimensions (d):
+    ///   - sphere:   d.x = radius
+    ///   - box:      d = half-dimensions
+    ///   - capsule:  d.x = radius, d.y = half-length
+    ///   - triangle: vertices p, b, and c (q and d are not used)
+    /// The second shape is a sphere with center s and radius r.
+    /// The outputs have the same meaning as for PRIMSCollision, with 'active' set for the pairs in contact.
+    struct ChApi PairBatch {
+        /// Resize all arrays to hold the specified number of pairs.
+        /// The triangle vertex arrays are only allocated for batches of type TRIANGLE_SPHERE.
+        void Resize(BatchType type, size_t n);
+
+        /// Return the number of pairs in this batch.
+        size_t Size() const { return r.size(); }
+
+        std::vector<real> px, py, pz;
+        std::vector<real> qw, qx, qy, qz;
+        std::vector<real> dx, dy, dz;
+        std::vector<real> bx, by, bz;
+        std::vector<real> cx, cy, cz;
+        std::vector<real> sx, sy, sz, r;
+
+        std::vector<real> nx, ny, nz;
+        std::vector<real> p1x, p1y, p1z;
+        std::vector<real> p2x, p2y, p2z;
+        std::vector<real> depth;
+        std::vector<real> eff_rad;
+        std::vector<char> active;
+    };
+
+    /// Analytic collision detection for the pairs [start, end) of a batch of the given type.
+    /// Results are identical (up to roundoff) with those produced by PRIMSCollision for the same pairs.
+    static void ProcessBatch(BatchType type, real separation, PairBatch& batch, size_t start, size_t end);
+
     /// Set the fictitious radius of curvature used for collision with a corner or an edge.
     static void SetDefaultEdgeRadius(real radius);
 
@@ -136,6 +177,14 @@ class ChApi ChNarrowphase {
     void Dispatch_Init(uint index, uint& icoll, uint& ID_A, uint& ID_B, ConvexShape* shapeA, ConvexShape* shapeB);
     void Dispatch_Finalize(uint icoll, uint ID_A, uint ID_B, int nC);
 
+    /// Return the speculative margin of the given pair of shapes (0 if speculative contacts are disabled).
+    /// This is the maximum distance by which the two shapes can approach each other during the current step.
+    real SpeculativeMargin(int indexA, int indexB) const;
+
+    /// Bin the candidate pairs supported by the batched kernels and process them.
+    /// On return, pair_batch_type is set to BatchType::NONE for all pairs left for the per-pair dispatch.
+    void DispatchBatches();
+
     std::shared_ptr<ChCollisionData> cd_data;
 
     std::vector<char> contact_rigid_active;
@@ -143,6 +192,11 @@ class ChApi ChNarrowphase {
     std::vector<char> contact_fluid_active;
     std::vector<uint> contact_index;
 
+    std::vector<char> pair_batch_type;  ///< batch type of each candidate pair
+    std::vector<char> pair_batch_flip;  ///< 1 if the sphere is the first shape of the candidate pair
+    std::vector<uint> batch_pairs[(int)BatchType::NONE];  ///< candidate pairs in each batch
+    PairBatch batches[(int)BatchType::NONE];              ///< structure-of-arrays data for each batch
+
     uint num_potential_rigid_contacts;
     uint num_potential_fluid_contacts;
     uint num_potential_rigid_fluid_contacts;
@@ -0,0 +1,607 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Batched narrowphase collision detection between spheres and primitive shapes.
+//
+// Candidate pairs are binned by pair type. For each bin, the shape data is
+// gathered in structure-of-arrays form and processed with simple loops (the
+// same algorithms as in ChNarrowphasePRIMS.cpp) which the compiler can
+// vectorize. The results are then scattered to the contact slots reserved for
+// each pair in ChNarrowphase::PreprocessCount.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/collision/chrono/ChNarrowphase.h"
+#include "chrono/collision/chrono/ChConvexShape.h"
+
+namespace chrono {
+namespace collision {
+
+#if defined(_OPENMP) && _OPENMP >= 201307
+    #define CH_PRAGMA_SIMD _Pragma("omp simd")
+#else
+    #define CH_PRAGMA_SIMD
+#endif
+
+// Number of pairs processed by a thread in one chunk
+static const int batch_chunk = 256;
+
+void ChNarrowphase::PairBatch::Resize(BatchType type, size_t n) {
+    for (auto v : {&px, &py, &pz, &dx, &sx, &sy, &sz, &r, &nx, &ny, &nz, &p1x, &p1y, &p1z, &p2x, &p2y, &p2z, &depth,
+                   &eff_rad})
+        v->resize(n);
+    active.resize(n);
+
+    bool rotation = (type == BatchType::BOX_SPHERE || type == BatchType::CAPSULE_SPHERE);
+    for (auto v : {&qw, &qx, &qy, &qz, &dy})
+        v->resize(rotation ? n : 0);
+    for (auto v : {&dz})
+        v->resize(type == BatchType::BOX_SPHERE ? n : 0);
+    for (auto v : {&bx, &by, &bz, &cx, &cy, &cz})
+        v->resize(type == BatchType::TRIANGLE_SPHERE ? n : 0);
+}
+
+// -----------------------------------------------------------------------------
+// Batch kernels.
+// All quantities are evaluated for every pair and selected with conditional
+// expressions (which the compiler turns into masked operations). Pairs without
+// contact may produce meaningless values; these are discarded through 'active'.
+// -----------------------------------------------------------------------------
+
+// Sphere-sphere (see sphere_sphere)
+static void batch_sphere_sphere(real separation, ChNarrowphase::PairBatch& b, int start, int end) {
+    const real* px = b.px.data();
+    const real* py = b.py.data();
+    const real* pz = b.pz.data();
+    const real* rad1 = b.dx.data();
+    const real* sx = b.sx.data();
+    const real* sy = b.sy.data();
+    const real* sz = b.sz.data();
+    const real* rad2 = b.r.data();
+    real* nx = b.nx.data();
+    real* ny = b.ny.data();
+    real* nz = b.nz.data();
+    real* p1x = b.p1x.data();
+    real* p1y = b.p1y.data();
+    real* p1z = b.p1z.data();
+    real* p2x = b.p2x.data();
+    real* p2y = b.p2y.data();
+    real* p2z = b.p2z.data();
+    real* depth = b.depth.data();
+    real* eff_rad = b.eff_rad.data();
+    char* active = b.active.data();
+
+    CH_PRAGMA_SIMD
+    for (int i = start; i < end; i++) {
+        real dx = sx[i] - px[i];
+        real dy = sy[i] - py[i];
+        real dz = sz[i] - pz[i];
+        real dist2 = dx * dx + dy * dy + dz * dz;
+        real radSum = rad1[i] + rad2[i];
+        real radSum_s = radSum + separation;
+
+        active[i] = (dist2 < radSum_s * radSum_s) & (dist2 >= 1e-12);
+
+        real dist = std::sqrt(dist2 > 1e-12 ? dist2 : real(1e-12));
+        real ux = dx / dist;
+        real uy = dy / dist;
+        real uz = dz / dist;
+        nx[i] = ux;
+        ny[i] = uy;
+        nz[i] = uz;
+        p1x[i] = px[i] + ux * rad1[i];
+        p1y[i] = py[i] + uy * rad1[i];
+        p1z[i] = pz[i] + uz * rad1[i];
+        p2x[i] = sx[i] - ux * rad2[i];
+        p2y[i] = sy[i] - uy * rad2[i];
+        p2z[i] = sz[i] - uz * rad2[i];
+        depth[i] = dist - radSum;
+        eff_rad[i] = rad1[i] * rad2[i] / radSum;
+    }
+}
+
+// Box-sphere (see box_sphere)
+static void batch_box_sphere(real separation, real edge_radius, ChNarrowphase::PairBatch& b, int start, int end) {
+    const real* px = b.px.data();
+    const real* py = b.py.data();
+    const real* pz = b.pz.data();
+    const real* qw = b.qw.data();
+    const real* qx = b.qx.data();
+    const real* qy = b.qy.data();
+    const real* qz = b.qz.data();
+    const real* hx = b.dx.data();
+    const real* hy = b.dy.data();
+    const real* hz = b.dz.data();
+    const real* sx = b.sx.data();
+    const real* sy = b.sy.data();
+    const real* sz = b.sz.data();
+    const real* rad2 = b.r.data();
+    real* nx = b.nx.data();
+    real* ny = b.ny.data();
+    real* nz = b.nz.data();
+    real* p1x = b.p1x.data();
+    real* p1y = b.p1y.data();
+    real* p1z = b.p1z.data();
+    real* p2x = b.p2x.data();
+    real* p2y = b.p2y.data();
+    real* p2z = b.p2z.data();
+    real* depth = b.depth.data();
+    real* eff_rad = b.eff_rad.data();
+    char* active = b.active.data();
+
+    CH_PRAGMA_SIMD
+    for (int i = start; i < end; i++) {
+        // Express the sphere position in the frame of the box: v' = v + w t + q x t, with t = 2 q x v and q = -q.xyz
+        real vx = sx[i] - px[i];
+        real vy = sy[i] - py[i];
+        real vz = sz[i] - pz[i];
+        real tx = -2 * (qy[i] * vz - qz[i] * vy);
+        real ty = -2 * (qz[i] * vx - qx[i] * vz);
+        real tz = -2 * (qx[i] * vy - qy[i] * vx);
+        real lx = vx + qw[i] * tx - (qy[i] * tz - qz[i] * ty);
+        real ly = vy + qw[i] * ty - (qz[i] * tx - qx[i] * tz);
+        real lz = vz + qw[i] * tz - (qx[i] * ty - qy[i] * tx);
+
+        // Snap the sphere position to the surface of the box
+        bool cx = std::abs(lx) > hx[i];
+        bool cy = std::abs(ly) > hy[i];
+        bool cz = std::abs(lz) > hz[i];
+        real bx = cx ? (lx > 0 ? hx[i] : -hx[i]) : lx;
+        real by = cy ? (ly > 0 ? hy[i] : -hy[i]) : ly;
+        real bz = cz ? (lz > 0 ? hz[i] : -hz[i]) : lz;
+
+        real dx = lx - bx;
+        real dy = ly - by;
+        real dz = lz - bz;
+        real dist2 = dx * dx + dy * dy + dz * dz;
+        real radius2_s = rad2[i] + separation;
+
+        active[i] = (dist2 < radius2_s * radius2_s) & (dist2 > real(1e-12f));
+
+        real dist = std::sqrt(dist2 > real(1e-12f) ? dist2 : real(1e-12f));
+        dx /= dist;
+        dy /= dist;
+        dz /= dist;
+
+        // Normal and contact point on the box, rotated back to the global frame
+        tx = 2 * (qy[i] * dz - qz[i] * dy);
+        ty = 2 * (qz[i] * dx - qx[i] * dz);
+        tz = 2 * (qx[i] * dy - qy[i] * dx);
+        real ux = dx + qw[i] * tx + (qy[i] * tz - qz[i] * ty);
+        real uy = dy + qw[i] * ty + (qz[i] * tx - qx[i] * tz);
+        real uz = dz + qw[i] * tz + (qx[i] * ty - qy[i] * tx);
+
+        tx = 2 * (qy[i] * bz - qz[i] * by);
+        ty = 2 * (qz[i] * bx - qx[i] * bz);
+        tz = 2 * (qx[i] * by - qy[i] * bx);
+
+        nx[i] = ux;
+        ny[i] = uy;
+        nz[i] = uz;
+        p1x[i] = px[i] + bx + qw[i] * tx + (qy[i] * tz - qz[i] * ty);
+        p1y[i] = py[i] + by + qw[i] * ty + (qz[i] * tx - qx[i] * tz);
+        p1z[i] = pz[i] + bz + qw[i] * tz + (qx[i] * ty - qy[i] * tx);
+        p2x[i] = sx[i] - ux * rad2[i];
+        p2y[i] = sy[i] - uy * rad2[i];
+        p2z[i] = sz[i] - uz * rad2[i];
+        depth[i] = dist - rad2[i];
+
+        // Contact with a face if exactly one coordinate was snapped
+        bool face = (cx + cy + cz) == 1;
+        eff_rad[i] = face ? rad2[i] : rad2[i] * edge_radius / (rad2[i] + edge_radius);
+    }
+}
+
+// Capsule-sphere (see capsule_sphere)
+static void batch_capsule_sphere(real separation, ChNarrowphase::PairBatch& b, int start, int end) {
+    const real* px = b.px.data();
+    const real* py = b.py.data();
+    const real* pz = b.pz.data();
+    const real* qw = b.qw.data();
+    const real* qx = b.qx.data();
+    const real* qy = b.qy.data();
+    const real* qz = b.qz.data();
+    const real* rad1 = b.dx.data();
+    const real* hlen1 = b.dy.data();
+    const real* sx = b.sx.data();
+    const real* sy = b.sy.data();
+    const real* sz = b.sz.data();
+    const real* rad2 = b.r.data();
+    real* nx = b.nx.data();
+    real* ny = b.ny.data();
+    real* nz = b.nz.data();
+    real* p1x = b.p1x.data();
+    real* p1y = b.p1y.data();
+    real* p1z = b.p1z.data();
+    real* p2x = b.p2x.data();
+    real* p2y = b.p2y.data();
+    real* p2z = b.p2z.data();
+    real* depth = b.depth.data();
+    real* eff_rad = b.eff_rad.data();
+    char* active = b.active.data();
+
+    CH_PRAGMA_SIMD
+    for (int i = start; i < end; i++) {
+        // Capsule axis (Y direction of the capsule frame) in the global frame
+        real Vx = (qx[i] * qy[i] - qw[i] * qz[i]) * 2;
+        real Vy = (qw[i] * qw[i] + qy[i] * qy[i]) * 2 - 1;
+        real Vz = (qy[i] * qz[i] + qw[i] * qx[i]) * 2;
+
+        // Project the sphere center onto the capsule centerline and clamp to the capsule length
+        real alpha = (sx[i] - px[i]) * Vx + (sy[i] - py[i]) * Vy + (sz[i] - pz[i]) * Vz;
+        alpha = alpha < -hlen1[i] ? -hlen1[i] : (alpha > hlen1[i] ? hlen1[i] : alpha);
+
+        real lx = px[i] + alpha * Vx;
+        real ly = py[i] + alpha * Vy;
+        real lz = pz[i] + alpha * Vz;
+
+        real radSum = rad1[i] + rad2[i];
+        real radSum_s = radSum + separation;
+        real dx = sx[i] - lx;
+        real dy = sy[i] - ly;
+        real dz = sz[i] - lz;
+        real dist2 = dx * dx + dy * dy + dz * dz;
+
+        active[i] = (dist2 < radSum_s * radSum_s) & (dist2 > real(1e-12f));
+
+        real dist = std::sqrt(dist2 > real(1e-12f) ? dist2 : real(1e-12f));
+        real ux = dx / dist;
+        real uy = dy / dist;
+        real uz = dz / dist;
+        nx[i] = ux;
+        ny[i] = uy;
+        nz[i] = uz;
+        p1x[i] = lx + ux * rad1[i];
+        p1y[i] = ly + uy * rad1[i];
+        p1z[i] = lz + uz * rad1[i];
+        p2x[i] = sx[i] - ux * rad2[i];
+        p2y[i] = sy[i] - uy * rad2[i];
+        p2z[i] = sz[i] - uz * rad2[i];
+        depth[i] = dist - radSum;
+        eff_rad[i] = rad1[i] * rad2[i] / radSum;
+    }
+}
+
+// Triangle-sphere (see triangle_sphere and snap_to_triangle)
+static void batch_triangle_sphere(real separation, real edge_radius, ChNarrowphase::PairBatch& b, int start, int end) {
+    const real* ax = b.px.data();
+    const real* ay = b.py.data();
+    const real* az = b.pz.data();
+    const real* bx = b.bx.data();
+    const real* by = b.by.data();
+    const real* bz = b.bz.data();
+    const real* cx = b.cx.data();
+    const real* cy = b.cy.data();
+    const real* cz = b.cz.data();
+    const real* sx = b.sx.data();
+    const real* sy = b.sy.data();
+    const real* sz = b.sz.data();
+    const real* rad2 = b.r.data();
+    real* nx = b.nx.data();
+    real* ny = b.ny.data();
+    real* nz = b.nz.data();
+    real* p1x = b.p1x.data();
+    real* p1y = b.p1y.data();
+    real* p1z = b.p1z.data();
+    real* p2x = b.p2x.data();
+    real* p2y = b.p2y.data();
+    real* p2z = b.p2z.data();
+    real* depth = b.depth.data();
+    real* eff_rad = b.eff_rad.data();
+    char* active = b.active.data();
+
+    CH_PRAGMA_SIMD
+    for (int i = start; i < end; i++) {
+        real radius2_s = rad2[i] + separation;
+
+        // Face normal
+        real ABx = bx[i] - ax[i];
+        real ABy = by[i] - ay[i];
+        real ABz = bz[i] - az[i];
+        real ACx = cx[i] - ax[i];
+        real ACy = cy[i] - ay[i];
+        real ACz = cz[i] - az[i];
+        real fnx = ABy * ACz - ABz * ACy;
+        real fny = ABz * ACx - ABx * ACz;
+        real fnz = ABx * ACy - ABy * ACx;
+        real len = std::sqrt(fnx * fnx + fny * fny + fnz * fnz);
+        fnx /= len;
+        fny /= len;
+        fnz /= len;
+
+        // Signed height of the sphere center above the face plane
+        real APx = sx[i] - ax[i];
+        real APy = sy[i] - ay[i];
+        real APz = sz[i] - az[i];
+        real h = APx * fnx + APy * fny + APz * fnz;
+        bool above = (h < radius2_s) & (h > 0);
+
+        // Closest point on the face (Voronoi regions tested in the same order as snap_to_triangle)
+        real d1 = ABx * APx + ABy * APy + ABz * APz;
+        real d2 = ACx * APx + ACy * APy + ACz * APz;
+        real BPx = sx[i] - bx[i];
+        real BPy = sy[i] - by[i];
+        real BPz = sz[i] - bz[i];
+        real d3 = ABx * BPx + ABy * BPy + ABz * BPz;
+        real d4 = ACx * BPx + ACy * BPy + ACz * BPz;
+        real CPx = sx[i] - cx[i];
+        real CPy = sy[i] - cy[i];
+        real CPz = sz[i] - cz[i];
+        real d5 = ABx * CPx + ABy * CPy + ABz * CPz;
+        real d6 = ACx * CPx + ACy * CPy + ACz * CPz;
+        real vc = d1 * d4 - d3 * d2;
+        real vb = d5 * d2 - d1 * d6;
+        real va = d3 * d6 - d5 * d4;
+
+        bool inA = (d1 <= 0) & (d2 <= 0);
+        bool inB = (d3 >= 0) & (d4 <= d3);
+        bool inAB = (vc <= 0) & (d1 >= 0) & (d3 <= 0);
+        bool inC = (d6 >= 0) & (d5 <= d6);
+        bool inAC = (vb <= 0) & (d2 >= 0) & (d6 <= 0);
+        bool inBC = (va <= 0) & ((d4 - d3) >= 0) & ((d5 - d6) >= 0);
+
+        real den_ab = d1 - d3;
+        real den_ac = d2 - d6;
+        real den_bc = (d4 - d3) + (d5 - d6);
+        real den_f = va + vb + vc;
+        real v_ab = d1 / (den_ab != 0 ? den_ab : 1);
+        real w_ac = d2 / (den_ac != 0 ? den_ac : 1);
+        real w_bc = (d4 - d3) / (den_bc != 0 ? den_bc : 1);
+        real inv_f = 1 / (den_f != 0 ? den_f : 1);
+
+        // Barycentric coordinates (v, w) of the closest point, i.e. A + v * AB + w * AC
+        real v = inA ? 0 : inB ? 1 : inAB ? v_ab : inC ? 0 : inAC ? 0 : inBC ? 1 - w_bc : vb * inv_f;
+        real w = inA ? 0 : inB ? 0 : inAB ? 0 : inC ? 1 : inAC ? w_ac : inBC ? w_bc : vc * inv_f;
+        bool edge = inA | inB | inAB | inC | inAC | inBC;
+
+        // Use the exact vertex and edge expressions of snap_to_triangle
+        bool onBC = !inA & !inB & !inAB & !inC & !inAC & inBC;
+        real fx = ax[i] + v * ABx + w * ACx;
+        real fy = ay[i] + v * ABy + w * ACy;
+        real fz = az[i] + v * ABz + w * ACz;
+        fx = inA ? ax[i] : inB ? bx[i] : inC ? cx[i] : onBC ? bx[i] + w * (cx[i] - bx[i]) : fx;
+        fy = inA ? ay[i] : inB ? by[i] : inC ? cy[i] : onBC ? by[i] + w * (cy[i] - by[i]) : fy;
+        fz = inA ? az[i] : inB ? bz[i] : inC ? cz[i] : onBC ? bz[i] + w * (cz[i] - bz[i]) : fz;
+
+        // Edge contact: direction from the closest point; face contact: along the face normal
+        real dx = sx[i] - fx;
+        real dy = sy[i] - fy;
+        real dz = sz[i] - fz;
+        real dist2 = dx * dx + dy * dy + dz * dz;
+        bool edge_ok = (dist2 < radius2_s * radius2_s) & (dist2 > real(1e-12f));
+        real dist = std::sqrt(dist2 > real(1e-12f) ? dist2 : real(1e-12f));
+
+        real ux = edge ? dx / dist : fnx;
+        real uy = edge ? dy / dist : fny;
+        real uz = edge ? dz / dist : fnz;
+
+        active[i] = above & (!edge | edge_ok);
+        nx[i] = ux;
+        ny[i] = uy;
+        nz[i] = uz;
+        depth[i] = edge ? dist - rad2[i] : h - rad2[i];
+        eff_rad[i] = edge ? rad2[i] * edge_radius / (rad2[i] + edge_radius) : rad2[i];
+        p1x[i] = fx;
+        p1y[i] = fy;
+        p1z[i] = fz;
+        p2x[i] = sx[i] - ux * rad2[i];
+        p2y[i] = sy[i] - uy * rad2[i];
+        p2z[i] = sz[i] - uz * rad2[i];
+    }
+}
+
+void ChNarrowphase::ProcessBatch(BatchType type, real separation, PairBatch& batch, size_t start, size_t end) {
+    real edge_radius = GetDefaultEdgeRadius();
+    switch (type) {
+        case BatchType::SPHERE_SPHERE:
+            batch_sphere_sphere(separation, batch, (int)start, (int)end);
+            break;
+        case BatchType::BOX_SPHERE:
+            batch_box_sphere(separation, edge_radius, batch, (int)start, (int)end);
+            break;
+        case BatchType::CAPSULE_SPHERE:
+            batch_capsule_sphere(separation, batch, (int)start, (int)end);
+            break;
+        case BatchType::TRIANGLE_SPHERE:
+            batch_triangle_sphere(separation, edge_radius, batch, (int)start, (int)end);
+            break;
+        default:
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+// Batch type of a candidate pair with given shape types, and whether the sphere is the first shape.
+static ChNarrowphase::BatchType GetBatchType(int typeA, int typeB, bool& flip) {
+    flip = false;
+    if (typeA != ChCollisionShape::Type::SPHERE && typeB != ChCollisionShape::Type::SPHERE)
+        return ChNarrowphase::BatchType::NONE;
+
+    int other = typeA;
+    if (typeA == ChCollisionShape::Type::SPHERE && typeB != ChCollisionShape::Type::SPHERE) {
+        other = typeB;
+        flip = true;
+    }
+
+    switch (other) {
+        case ChCollisionShape::Type::SPHERE:
+            return ChNarrowphase::BatchType::SPHERE_SPHERE;
+        case ChCollisionShape::Type::BOX:
+            return ChNarrowphase::BatchType::BOX_SPHERE;
+        case ChCollisionShape::Type::CAPSULE:
+            return ChNarrowphase::BatchType::CAPSULE_SPHERE;
+        case ChCollisionShape::Type::TRIANGLE:
+            return ChNarrowphase::BatchType::TRIANGLE_SPHERE;
+        default:
+            flip = false;
+            return ChNarrowphase::BatchType::NONE;
+    }
+}
+
+void ChNarrowphase::DispatchBatches() {
+    const std::vector<real>& aabb_spec = cd_data->aabb_spec;
+    const int num_pairs = (signed)num_potential_rigid_contacts;
+    const std::vector<shape_type>& obj_data_T = cd_data->shape_data.typ_rigid;
+    const std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+
+    // Classify the candidate pairs
+    pair_batch_type.resize(num_pairs);
+    pair_batch_flip.resize(num_pairs);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_pairs; index++) {
+        long long p = pair_shapeIDs[index];
+        bool flip;
+        pair_batch_type[index] = (char)GetBatchType(obj_data_T[int(p >> 32)], obj_data_T[int(p & 0xffffffff)], flip);
+        pair_batch_flip[index] = flip;
+    }
+
+    // Bin the pairs by type (counting sort, preserving the order of the candidate pairs)
+    for (auto& pairs : batch_pairs)
+        pairs.clear();
+    for (int index = 0; index < num_pairs; index++) {
+        int type = pair_batch_type[index];
+        if (type != (int)BatchType::NONE)
+            batch_pairs[type].push_back(index);
+    }
+
+    // With speculative contacts, the batches are processed with the largest separation of any pair and contacts beyond
+    // the separation of their own pair are discarded when scattering the results
+    real separation = 2 * cd_data->collision_envelope;
+    if (!aabb_spec.empty())
+        separation += 2 * *std::max_element(aabb_spec.begin(), aabb_spec.end());
+
+    for (int type = 0; type < (int)BatchType::NONE; type++) {
+        const std::vector<uint>& pairs = batch_pairs[type];
+        PairBatch& batch = batches[type];
+        const int n = (signed)pairs.size();
+        batch.Resize((BatchType)type, n);
+        if (n == 0)
+            continue;
+
+        ConvexShape shapeA;
+        ConvexShape shapeB;
+        shapeA.data = &cd_data->shape_data;
+        shapeB.data = &cd_data->shape_data;
+
+        // Gather, process, and scatter the batch data, one chunk of pairs at a time
+#pragma omp parallel for firstprivate(shapeA, shapeB) schedule(dynamic)
+        for (int chunk = 0; chunk < (n + batch_chunk - 1) / batch_chunk; chunk++) {
+            int start = chunk * batch_chunk;
+            int end = std::min(start + batch_chunk, n);
+
+            for (int i = start; i < end; i++) {
+                uint index = pairs[i];
+                long long p = pair_shapeIDs[index];
+                shapeA.index = int(p >> 32);
+                shapeB.index = int(p & 0xffffffff);
+                const ConvexShape& other = pair_batch_flip[index] ? shapeB : shapeA;
+                const ConvexShape& sphere = pair_batch_flip[index] ? shapeA : shapeB;
+
+                real3 pos = type == (int)BatchType::TRIANGLE_SPHERE ? other.Triangles()[0] : other.A();
+                batch.px[i] = pos.x;
+                batch.py[i] = pos.y;
+                batch.pz[i] = pos.z;
+
+                switch ((BatchType)type) {
+                    case BatchType::SPHERE_SPHERE:
+                        batch.dx[i] = other.Radius();
+                        break;
+                    case BatchType::BOX_SPHERE: {
+                        quaternion rot = other.R();
+                        real3 hdims = other.Box();
+                        batch.qw[i] = rot.w;
+                        batch.qx[i] = rot.x;
+                        batch.qy[i] = rot.y;
+                        batch.qz[i] = rot.z;
+                        batch.dx[i] = hdims.x;
+                        batch.dy[i] = hdims.y;
+                        batch.dz[i] = hdims.z;
+                        break;
+                    }
+                    case BatchType::CAPSULE_SPHERE: {
+                        quaternion rot = other.R();
+                        real2 dims = other.Capsule();
+                        batch.qw[i] = rot.w;
+                        batch.qx[i] = rot.x;
+                        batch.qy[i] = rot.y;
+                        batch.qz[i] = rot.z;
+                        batch.dx[i] = dims.x;
+                        batch.dy[i] = dims.y;
+                        break;
+                    }
+                    case BatchType::TRIANGLE_SPHERE: {
+                        const real3* tri = other.Triangles();
+                        batch.bx[i] = tri[1].x;
+                        batch.by[i] = tri[1].y;
+                        batch.bz[i] = tri[1].z;
+                        batch.cx[i] = tri[2].x;
+                        batch.cy[i] = tri[2].y;
+                        batch.cz[i] = tri[2].z;
+                        break;
+                    }
+                    default:
+                        break;
+                }
+
+                real3 center = sphere.A();
+                batch.sx[i] = center.x;
+                batch.sy[i] = center.y;
+                batch.sz[i] = center.z;
+                batch.r[i] = sphere.Radius();
+            }
+
+            ProcessBatch((BatchType)type, separation, batch, start, end);
+
+            // Each of these pairs has exactly one contact slot. If the sphere is the first shape, swap the contact
+            // points and flip the normal (as done in PRIMSCollision).
+            for (int i = start; i < end; i++) {
+                if (!batch.active[i])
+                    continue;
+                uint index = pairs[i];
+                uint icoll = contact_index[index];
+                long long p = pair_shapeIDs[index];
+                if (!aabb_spec.empty() &&
+                    batch.depth[i] >= 2 * cd_data->collision_envelope +
+                                          SpeculativeMargin(int(p >> 32), int(p & 0xffffffff)))
+                    continue;
+                uint ID_A = cd_data->shape_data.id_rigid[int(p >> 32)];
+                uint ID_B = cd_data->shape_data.id_rigid[int(p & 0xffffffff)];
+
+                real3 norm(batch.nx[i], batch.ny[i], batch.nz[i]);
+                real3 pt1(batch.p1x[i], batch.p1y[i], batch.p1z[i]);
+                real3 pt2(batch.p2x[i], batch.p2y[i], batch.p2z[i]);
+                if (pair_batch_flip[index]) {
+                    cd_data->norm_rigid_rigid[icoll] = -norm;
+                    cd_data->cpta_rigid_rigid[icoll] = pt2;
+                    cd_data->cptb_rigid_rigid[icoll] = pt1;
+                } else {
+                    cd_data->norm_rigid_rigid[icoll] = norm;
+                    cd_data->cpta_rigid_rigid[icoll] = pt1;
+                    cd_data->cptb_rigid_rigid[icoll] = pt2;
+                }
+                cd_data->dpth_rigid_rigid[icoll] = batch.depth[i];
+                cd_data->erad_rigid_rigid[icoll] = batch.eff_rad[i];
+                Dispatch_Finalize(icoll, ID_A, ID_B, 1);
+            }
+        }
+    }
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -445,18 +445,16 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            if (CheckShape(shape, start, end, info.normal, mindist2)) {
                 hit = true;
+                info.shapeID = shape.index;  // Identifier of closest hit shape
+            }
         }
 
-        // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
+        // If the closest hit so far is within the current bin, stop (shapes in subsequent bins cannot be closer).
+        // A hit point beyond the current bin may still be preceded by a hit on a shape in one of the next bins.
+        if (hit && Sqrt(mindist2) <= Min(t_next[0], Min(t_next[1], t_next[2])) * Length(ray))
             break;
-        }
 
         // Move to the next cell (the one with lowest t_next)
         static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
@@ -468,6 +466,12 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         t_next[axis] += delta[axis];
     }
 
+    if (hit) {
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+
     return hit;
 }
 
@@ -0,0 +1,298 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CHDUAL_H
+#define CHDUAL_H
+
+#include <cmath>
+
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_linalg
+/// @{
+
+/// Dual number for forward-mode automatic differentiation.
+/// A ChDual carries a value and its derivatives along N directions, so that a function evaluated on dual arguments
+/// returns its value together with N columns of its Jacobian (one sweep for N seed directions).
+/// Seed a direction by setting the corresponding derivative of an input to 1 (see SetSeed).
+template <int N>
+class ChDual {
+  public:
+    static const int dim = N;
+
+    /// Construct a constant (all derivatives zero).
+    ChDual(double val = 0) : m_val(val) {
+        for (int i = 0; i < N; i++)
+            m_der[i] = 0;
+    }
+
+    /// Construct a variable seeded in the specified direction.
+    ChDual(double val, int seed) : ChDual(val) { m_der[seed] = 1; }
+
+    /// Access the value.
+    double& value() { return m_val; }
+    double value() const { return m_val; }
+
+    /// Access the derivative in the i-th direction.
+    double& deriv(int i) { return m_der[i]; }
+    double deriv(int i) const { return m_der[i]; }
+
+    /// Reset the derivatives and seed the i-th direction.
+    void SetSeed(int i) {
+        for (int k = 0; k < N; k++)
+            m_der[k] = 0;
+        m_der[i] = 1;
+    }
+
+    ChDual operator-() const {
+        ChDual r(-m_val);
+        for (int i = 0; i < N; i++)
+            r.m_der[i] = -m_der[i];
+        return r;
+    }
+
+    ChDual& operator+=(const ChDual& b) {
+        m_val += b.m_val;
+        for (int i = 0; i < N; i++)
+            m_der[i] += b.m_der[i];
+        return *this;
+    }
+    ChDual& operator-=(const ChDual& b) {
+        m_val -= b.m_val;
+        for (int i = 0; i < N; i++)
+            m_der[i] -= b.m_der[i];
+        return *this;
+    }
+    ChDual& operator*=(const ChDual& b) {
+        for (int i = 0; i < N; i++)
+            m_der[i] = m_der[i] * b.m_val + m_val * b.m_der[i];
+        m_val *= b.m_val;
+        return *this;
+    }
+    ChDual& operator/=(const ChDual& b) {
+        double inv = 1 / b.m_val;
+        m_val *= inv;
+        for (int i = 0; i < N; i++)
+            m_der[i] = (m_der[i] - m_val * b.m_der[i]) * inv;
+        return *this;
+    }
+
+    ChDual& operator+=(double b) {
+        m_val += b;
+        return *this;
+    }
+    ChDual& operator-=(double b) {
+        m_val -= b;
+        return *this;
+    }
+    ChDual& operator*=(double b) {
+        m_val *= b;
+        for (int i = 0; i < N; i++)
+            m_der[i] *= b;
+        return *this;
+    }
+    ChDual& operator/=(double b) { return (*this) *= (1 / b); }
+
+    /// Chain rule: return f(this), given f = f(value) and df = f'(value).
+    ChDual Chain(double f, double df) const {
+        ChDual r(f);
+        for (int i = 0; i < N; i++)
+            r.m_der[i] = df * m_der[i];
+        return r;
+    }
+
+    // Elementary functions, defined as friends so that they are found only through argument-dependent lookup and do
+    // not hide the standard functions for unqualified calls with double arguments in namespace chrono.
+    // Templated loader code should call these unqualified (e.g. 'using std::sqrt; sqrt(x);').
+
+    friend ChDual sqrt(const ChDual& a) {
+        double s = std::sqrt(a.m_val);
+        return a.Chain(s, 0.5 / s);
+    }
+    friend ChDual abs(const ChDual& a) { return a.Chain(std::abs(a.m_val), a.m_val < 0 ? -1.0 : 1.0); }
+    friend ChDual exp(const ChDual& a) {
+        double e = std::exp(a.m_val);
+        return a.Chain(e, e);
+    }
+    friend ChDual log(const ChDual& a) { return a.Chain(std::log(a.m_val), 1 / a.m_val); }
+    friend ChDual pow(const ChDual& a, double p) {
+        return a.Chain(std::pow(a.m_val, p), p * std::pow(a.m_val, p - 1));
+    }
+    friend ChDual sin(const ChDual& a) { return a.Chain(std::sin(a.m_val), std::cos(a.m_val)); }
+    friend ChDual cos(const ChDual& a) { return a.Chain(std::cos(a.m_val), -std::sin(a.m_val)); }
+    friend ChDual tan(const ChDual& a) {
+        double t = std::tan(a.m_val);
+        return a.Chain(t, 1 + t * t);
+    }
+    friend ChDual atan(const ChDual& a) { return a.Chain(std::atan(a.m_val), 1 / (1 + a.m_val * a.m_val)); }
+    friend ChDual tanh(const ChDual& a) {
+        double t = std::tanh(a.m_val);
+        return a.Chain(t, 1 - t * t);
+    }
+    friend ChDual atan2(const ChDual& y, const ChDual& x) {
+        double r2 = x.m_val * x.m_val + y.m_val * y.m_val;
+        ChDual r(std::atan2(y.m_val, x.m_val));
+        for (int i = 0; i < N; i++)
+            r.m_der[i] = (x.m_val * y.m_der[i] - y.m_val * x.m_der[i]) / r2;
+        return r;
+    }
+
+  private:
+    double m_val;     ///< value
+    double m_der[N];  ///< derivatives along the N seed directions
+};
+
+template <int N>
+inline ChDual<N> operator+(ChDual<N> a, const ChDual<N>& b) {
+    return a += b;
+}
+template <int N>
+inline ChDual<N> operator-(ChDual<N> a, const ChDual<N>& b) {
+    return a -= b;
+}
+template <int N>
+inline ChDual<N> operator*(ChDual<N> a, const ChDual<N>& b) {
+    return a *= b;
+}
+template <int N>
+inline ChDual<N> operator/(ChDual<N> a, const ChDual<N>& b) {
+    return a /= b;
+}
+
+template <int N>
+inline ChDual<N> operator+(ChDual<N> a, double b) {
+    return a += b;
+}
+template <int N>
+inline ChDual<N> operator-(ChDual<N> a, double b) {
+    return a -= b;
+}
+template <int N>
+inline ChDual<N> operator*(ChDual<N> a, double b) {
+    return a *= b;
+}
+template <int N>
+inline ChDual<N> operator/(ChDual<N> a, double b) {
+    return a /= b;
+}
+
+template <int N>
+inline ChDual<N> operator+(double a, ChDual<N> b) {
+    return b += a;
+}
+template <int N>
+inline ChDual<N> operator-(double a, const ChDual<N>& b) {
+    return (-b) += a;
+}
+template <int N>
+inline ChDual<N> operator*(double a, ChDual<N> b) {
+    return b *= a;
+}
+template <int N>
+inline ChDual<N> operator/(double a, const ChDual<N>& b) {
+    return ChDual<N>(a) /= b;
+}
+
+// Comparisons act on the values only.
+
+template <int N>
+inline bool operator<(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() < b.value();
+}
+template <int N>
+inline bool operator>(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() > b.value();
+}
+template <int N>
+inline bool operator<=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() <= b.value();
+}
+template <int N>
+inline bool operator>=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() >= b.value();
+}
+template <int N>
+inline bool operator==(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() == b.value();
+}
+template <int N>
+inline bool operator!=(const ChDual<N>& a, const ChDual<N>& b) {
+    return a.value() != b.value();
+}
+template <int N>
+inline bool operator<(const ChDual<N>& a, double b) {
+    return a.value() < b;
+}
+template <int N>
+inline bool operator>(const ChDual<N>& a, double b) {
+    return a.value() > b;
+}
+template <int N>
+inline bool operator<=(const ChDual<N>& a, double b) {
+    return a.value() <= b;
+}
+template <int N>
+inline bool operator>=(const ChDual<N>& a, double b) {
+    return a.value() >= b;
+}
+
+/// Return the value of a scalar (double or dual number).
+inline double ChDualValue(double a) {
+    return a;
+}
+template <int N>
+inline double ChDualValue(const ChDual<N>& a) {
+    return a.value();
+}
+
+/// @} chrono_linalg
+
+}  // end namespace chrono
+
+namespace Eigen {
+
+/// Eigen type traits for vectors and matrices of ChDual numbers.
+template <int N>
+struct NumTraits<chrono::ChDual<N>> : NumTraits<double> {
+    typedef chrono::ChDual<N> Real;
+    typedef chrono::ChDual<N> NonInteger;
+    typedef chrono::ChDual<N> Nested;
+    typedef chrono::ChDual<N> Literal;
+
+    enum {
+        IsComplex = 0,
+        IsInteger = 0,
+        IsSigned = 1,
+        RequireInitialization = 1,
+        ReadCost = N + 1,
+        AddCost = N + 1,
+        MulCost = 2 * N + 1
+    };
+};
+
+template <int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<chrono::ChDual<N>, double, BinaryOp> {
+    typedef chrono::ChDual<N> ReturnType;
+};
+
+template <int N, typename BinaryOp>
+struct ScalarBinaryOpTraits<double, chrono::ChDual<N>, BinaryOp> {
+    typedef chrono::ChDual<N> ReturnType;
+};
+
+}  // end namespace Eigen
+
+#endif
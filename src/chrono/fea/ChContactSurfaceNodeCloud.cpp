@@ -53,8 +53,8 @@ ChPhysicsItem* ChContactNodeXYZ::GetPhysicsItem() {
 // -----------------------------------------------------------------------------
 //  ChContactNodeXYZsphere
 
-ChContactNodeXYZsphere::ChContactNodeXYZsphere(ChNodeFEAxyz* anode, ChContactSurface* acontainer)
-    : ChContactNodeXYZ(anode, acontainer) {
+ChContactNodeXYZsphere::ChContactNodeXYZsphere(ChNodeFEAxyz* anode, ChContactSurface* acontainer, double radius)
+    : ChContactNodeXYZ(anode, acontainer), m_radius(radius) {
     this->collision_model = new collision::ChCollisionModelBullet;
     this->collision_model->SetContactable(this);
 }
@@ -90,8 +90,10 @@ ChPhysicsItem* ChContactNodeXYZROT::GetPhysicsItem() {
 // -----------------------------------------------------------------------------
 //  ChContactNodeXYZROTsphere
 
-ChContactNodeXYZROTsphere::ChContactNodeXYZROTsphere(ChNodeFEAxyzrot* anode, ChContactSurface* acontainer)
-    : ChContactNodeXYZROT(anode, acontainer) {
+ChContactNodeXYZROTsphere::ChContactNodeXYZROTsphere(ChNodeFEAxyzrot* anode,
+                                                     ChContactSurface* acontainer,
+                                                     double radius)
+    : ChContactNodeXYZROT(anode, acontainer), m_radius(radius) {
     this->collision_model = new collision::ChCollisionModelBullet;
     this->collision_model->SetContactable(this);
 }
@@ -106,7 +108,7 @@ void ChContactSurfaceNodeCloud::AddNode(std::shared_ptr<ChNodeFEAxyz> mnode, con
     if (!mnode)
         return;
 
-    auto newp = chrono_types::make_shared<ChContactNodeXYZsphere>(mnode.get(), this);
+    auto newp = chrono_types::make_shared<ChContactNodeXYZsphere>(mnode.get(), this, point_radius);
 
     newp->GetCollisionModel()->AddPoint(m_material, point_radius);
     newp->GetCollisionModel()->BuildModel();  // will also add to system, if collision is on.
@@ -118,7 +120,7 @@ void ChContactSurfaceNodeCloud::AddNode(std::shared_ptr<ChNodeFEAxyzrot> mnode,
     if (!mnode)
         return;
 
-    auto newp = chrono_types::make_shared<ChContactNodeXYZROTsphere>(mnode.get(), this);
+    auto newp = chrono_types::make_shared<ChContactNodeXYZROTsphere>(mnode.get(), this, point_radius);
 
     newp->GetCollisionModel()->AddPoint(m_material, point_radius);
     newp->GetCollisionModel()->BuildModel();  // will also add to system, if collision is on.
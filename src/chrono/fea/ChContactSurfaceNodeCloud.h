@@ -149,14 +149,18 @@ class ChApi ChContactNodeXYZ : public ChContactable_1vars<3> {
 class ChApi ChContactNodeXYZsphere : public ChContactNodeXYZ {
 
   public:
-    ChContactNodeXYZsphere(ChNodeFEAxyz* anode = 0, ChContactSurface* acontainer = 0);
+    ChContactNodeXYZsphere(ChNodeFEAxyz* anode = 0, ChContactSurface* acontainer = 0, double radius = 0);
 
     virtual ~ChContactNodeXYZsphere() { delete collision_model; }
 
     collision::ChCollisionModel* GetCollisionModel() { return collision_model; }
 
+    /// Get the radius of the contact sphere.
+    double GetRadius() const { return m_radius; }
+
   private:
     collision::ChCollisionModel* collision_model;
+    double m_radius;
 };
 
 /// Proxy to FEA nodes with 3 xyz + 3 rot coords, to grant them the features
@@ -286,14 +290,18 @@ class ChApi ChContactNodeXYZROT : public ChContactable_1vars<6> {
 class ChApi ChContactNodeXYZROTsphere : public ChContactNodeXYZROT {
 
   public:
-    ChContactNodeXYZROTsphere(ChNodeFEAxyzrot* anode = 0, ChContactSurface* acontainer = 0);
+    ChContactNodeXYZROTsphere(ChNodeFEAxyzrot* anode = 0, ChContactSurface* acontainer = 0, double radius = 0);
 
     virtual ~ChContactNodeXYZROTsphere() { delete collision_model; }
 
     collision::ChCollisionModel* GetCollisionModel() { return collision_model; }
 
+    /// Get the radius of the contact sphere.
+    double GetRadius() const { return m_radius; }
+
   private:
     collision::ChCollisionModel* collision_model;
+    double m_radius;
 };
 
 /// Class which defines a contact surface for FEA elements.
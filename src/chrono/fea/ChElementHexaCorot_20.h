@@ -215,6 +215,9 @@ class ChApi ChElementHexaCorot_20 : public ChElementHexahedron,
     /// This is needed so that it can be accessed by ChLoaderVolumeGravity
     virtual double GetDensity() override { return this->Material->Get_density(); }
 
+    /// The shape functions and det[J] used in ComputeNF are evaluated in the reference configuration.
+    virtual bool IsNFStateIndependent() override { return true; }
+
   private:
     virtual void SetupInitial(ChSystem* system) override { ComputeStiffnessMatrix(); }
 
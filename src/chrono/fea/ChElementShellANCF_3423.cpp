@@ -1743,6 +1743,30 @@ ChVector<> ChElementShellANCF_3423::ComputeNormal(const double U, const double V
     return G1xG2 / G1xG2nrm;
 }
 
+// Calculate the maps from the element coordinates to the mid-surface tangents at (U,V) coordinates.
+// The position field is linear in the nodal coordinates, with each node contributing position and gradient rows, in the
+// same order as the element state (see CalcCoordMatrix).
+bool ChElementShellANCF_3423::ComputeTangentMaps(const double U,
+                                                 const double V,
+                                                 ChMatrixDynamic<>& Tu,
+                                                 ChMatrixDynamic<>& Tv) {
+    ShapeVector Nx;
+    ShapeVector Ny;
+    ShapeFunctionsDerivativeX(Nx, U, V, 0);
+    ShapeFunctionsDerivativeY(Ny, U, V, 0);
+
+    Tu.setZero(3, 3 * NSF);
+    Tv.setZero(3, 3 * NSF);
+    for (int i = 0; i < NSF; i++) {
+        for (int j = 0; j < 3; j++) {
+            Tu(j, 3 * i + j) = Nx(i) * m_lenX / 2;
+            Tv(j, 3 * i + j) = Ny(i) * m_lenY / 2;
+        }
+    }
+
+    return true;
+}
+
 // ============================================================================
 // Implementation of ChElementShellANCF_3423::Layer methods
 // ============================================================================
@@ -370,6 +370,10 @@ class ChApi ChElementShellANCF_3423 : public ChElementANCF,
     /// Each coordinate ranging in -1..+1.
     virtual ChVector<> ComputeNormal(const double U, const double V) override;
 
+    /// Compute the maps from the element coordinates to the mid-surface tangents at the parametric coordinate U,V.
+    /// The tangents are taken with respect to the normalized coordinates, consistent with det[J] in ComputeNF.
+    virtual bool ComputeTangentMaps(const double U, const double V, ChMatrixDynamic<>& Tu, ChMatrixDynamic<>& Tv) override;
+
   private:
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
@@ -208,6 +208,9 @@ class ChApi ChElementTetraCorot_10 : public ChElementTetrahedron,
     /// otherwise use quadrature over u,v,w in [-1..+1] as box isoparametric coords.
     virtual bool IsTetrahedronIntegrationNeeded() override { return true; }
 
+    /// The shape functions and det[J] used in ComputeNF are evaluated in the reference configuration.
+    virtual bool IsNFStateIndependent() override { return true; }
+
   private:
     virtual void SetupInitial(ChSystem* system) override;
 
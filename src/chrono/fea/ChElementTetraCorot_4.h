@@ -193,6 +193,9 @@ class ChApi ChElementTetraCorot_4 : public ChElementTetrahedron,
     /// otherwise use quadrature over u,v,w in [-1..+1] as box isoparametric coords.
     virtual bool IsTetrahedronIntegrationNeeded() override { return true; }
 
+    /// The shape functions and det[J] used in ComputeNF are evaluated in the reference configuration.
+    virtual bool IsNFStateIndependent() override { return true; }
+
   private:
     /// Initial setup: set up the element's parameters and matrices
     virtual void SetupInitial(ChSystem* system) override;
@@ -358,6 +361,9 @@ class ChApi ChElementTetraCorot_4_P : public ChElementGeneric, public ChElementC
     /// otherwise use quadrature over u,v,w in [-1..+1] as box isoparametric coords.
     virtual bool IsTetrahedronIntegrationNeeded() override { return true; }
 
+    /// The shape functions and det[J] used in ComputeNF are evaluated in the reference configuration.
+    virtual bool IsNFStateIndependent() override { return true; }
+
   private:
     /// Initial setup: set up the element's parameters and matrices
     virtual void SetupInitial(ChSystem* system) override;
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <fstream>
 #include <map>
 
@@ -59,6 +60,13 @@ ChTriangleMeshConnected::ChTriangleMeshConnected(const ChTriangleMeshConnected&
         this->m_properties_per_face[i]=source.m_properties_per_face[i]->clone();
 
     m_filename = source.m_filename;
+
+    m_adj_valid = source.m_adj_valid;
+    m_adj_key = source.m_adj_key;
+    m_adj_tri_map = source.m_adj_tri_map;
+    m_adj_winged_edges = source.m_adj_winged_edges;
+    m_adj_tri_map_flag = source.m_adj_tri_map_flag;
+    m_adj_winged_edges_flag = source.m_adj_winged_edges_flag;
 }
 
 ChTriangleMeshConnected::~ChTriangleMeshConnected() {
@@ -98,6 +106,10 @@ void ChTriangleMeshConnected::Clear() {
     m_face_col_indices.clear();
     m_face_mat_indices.clear();
 
+    m_adj_valid = false;
+    m_adj_tri_map.clear();
+    m_adj_winged_edges.clear();
+
     for (ChProperty* id : this->m_properties_per_vertex)
         delete(id);
     m_properties_per_vertex.clear();
@@ -262,6 +274,52 @@ std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromWave
     return trimesh;
 }
 
+// Set the mesh data from the output of the tinyobj loader
+static void SetWavefrontData(ChTriangleMeshConnected& mesh,
+                             const tinyobj::attrib_t& att,
+                             const std::vector<tinyobj::shape_t>& shapes,
+                             const std::string& filename,
+                             bool load_normals,
+                             bool load_uv) {
+    mesh.Clear();
+
+    mesh.m_filename = filename;
+
+    for (size_t i = 0; i < att.vertices.size() / 3; i++) {
+        mesh.m_vertices.push_back(
+            ChVector<>(att.vertices[3 * i + 0], att.vertices[3 * i + 1], att.vertices[3 * i + 2]));
+    }
+    if (load_normals) {
+        for (size_t i = 0; i < att.normals.size() / 3; i++) {
+            mesh.m_normals.push_back(
+                ChVector<>(att.normals[3 * i + 0], att.normals[3 * i + 1], att.normals[3 * i + 2]));
+        }
+    }
+    if (load_uv) {
+        for (size_t i = 0; i < att.texcoords.size() / 2; i++) {
+            mesh.m_UV.push_back(ChVector2<>(att.texcoords[2 * i + 0], att.texcoords[2 * i + 1]));
+        }
+    }
+
+    for (size_t i = 0; i < shapes.size(); i++) {
+        for (size_t j = 0; j < shapes[i].mesh.indices.size() / 3; j++) {
+            mesh.m_face_v_indices.push_back(ChVector<int>(shapes[i].mesh.indices[3 * j + 0].vertex_index,
+                                                          shapes[i].mesh.indices[3 * j + 1].vertex_index,
+                                                          shapes[i].mesh.indices[3 * j + 2].vertex_index));
+            if (mesh.m_normals.size() > 0) {
+                mesh.m_face_n_indices.push_back(ChVector<int>(shapes[i].mesh.indices[3 * j + 0].normal_index,
+                                                              shapes[i].mesh.indices[3 * j + 1].normal_index,
+                                                              shapes[i].mesh.indices[3 * j + 2].normal_index));
+            }
+            if (mesh.m_UV.size() > 0) {
+                mesh.m_face_uv_indices.push_back(ChVector<int>(shapes[i].mesh.indices[3 * j + 0].texcoord_index,
+                                                               shapes[i].mesh.indices[3 * j + 1].texcoord_index,
+                                                               shapes[i].mesh.indices[3 * j + 2].texcoord_index));
+            }
+        }
+    }
+}
+
 bool ChTriangleMeshConnected::LoadWavefrontMesh(const std::string& filename, bool load_normals, bool load_uv) {
     assert(filesystem::path(filename).is_file());
 
@@ -279,40 +337,167 @@ bool ChTriangleMeshConnected::LoadWavefrontMesh(const std::string& filename, boo
         return false;
     }
 
-    this->Clear();
+    SetWavefrontData(*this, att, shapes, filename, load_normals, load_uv);
+    return true;
+}
 
-    m_filename = filename;
+bool ChTriangleMeshConnected::LoadWavefrontMesh(std::istream& stream,
+                                                const std::string& filename,
+                                                bool load_normals,
+                                                bool load_uv) {
+    std::vector<tinyobj::shape_t> shapes;
+    tinyobj::attrib_t att;
+    std::vector<tinyobj::material_t> materials;
+    std::string warn;
+    std::string err;
 
-    for (size_t i = 0; i < att.vertices.size() / 3; i++) {
-        m_vertices.push_back(ChVector<>(att.vertices[3 * i + 0], att.vertices[3 * i + 1], att.vertices[3 * i + 2]));
-    }
-    if (load_normals) {
-        for (size_t i = 0; i < att.normals.size() / 3; i++) {
-            m_normals.push_back(ChVector<>(att.normals[3 * i + 0], att.normals[3 * i + 1], att.normals[3 * i + 2]));
-        }
+    bool success = tinyobj::LoadObj(&att, &shapes, &materials, &warn, &err, &stream);
+    if (!success) {
+        std::cerr << "Error loading OBJ data " << filename << std::endl;
+        std::cerr << "   tiny_obj warning message: " << warn << std::endl;
+        std::cerr << "   tiny_obj error message:   " << err << std::endl;
+        return false;
     }
-    if (load_uv) {
-        for (size_t i = 0; i < att.texcoords.size() / 2; i++) {
-            m_UV.push_back(ChVector2<>(att.texcoords[2 * i + 0], att.texcoords[2 * i + 1]));
-        }
+
+    SetWavefrontData(*this, att, shapes, filename, load_normals, load_uv);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Binary mesh files
+//
+// Layout (native byte order, all sections 8-byte aligned):
+//   header:     char[8] magic "CHMESH", uint32 version, uint32 byte order mark
+//   file name:  uint64 length, characters
+//   arrays:     uint64 count, raw elements (vertices, normals, UV, colors, face vertex/normal/UV/color/material
+//               indices, neighbouring triangle map, winged edges)
+//   flags:      uint32 connectivity flags (valid, tri_map flag, winged_edges flag), uint32 unused
+// -----------------------------------------------------------------------------
+
+static const char binary_mesh_magic[8] = {'C', 'H', 'M', 'E', 'S', 'H', '\0', '\0'};
+static const uint32_t binary_mesh_version = 1;
+static const uint32_t binary_mesh_bom = 0x01020304;
+
+static_assert(sizeof(ChVector<double>) == 3 * sizeof(double), "unexpected ChVector<double> layout");
+static_assert(sizeof(ChVector2<double>) == 2 * sizeof(double), "unexpected ChVector2<double> layout");
+static_assert(sizeof(ChVector<int>) == 3 * sizeof(int), "unexpected ChVector<int> layout");
+static_assert(sizeof(ChColor) == 3 * sizeof(float), "unexpected ChColor layout");
+static_assert(sizeof(std::array<int, 4>) == 4 * sizeof(int), "unexpected std::array<int, 4> layout");
+
+static void WriteBinaryPadding(std::ofstream& stream, size_t size) {
+    static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    stream.write(zeros, (8 - size % 8) % 8);
+}
+
+template <typename T>
+static void WriteBinaryArray(std::ofstream& stream, const T* data, uint64_t count) {
+    stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    stream.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    WriteBinaryPadding(stream, count * sizeof(T));
+}
+
+// Read an array directly into the storage of the given vector.
+// The element count is checked against the remaining file size before allocating.
+template <typename T>
+static bool ReadBinaryArray(std::ifstream& stream, uint64_t file_size, std::vector<T>& data) {
+    uint64_t count;
+    if (!stream.read(reinterpret_cast<char*>(&count), sizeof(count)))
+        return false;
+    uint64_t size = count * sizeof(T);
+    uint64_t pos = (uint64_t)stream.tellg();
+    if (count > file_size / sizeof(T) || size > file_size - pos)
+        return false;
+    data.resize(count);
+    if (!stream.read(reinterpret_cast<char*>(data.data()), size))
+        return false;
+    stream.seekg((8 - size % 8) % 8, std::ios::cur);
+    return stream.good();
+}
+
+std::shared_ptr<ChTriangleMeshConnected> ChTriangleMeshConnected::CreateFromBinaryFile(const std::string& filename) {
+    auto trimesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    if (!trimesh->LoadBinaryMesh(filename))
+        return nullptr;
+    return trimesh;
+}
+
+bool ChTriangleMeshConnected::WriteBinaryMesh(const std::string& filename) const {
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    if (!stream.good())
+        return false;
+
+    stream.write(binary_mesh_magic, sizeof(binary_mesh_magic));
+    stream.write(reinterpret_cast<const char*>(&binary_mesh_version), sizeof(binary_mesh_version));
+    stream.write(reinterpret_cast<const char*>(&binary_mesh_bom), sizeof(binary_mesh_bom));
+
+    WriteBinaryArray(stream, m_filename.data(), m_filename.size());
+
+    WriteBinaryArray(stream, m_vertices.data(), m_vertices.size());
+    WriteBinaryArray(stream, m_normals.data(), m_normals.size());
+    WriteBinaryArray(stream, m_UV.data(), m_UV.size());
+    WriteBinaryArray(stream, m_colors.data(), m_colors.size());
+    WriteBinaryArray(stream, m_face_v_indices.data(), m_face_v_indices.size());
+    WriteBinaryArray(stream, m_face_n_indices.data(), m_face_n_indices.size());
+    WriteBinaryArray(stream, m_face_uv_indices.data(), m_face_uv_indices.size());
+    WriteBinaryArray(stream, m_face_col_indices.data(), m_face_col_indices.size());
+    WriteBinaryArray(stream, m_face_mat_indices.data(), m_face_mat_indices.size());
+
+    // Connectivity data (only if valid for the current face indices)
+    bool adjacency = HasAdjacency();
+    uint32_t flags[2] = {0, 0};
+    if (adjacency)
+        flags[0] = 1 | (m_adj_tri_map_flag ? 2 : 0) | (m_adj_winged_edges_flag ? 4 : 0);
+    stream.write(reinterpret_cast<const char*>(flags), sizeof(flags));
+    WriteBinaryArray(stream, m_adj_tri_map.data(), adjacency ? m_adj_tri_map.size() : 0);
+    WriteBinaryArray(stream, m_adj_winged_edges.data(), adjacency ? m_adj_winged_edges.size() : 0);
+
+    return stream.good();
+}
+
+bool ChTriangleMeshConnected::LoadBinaryMesh(const std::string& filename) {
+    Clear();
+
+    std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+    if (!stream.good())
+        return false;
+    uint64_t file_size = (uint64_t)stream.tellg();
+    stream.seekg(0);
+
+    char magic[8];
+    uint32_t version = 0;
+    uint32_t bom = 0;
+    stream.read(magic, sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    stream.read(reinterpret_cast<char*>(&bom), sizeof(bom));
+    if (!stream.good() || std::memcmp(magic, binary_mesh_magic, sizeof(magic)) != 0 ||
+        version != binary_mesh_version || bom != binary_mesh_bom)
+        return false;
+
+    std::vector<char> name;
+    uint32_t flags[2] = {0, 0};
+    bool success = ReadBinaryArray(stream, file_size, name) && ReadBinaryArray(stream, file_size, m_vertices) &&
+                   ReadBinaryArray(stream, file_size, m_normals) && ReadBinaryArray(stream, file_size, m_UV) &&
+                   ReadBinaryArray(stream, file_size, m_colors) &&
+                   ReadBinaryArray(stream, file_size, m_face_v_indices) &&
+                   ReadBinaryArray(stream, file_size, m_face_n_indices) &&
+                   ReadBinaryArray(stream, file_size, m_face_uv_indices) &&
+                   ReadBinaryArray(stream, file_size, m_face_col_indices) &&
+                   ReadBinaryArray(stream, file_size, m_face_mat_indices) &&
+                   stream.read(reinterpret_cast<char*>(flags), sizeof(flags)) &&
+                   ReadBinaryArray(stream, file_size, m_adj_tri_map) &&
+                   ReadBinaryArray(stream, file_size, m_adj_winged_edges);
+    if (!success) {
+        Clear();
+        return false;
     }
 
-    for (size_t i = 0; i < shapes.size(); i++) {
-        for (size_t j = 0; j < shapes[i].mesh.indices.size() / 3; j++) {
-            m_face_v_indices.push_back(ChVector<int>(shapes[i].mesh.indices[3 * j + 0].vertex_index,
-                                                     shapes[i].mesh.indices[3 * j + 1].vertex_index,
-                                                     shapes[i].mesh.indices[3 * j + 2].vertex_index));
-            if (m_normals.size() > 0) {
-                m_face_n_indices.push_back(ChVector<int>(shapes[i].mesh.indices[3 * j + 0].normal_index,
-                                                         shapes[i].mesh.indices[3 * j + 1].normal_index,
-                                                         shapes[i].mesh.indices[3 * j + 2].normal_index));
-            }
-            if (m_UV.size() > 0) {
-                m_face_uv_indices.push_back(ChVector<int>(shapes[i].mesh.indices[3 * j + 0].texcoord_index,
-                                                          shapes[i].mesh.indices[3 * j + 1].texcoord_index,
-                                                          shapes[i].mesh.indices[3 * j + 2].texcoord_index));
-            }
-        }
+    m_filename.assign(name.begin(), name.end());
+
+    if (flags[0] & 1) {
+        m_adj_tri_map_flag = (flags[0] & 2) != 0;
+        m_adj_winged_edges_flag = (flags[0] & 4) != 0;
+        m_adj_key = HashFaceIndices();
+        m_adj_valid = true;
     }
 
     return true;
@@ -461,6 +646,11 @@ void ChTriangleMeshConnected::Transform(const ChVector<> displ, const ChMatrix33
 }
 
 bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::array<int, 4>>& tri_map) const {
+    if (HasAdjacency()) {
+        tri_map = m_adj_tri_map;
+        return m_adj_tri_map_flag;
+    }
+
     bool pathological_edges = false;
 
     std::multimap<std::pair<int, int>, int> edge_map;
@@ -532,6 +722,16 @@ bool ChTriangleMeshConnected::ComputeNeighbouringTriangleMap(std::vector<std::ar
 
 bool ChTriangleMeshConnected::ComputeWingedEdges(std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges,
                                                  bool allow_single_wing) const {
+    if (HasAdjacency()) {
+        // Stored edges are sorted, so insertion at the end is constant time for an initially empty map
+        for (const auto& e : m_adj_winged_edges) {
+            if (e[3] == -1 && !allow_single_wing)
+                continue;
+            winged_edges.emplace_hint(winged_edges.end(), std::make_pair(e[0], e[1]), std::make_pair(e[2], e[3]));
+        }
+        return m_adj_winged_edges_flag;
+    }
+
     bool pathological_edges = false;
 
     std::multimap<std::pair<int, int>, int> edge_map;
@@ -587,6 +787,39 @@ bool ChTriangleMeshConnected::ComputeWingedEdges(std::map<std::pair<int, int>, s
     return pathological_edges;
 }
 
+void ChTriangleMeshConnected::ComputeAdjacency() {
+    m_adj_valid = false;
+
+    m_adj_tri_map.clear();
+    m_adj_tri_map_flag = ComputeNeighbouringTriangleMap(m_adj_tri_map);
+
+    std::map<std::pair<int, int>, std::pair<int, int>> winged_edges;
+    m_adj_winged_edges_flag = ComputeWingedEdges(winged_edges, true);
+    m_adj_winged_edges.clear();
+    m_adj_winged_edges.reserve(winged_edges.size());
+    for (const auto& e : winged_edges)
+        m_adj_winged_edges.push_back({e.first.first, e.first.second, e.second.first, e.second.second});
+
+    m_adj_key = HashFaceIndices();
+    m_adj_valid = true;
+}
+
+bool ChTriangleMeshConnected::HasAdjacency() const {
+    return m_adj_valid && m_adj_tri_map.size() == m_face_v_indices.size() && m_adj_key == HashFaceIndices();
+}
+
+uint64_t ChTriangleMeshConnected::HashFaceIndices() const {
+    // 64-bit FNV-1a hash
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(m_face_v_indices.data());
+    size_t size = m_face_v_indices.size() * sizeof(ChVector<int>);
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<uint64_t>(bytes[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 int ChTriangleMeshConnected::RepairDuplicateVertexes(const double tolerance) {
     int nmerged = 0;
     std::vector<ChVector<>> processed_verts;
@@ -17,6 +17,8 @@
 
 #include <array>
 #include <cmath>
+#include <cstdint>
+#include <istream>
 #include <map>
 
 #include "chrono/assets/ChColor.h"
@@ -91,6 +93,29 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     /// Load a Wavefront OBJ file into this triangle mesh.
     bool LoadWavefrontMesh(const std::string& filename, bool load_normals = true, bool load_uv = false);
 
+    /// Load Wavefront OBJ data from the given stream into this triangle mesh.
+    /// The specified file name is only recorded (see GetFileName); material libraries are not loaded.
+    bool LoadWavefrontMesh(std::istream& stream,
+                           const std::string& filename,
+                           bool load_normals = true,
+                           bool load_uv = false);
+
+    /// Create and return a ChTriangleMeshConnected from a binary mesh file (see WriteBinaryMesh).
+    /// If an error occurrs during loading, an empty shared pointer is returned.
+    static std::shared_ptr<ChTriangleMeshConnected> CreateFromBinaryFile(const std::string& filename);
+
+    /// Load a binary mesh file (see WriteBinaryMesh) into this triangle mesh.
+    /// Return false (and leave this mesh empty) if the file cannot be read, has a different format version, or was
+    /// written on a machine with different byte order.
+    bool LoadBinaryMesh(const std::string& filename);
+
+    /// Write this mesh to a binary file.
+    /// The file contains the vertices, normals, UVs, colors, all face index arrays, and the precomputed connectivity
+    /// data (if available; see ComputeAdjacency). Per-vertex and per-face properties are not written. Arrays are stored
+    /// in native (little-endian) layout, each starting at an 8-byte aligned offset, so that they are read without
+    /// any parsing (and could be memory-mapped).
+    bool WriteBinaryMesh(const std::string& filename) const;
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, const std::vector<ChTriangleMeshConnected>& meshes);
 
@@ -146,6 +171,14 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     bool ComputeWingedEdges(std::map<std::pair<int, int>, std::pair<int, int>>& winged_edges,
                             bool allow_single_wing = true) const;
 
+    /// Precompute and store the triangle connectivity data (neighbouring triangle map and winged edges).
+    /// As long as the face vertex indices are not modified, ComputeNeighbouringTriangleMap and ComputeWingedEdges
+    /// return copies of the stored data. The connectivity data is also written to (and read from) binary mesh files.
+    void ComputeAdjacency();
+
+    /// Return true if precomputed connectivity data is available and valid for the current face vertex indices.
+    bool HasAdjacency() const;
+
     /// Connect overlapping vertexes.
     /// This can beused to attempt to repair a mesh with 'open edges' to transform it into a watertight mesh.
     /// Say, if a cube is modeled with 6 faces with 4 distinct vertexes each, it might display properly, but for
@@ -226,6 +259,17 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
 
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Return a hash of the face vertex indices (used to validate the precomputed connectivity data).
+    uint64_t HashFaceIndices() const;
+
+    bool m_adj_valid = false;                            ///< true if connectivity data was precomputed
+    uint64_t m_adj_key = 0;                              ///< hash of face vertex indices for connectivity data
+    std::vector<std::array<int, 4>> m_adj_tri_map;       ///< neighbouring triangle map [Ti TieA TieB TieC]
+    std::vector<std::array<int, 4>> m_adj_winged_edges;  ///< winged edges [vA vB tA tB], sorted by edge
+    bool m_adj_tri_map_flag = false;                     ///< return value of ComputeNeighbouringTriangleMap
+    bool m_adj_winged_edges_flag = false;                ///< return value of ComputeWingedEdges
 };
 
 }  // end namespace geometry
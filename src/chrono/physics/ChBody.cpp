@@ -840,8 +840,9 @@ ChVector<> ChBody::GetContactPointSpeed(const ChVector<>& loc_point,
     ChVector<> abs_vel(state_w.segment(0, 3));
     ChVector<> loc_omg(state_w.segment(3, 3));
     ChVector<> abs_omg = csys.TransformDirectionLocalToParent(loc_omg);
+    ChVector<> abs_rel = csys.TransformDirectionLocalToParent(loc_point);
 
-    return abs_vel + Vcross(abs_omg, loc_point);
+    return abs_vel + Vcross(abs_omg, abs_rel);
 }
 
 ChVector<> ChBody::GetContactPointSpeed(const ChVector<>& abs_point) {
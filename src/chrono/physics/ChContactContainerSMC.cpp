@@ -14,6 +14,7 @@
 
 #include "chrono/physics/ChContactContainerSMC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChOpenMP.h"
 
 namespace chrono {
 
@@ -82,6 +83,17 @@ void ChContactContainerSMC::RemoveAllContacts() {
     _RemoveAllContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333);
     _RemoveAllContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666);
     //**TODO*** cont. roll.
+
+    batch_3_3.clear();
+    batch_6_3.clear();
+    batch_6_6.clear();
+    batch_333_3.clear();
+    batch_333_6.clear();
+    batch_333_333.clear();
+    batch_666_3.clear();
+    batch_666_6.clear();
+    batch_666_333.clear();
+    batch_666_666.clear();
 }
 
 void ChContactContainerSMC::BeginAddContact() {
@@ -117,6 +129,19 @@ void ChContactContainerSMC::BeginAddContact() {
 
     // lastcontact_roll = contactlist_roll.begin();
     // n_added_roll = 0;
+
+    // Material properties may have changed since the last call
+    composite_materials.clear();
+}
+
+template <class Tcont>
+void _EvaluateContacts(std::list<Tcont*>& contactlist, std::vector<Tcont*>& batch, int nthreads) {
+    batch.assign(contactlist.begin(), contactlist.end());
+    int n = (int)batch.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int i = 0; i < n; i++) {
+        batch[i]->Evaluate();
+    }
 }
 
 void ChContactContainerSMC::EndAddContact() {
@@ -166,6 +191,19 @@ void ChContactContainerSMC::EndAddContact() {
     //    delete (*lastcontact_roll);
     //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
     //}
+
+    // Calculate the forces for all contacts (deferred from AddContact)
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    _EvaluateContacts(contactlist_3_3, batch_3_3, nthreads);
+    _EvaluateContacts(contactlist_6_3, batch_6_3, nthreads);
+    _EvaluateContacts(contactlist_6_6, batch_6_6, nthreads);
+    _EvaluateContacts(contactlist_333_3, batch_333_3, nthreads);
+    _EvaluateContacts(contactlist_333_6, batch_333_6, nthreads);
+    _EvaluateContacts(contactlist_333_333, batch_333_333, nthreads);
+    _EvaluateContacts(contactlist_666_3, batch_666_3, nthreads);
+    _EvaluateContacts(contactlist_666_6, batch_666_6, nthreads);
+    _EvaluateContacts(contactlist_666_333, batch_666_333, nthreads);
+    _EvaluateContacts(contactlist_666_666, batch_666_666, nthreads);
 }
 
 template <class Tcont, class Titer, class Ta, class Tb>
@@ -178,13 +216,15 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact
                            const collision::ChCollisionInfo& cinfo,  // collision information
                            const ChMaterialCompositeSMC& cmat        // composite material
 ) {
+    // Note: the contact force is calculated later, in EndAddContact
     if (lastcontact != contactlist.end()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
+        (*lastcontact)->Reset_data(objA, objB, cinfo, cmat);
         lastcontact++;
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
+        Tcont* mc = new Tcont(container);
+        mc->Reset_data(objA, objB, cinfo, cmat);
         contactlist.push_back(mc);
         lastcontact = contactlist.end();
     }
@@ -213,12 +253,7 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo,
         return;
     }
 
-    // Create the composite material
-    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat1),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat2));
-
-    InsertContact(cinfo, cmat);
+    InsertContact(cinfo, GetCompositeMaterial(mat1, mat2));
 }
 
 void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo) {
@@ -242,19 +277,33 @@ void ChContactContainerSMC::AddContact(const collision::ChCollisionInfo& cinfo)
         return;
     }
 
-    // Create the composite material
-    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeA->GetMaterial()),
-                                std::static_pointer_cast<ChMaterialSurfaceSMC>(cinfo.shapeB->GetMaterial()));
+    const auto& cmat = GetCompositeMaterial(cinfo.shapeA->GetMaterial(), cinfo.shapeB->GetMaterial());
 
-    // Check for a user-provided callback to modify the material
+    // Check for a user-provided callback to modify the material (on a copy of the cached composite material)
     if (GetAddContactCallback()) {
-        GetAddContactCallback()->OnAddContact(cinfo, &cmat);
+        ChMaterialCompositeSMC cmat_user(cmat);
+        GetAddContactCallback()->OnAddContact(cinfo, &cmat_user);
+        InsertContact(cinfo, cmat_user);
+        return;
     }
 
     InsertContact(cinfo, cmat);
 }
 
+const ChMaterialCompositeSMC& ChContactContainerSMC::GetCompositeMaterial(
+    const std::shared_ptr<ChMaterialSurface>& mat1,
+    const std::shared_ptr<ChMaterialSurface>& mat2) {
+    auto key = std::make_pair(mat1.get(), mat2.get());
+    auto it = composite_materials.find(key);
+    if (it != composite_materials.end())
+        return it->second;
+
+    ChMaterialCompositeSMC cmat(GetSystem()->composition_strategy.get(),
+                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat1),
+                                std::static_pointer_cast<ChMaterialSurfaceSMC>(mat2));
+    return composite_materials.emplace(key, cmat).first->second;
+}
+
 void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat) {
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
@@ -437,43 +486,90 @@ void _IntLoadResidual_F(std::list<Tcont*>& contactlist, ChVectorDynamic<>& R, co
     }
 }
 
+// Load the contact forces from a batch of contacts into the residual of the calling thread.
+// Must be called from within a parallel region.
+template <class Tcont>
+void _IntLoadResidual_F(const std::vector<Tcont*>& batch, ChVectorDynamic<>& R, const double c) {
+    int n = (int)batch.size();
+#pragma omp for schedule(static) nowait
+    for (int i = 0; i < n; i++) {
+        batch[i]->ContIntLoadResidual_F(R, c);
+    }
+}
+
 void ChContactContainerSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
-    _IntLoadResidual_F(contactlist_3_3, R, c);
-    _IntLoadResidual_F(contactlist_6_3, R, c);
-    _IntLoadResidual_F(contactlist_6_6, R, c);
-    _IntLoadResidual_F(contactlist_333_3, R, c);
-    _IntLoadResidual_F(contactlist_333_6, R, c);
-    _IntLoadResidual_F(contactlist_333_333, R, c);
-    _IntLoadResidual_F(contactlist_666_3, R, c);
-    _IntLoadResidual_F(contactlist_666_6, R, c);
-    _IntLoadResidual_F(contactlist_666_333, R, c);
-    _IntLoadResidual_F(contactlist_666_666, R, c);
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+
+    if (nthreads <= 1 || GetNcontacts() == 0) {
+        _IntLoadResidual_F(contactlist_3_3, R, c);
+        _IntLoadResidual_F(contactlist_6_3, R, c);
+        _IntLoadResidual_F(contactlist_6_6, R, c);
+        _IntLoadResidual_F(contactlist_333_3, R, c);
+        _IntLoadResidual_F(contactlist_333_6, R, c);
+        _IntLoadResidual_F(contactlist_333_333, R, c);
+        _IntLoadResidual_F(contactlist_666_3, R, c);
+        _IntLoadResidual_F(contactlist_666_6, R, c);
+        _IntLoadResidual_F(contactlist_666_333, R, c);
+        _IntLoadResidual_F(contactlist_666_666, R, c);
+        return;
+    }
+
+    // Two contacts may act on the same object, so each thread accumulates into its own residual buffer.
+    // The buffers are then summed into R (in thread order, so results do not depend on scheduling).
+    if ((int)thread_residuals.size() < nthreads)
+        thread_residuals.resize(nthreads);
+    int nused = 1;
+
+#pragma omp parallel num_threads(nthreads)
+    {
+        int tid = ChOMP::GetThreadNum();
+        if (tid == 0)
+            nused = ChOMP::GetNumThreads();
+
+        ChVectorDynamic<>& Rt = thread_residuals[tid];
+        Rt.setZero(R.size());
+
+        _IntLoadResidual_F(batch_3_3, Rt, c);
+        _IntLoadResidual_F(batch_6_3, Rt, c);
+        _IntLoadResidual_F(batch_6_6, Rt, c);
+        _IntLoadResidual_F(batch_333_3, Rt, c);
+        _IntLoadResidual_F(batch_333_6, Rt, c);
+        _IntLoadResidual_F(batch_333_333, Rt, c);
+        _IntLoadResidual_F(batch_666_3, Rt, c);
+        _IntLoadResidual_F(batch_666_6, Rt, c);
+        _IntLoadResidual_F(batch_666_333, Rt, c);
+        _IntLoadResidual_F(batch_666_666, Rt, c);
+    }
+
+    for (int t = 0; t < nused; t++)
+        R += thread_residuals[t];
 }
 
 template <class Tcont>
-void _KRMmatricesLoad(std::list<Tcont*> contactlist, double Kfactor, double Rfactor) {
-    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
-    while (itercontact != contactlist.end()) {
-        (*itercontact)->ContKRMmatricesLoad(Kfactor, Rfactor);
-        ++itercontact;
+void _KRMmatricesLoad(const std::vector<Tcont*>& batch, double Kfactor, double Rfactor, int nthreads) {
+    int n = (int)batch.size();
+#pragma omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)
+    for (int i = 0; i < n; i++) {
+        batch[i]->ContKRMmatricesLoad(Kfactor, Rfactor);
     }
 }
 
 void ChContactContainerSMC::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
-    _KRMmatricesLoad(contactlist_3_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_6_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_333_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_3, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_6, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_333, Kfactor, Rfactor);
-    _KRMmatricesLoad(contactlist_666_666, Kfactor, Rfactor);
+    int nthreads = GetSystem() ? GetSystem()->GetNumThreadsChrono() : 1;
+    _KRMmatricesLoad(batch_3_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_6_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_6_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_333_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_333_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_333_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_666_3, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_666_6, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_666_333, Kfactor, Rfactor, nthreads);
+    _KRMmatricesLoad(batch_666_666, Kfactor, Rfactor, nthreads);
 }
 
 template <class Tcont>
-void _InjectKRMmatrices(std::list<Tcont*> contactlist, ChSystemDescriptor& mdescriptor) {
+void _InjectKRMmatrices(std::list<Tcont*>& contactlist, ChSystemDescriptor& mdescriptor) {
     typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
     while (itercontact != contactlist.end()) {
         (*itercontact)->ContInjectKRMmatrices(mdescriptor);
@@ -18,6 +18,9 @@
 #include <algorithm>
 #include <cmath>
 #include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactSMC.h"
@@ -76,6 +79,21 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    // Contiguous arrays of the contacts in the above lists, for parallel force evaluation and residual loading.
+    // These are rebuilt in EndAddContact().
+    std::vector<ChContactSMC_3_3*> batch_3_3;
+    std::vector<ChContactSMC_6_3*> batch_6_3;
+    std::vector<ChContactSMC_6_6*> batch_6_6;
+    std::vector<ChContactSMC_333_3*> batch_333_3;
+    std::vector<ChContactSMC_333_6*> batch_333_6;
+    std::vector<ChContactSMC_333_333*> batch_333_333;
+    std::vector<ChContactSMC_666_3*> batch_666_3;
+    std::vector<ChContactSMC_666_6*> batch_666_6;
+    std::vector<ChContactSMC_666_333*> batch_666_333;
+    std::vector<ChContactSMC_666_666*> batch_666_666;
+
+    std::vector<ChVectorDynamic<>> thread_residuals;  ///< per-thread residual buffers for IntLoadResidual_F
+
   public:
     ChContactContainerSMC();
     ChContactContainerSMC(const ChContactContainerSMC& other);
@@ -100,7 +118,7 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void BeginAddContact() override;
 
     /// Add a contact between two collision shapes, storing it into this container.
-    /// A compositecontact material is created from the two given materials.
+    /// A composite contact material is created from the two given materials.
     /// In this case, the collision info object may have null pointers to collision shapes.
     virtual void AddContact(const collision::ChCollisionInfo& cinfo,
                             std::shared_ptr<ChMaterialSurface> mat1,
@@ -113,6 +131,8 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
     /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
+    /// The contact forces (and Jacobians, if using stiff contact) are calculated here, for all contacts added since
+    /// BeginAddContact(), using the number of threads set with ChSystem::SetNumThreads (num_threads_chrono).
     virtual void EndAddContact() override;
 
     /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
@@ -152,7 +172,21 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
   private:
+    struct MaterialPairHash {
+        size_t operator()(const std::pair<ChMaterialSurface*, ChMaterialSurface*>& p) const {
+            return std::hash<ChMaterialSurface*>()(p.first) ^ (std::hash<ChMaterialSurface*>()(p.second) << 1);
+        }
+    };
+
+    /// Return the composite material for the given pair of materials.
+    /// Composite materials are cached per material pair and the cache is cleared in BeginAddContact().
+    const ChMaterialCompositeSMC& GetCompositeMaterial(const std::shared_ptr<ChMaterialSurface>& mat1,
+                                                       const std::shared_ptr<ChMaterialSurface>& mat2);
+
     void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat);
+
+    std::unordered_map<std::pair<ChMaterialSurface*, ChMaterialSurface*>, ChMaterialCompositeSMC, MaterialPairHash>
+        composite_materials;  ///< cache of composite materials for the current set of contacts
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
@@ -22,6 +22,7 @@
 #include <cmath>
 #include <algorithm>
 #include <limits>
+#include <typeinfo>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/core/ChFrame.h"
@@ -62,7 +63,6 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
 
         // Extract parameters from containing system
         double dT = sys.GetStep();
-        bool use_mat_props = sys.UsingMaterialProperties();
         ChSystemSMC::ContactForceModel contact_model = sys.GetContactForceModel();
         ChSystemSMC::AdhesionForceModel adhesion_model = sys.GetAdhesionForceModel();
         ChSystemSMC::TangentialDisplacementModel tdispl_model = sys.GetTangentialDisplacementModel();
@@ -81,95 +81,32 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
         // All models use the following formulas for normal and tangential forces:
         //     Fn = kn * delta_n - gn * v_n
         //     Ft = kt * delta_t - gt * v_t
-        double kn = 0;
-        double kt = 0;
-        double gn = 0;
-        double gt = 0;
-
-        double eps = std::numeric_limits<double>::epsilon();
-
-        switch (contact_model) {
-            case ChSystemSMC::Flores:
-                // Currently not implemented.  Fall through to Hooke.
-            case ChSystemSMC::Hooke:
-                if (use_mat_props) {
-                    double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
-                    double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
-                    double tmp_g = 1 + std::pow(CH_C_PI / loge, 2);
-                    kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
-                    kt = kn;
-                    gn = std::sqrt(4 * eff_mass * kn / tmp_g);
-                    gt = gn;
-                } else {
-                    kn = mat.kn;
-                    kt = mat.kt;
-                    gn = eff_mass * mat.gn;
-                    gt = eff_mass * mat.gt;
-                }
-
-                break;
-
-            case ChSystemSMC::Hertz:
-                if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(eff_radius * delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double St = 8 * mat.G_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_C_PI * CH_C_PI);
-                    kn = (2.0 / 3) * Sn;
-                    kt = St;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
-                    gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
-                } else {
-                    double tmp = eff_radius * std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    kt = tmp * mat.kt;
-                    gn = tmp * eff_mass * mat.gn;
-                    gt = tmp * eff_mass * mat.gt;
-                }
-
-                break;
-
-            case ChSystemSMC::PlainCoulomb:
-                if (use_mat_props) {
-                    double sqrt_Rd = std::sqrt(delta);
-                    double Sn = 2 * mat.E_eff * sqrt_Rd;
-                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
-                    double beta = loge / std::sqrt(loge * loge + CH_C_PI * CH_C_PI);
-                    kn = (2.0 / 3) * Sn;
-                    gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
-                } else {
-                    double tmp = std::sqrt(delta);
-                    kn = tmp * mat.kn;
-                    gn = tmp * mat.gn;
-                }
-
-                kt = 0;
-                gt = 0;
-
-                {
-                    double forceN = kn * delta - gn * relvel_n_mag;
-                    if (forceN < 0)
-                        forceN = 0;
-                    double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
-                    switch (adhesion_model) {
-                        case ChSystemSMC::AdhesionForceModel::Perko:
-                            // Currently not implemented.  Fall through to Constant.
-                        case ChSystemSMC::AdhesionForceModel::Constant:
-                            forceN -= mat.adhesion_eff;
-                            break;
-                        case ChSystemSMC::AdhesionForceModel::DMT:
-                            forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
-                            break;
-                    }
-                    ChVector<> force = forceN * normal_dir;
-                    if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
-                        force -= (forceT / relvel_t_mag) * relvel_t;
-
-                    return force;
-                }
+        Coefficients coeffs = CalculateCoefficients(sys, mat, delta, eff_radius, eff_mass);
+        double kn = coeffs.kn;
+        double kt = coeffs.kt;
+        double gn = coeffs.gn;
+        double gt = coeffs.gt;
+
+        if (contact_model == ChSystemSMC::PlainCoulomb) {
+            double forceN = kn * delta - gn * relvel_n_mag;
+            if (forceN < 0)
+                forceN = 0;
+            double forceT = mat.mu_eff * std::tanh(5.0 * relvel_t_mag) * forceN;
+            switch (adhesion_model) {
+                case ChSystemSMC::AdhesionForceModel::Perko:
+                    // Currently not implemented.  Fall through to Constant.
+                case ChSystemSMC::AdhesionForceModel::Constant:
+                    forceN -= mat.adhesion_eff;
+                    break;
+                case ChSystemSMC::AdhesionForceModel::DMT:
+                    forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+                    break;
+            }
+            ChVector<> force = forceN * normal_dir;
+            if (relvel_t_mag >= sys.GetSlipVelocityThreshold())
+                force -= (forceT / relvel_t_mag) * relvel_t;
+
+            return force;
         }
 
         // Tangential displacement (magnitude)
@@ -219,6 +156,225 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
 
         return force;
     }
+
+    /// Closed-form Jacobians of the force calculated by CalculateForce.
+    /// The force on obj2 is a function of the separation vector d = p1 - p2 (which defines the overlap delta = |d| and
+    /// the normal direction) and of the relative velocity v = vel2 - vel1. This function returns dF/dd and dF/dv, with
+    /// the contact coefficients differentiated with respect to the overlap for the models in which they depend on it.
+    void CalculateForceJacobians(
+        const ChSystemSMC& sys,             ///< containing system
+        const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+        const ChVector<>& vel1,             ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector<>& vel2,             ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                       ///< overlap in normal direction
+        double eff_radius,                  ///< effective radius of curvature at contact
+        double mass1,                       ///< mass of obj1
+        double mass2,                       ///< mass of obj2
+        ChMatrix33<>& dFdd,                 ///< [output] Jacobian of force w.r.t. separation vector
+        ChMatrix33<>& dFdv                  ///< [output] Jacobian of force w.r.t. relative velocity
+    ) const {
+        dFdd.setZero();
+        dFdv.setZero();
+        if (delta <= 0)
+            return;
+
+        // Extract parameters from containing system
+        double dT = sys.GetStep();
+        ChSystemSMC::ContactForceModel contact_model = sys.GetContactForceModel();
+        ChSystemSMC::AdhesionForceModel adhesion_model = sys.GetAdhesionForceModel();
+        ChSystemSMC::TangentialDisplacementModel tdispl_model = sys.GetTangentialDisplacementModel();
+
+        const ChVector<>& n = normal_dir;
+        ChVector<> relvel = vel2 - vel1;
+        double relvel_n_mag = relvel.Dot(n);
+        ChVector<> relvel_t = relvel - relvel_n_mag * n;
+        double relvel_t_mag = relvel_t.Length();
+
+        double eff_mass = mass1 * mass2 / (mass1 + mass2);
+
+        // Contact coefficients and their exponents in the overlap (kn, kt ~ delta^a and gn, gt ~ delta^b).
+        Coefficients coeffs = CalculateCoefficients(sys, mat, delta, eff_radius, eff_mass);
+        double kn = coeffs.kn;
+        double kt = coeffs.kt;
+        double gn = coeffs.gn;
+        double gt = coeffs.gt;
+        double a = coeffs.a;
+        double b = coeffs.b;
+
+        double adhesion = 0;
+        switch (adhesion_model) {
+            case ChSystemSMC::AdhesionForceModel::Perko:
+            case ChSystemSMC::AdhesionForceModel::Constant:
+                adhesion = mat.adhesion_eff;
+                break;
+            case ChSystemSMC::AdhesionForceModel::DMT:
+                adhesion = mat.adhesionMultDMT_eff * sqrt(eff_radius);
+                break;
+        }
+
+        // Derivatives of the normal direction and of the relative velocity components
+        ChMatrix33<> I3(1);
+        ChMatrix33<> P = I3 - TensorProduct(n, n);                                        // projection on tangent plane
+        ChMatrix33<> dndd = P * (1 / delta);                                              // dn/dd
+        ChMatrix33<> dvtdd = (TensorProduct(n, relvel_t) + relvel_n_mag * P) * (-1 / delta);  // dvt/dd
+        const ChMatrix33<>& dvtdv = P;                                                    // dvt/dv
+
+        // Undamped normal force and its gradients (row vectors, stored as ChVector)
+        double forceN0 = kn * delta - gn * relvel_n_mag;
+        ChVector<> dFn0dd = (kn * (1 + a) - b * gn * relvel_n_mag / delta) * n - (gn / delta) * relvel_t;
+        ChVector<> dFn0dv = -gn * n;
+
+        bool slip = relvel_t_mag >= sys.GetSlipVelocityThreshold();
+        ChVector<> t_dir = slip ? relvel_t / relvel_t_mag : VNULL;
+        ChMatrix33<> dtdvt = slip ? ChMatrix33<>((I3 - TensorProduct(t_dir, t_dir)) * (1 / relvel_t_mag)) : ChMatrix33<>(0.0);
+
+        if (contact_model == ChSystemSMC::PlainCoulomb) {
+            // F = (Fn0+ - adhesion) n - mu tanh(5 |vt|) Fn0+ t
+            double forceNc = std::max(forceN0, 0.0);
+            ChVector<> dFncdd = forceN0 > 0 ? dFn0dd : VNULL;
+            ChVector<> dFncdv = forceN0 > 0 ? dFn0dv : VNULL;
+            double forceN = forceNc - adhesion;
+
+            dFdd = TensorProduct(n, dFncdd) + forceN * dndd;
+            dFdv = TensorProduct(n, dFncdv);
+
+            if (slip) {
+                double th = std::tanh(5.0 * relvel_t_mag);
+                double dth = 5.0 * (1 - th * th);
+                double forceT = mat.mu_eff * th * forceNc;
+                ChVector<> dvtmdd = ChMatrix33<>(dvtdd.transpose()) * t_dir;  // gradient of |vt| w.r.t. d
+                dFdd -= TensorProduct(t_dir, mat.mu_eff * th * dFncdd + mat.mu_eff * forceNc * dth * dvtmdd);
+                dFdd -= forceT * dtdvt * dvtdd;
+                dFdv -= TensorProduct(t_dir, mat.mu_eff * th * dFncdv + mat.mu_eff * forceNc * dth * t_dir);
+                dFdv -= forceT * dtdvt * dvtdv;
+            }
+            return;
+        }
+
+        // If the normal contact force is negative, only the adhesion force remains
+        if (forceN0 < 0) {
+            dFdd = -adhesion * dndd;
+            return;
+        }
+
+        double forceN = forceN0 - adhesion;
+        dFdd = TensorProduct(n, dFn0dd) + forceN * dndd;
+        dFdv = TensorProduct(n, dFn0dv);
+
+        if (!slip)
+            return;
+
+        // Tangential force magnitude Ft = c |vt|, with c = kt * dT + gt
+        double c = gt;
+        double dcdd = b * gt / delta;
+        if (tdispl_model == ChSystemSMC::OneStep || tdispl_model == ChSystemSMC::MultiStep) {
+            c += kt * dT;
+            dcdd += a * kt * dT / delta;
+        }
+
+        if (c * relvel_t_mag <= mat.mu_eff * std::abs(forceN)) {
+            // viscous regime: Ft = -c vt
+            dFdd -= TensorProduct(relvel_t, dcdd * n) + c * dvtdd;
+            dFdv -= c * dvtdv;
+        } else {
+            // Coulomb regime: Ft = -mu |Fn| t
+            double sgn = forceN >= 0 ? 1.0 : -1.0;
+            double forceT = mat.mu_eff * std::abs(forceN);
+            dFdd -= TensorProduct(t_dir, mat.mu_eff * sgn * dFn0dd) + forceT * dtdvt * dvtdd;
+            dFdv -= TensorProduct(t_dir, mat.mu_eff * sgn * dFn0dv) + forceT * dtdvt * dvtdv;
+        }
+    }
+
+  private:
+    /// Stiffness and damping coefficients of the normal and tangential contact forces.
+    /// The stiffness coefficients scale with the overlap as delta^a and the damping coefficients as delta^b.
+    struct Coefficients {
+        double kn;
+        double kt;
+        double gn;
+        double gt;
+        double a;
+        double b;
+    };
+
+    /// Calculate the contact coefficients for the contact force model of the containing system.
+    Coefficients CalculateCoefficients(const ChSystemSMC& sys,
+                                       const ChMaterialCompositeSMC& mat,
+                                       double delta,
+                                       double eff_radius,
+                                       double eff_mass) const {
+        bool use_mat_props = sys.UsingMaterialProperties();
+        double eps = std::numeric_limits<double>::epsilon();
+
+        Coefficients c = {0, 0, 0, 0, 0, 0};
+
+        switch (sys.GetContactForceModel()) {
+            case ChSystemSMC::Flores:
+                // Currently not implemented.  Fall through to Hooke.
+            case ChSystemSMC::Hooke:
+                if (use_mat_props) {
+                    double tmp_k = (16.0 / 15) * std::sqrt(eff_radius) * mat.E_eff;
+                    double v2 = sys.GetCharacteristicImpactVelocity() * sys.GetCharacteristicImpactVelocity();
+                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                    loge = (mat.cr_eff > 1 - eps) ? std::log(1 - eps) : loge;
+                    double tmp_g = 1 + std::pow(CH_C_PI / loge, 2);
+                    c.kn = tmp_k * std::pow(eff_mass * v2 / tmp_k, 1.0 / 5);
+                    c.kt = c.kn;
+                    c.gn = std::sqrt(4 * eff_mass * c.kn / tmp_g);
+                    c.gt = c.gn;
+                } else {
+                    c.kn = mat.kn;
+                    c.kt = mat.kt;
+                    c.gn = eff_mass * mat.gn;
+                    c.gt = eff_mass * mat.gt;
+                }
+                break;
+
+            case ChSystemSMC::Hertz:
+                if (use_mat_props) {
+                    double sqrt_Rd = std::sqrt(eff_radius * delta);
+                    double Sn = 2 * mat.E_eff * sqrt_Rd;
+                    double St = 8 * mat.G_eff * sqrt_Rd;
+                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                    double beta = loge / std::sqrt(loge * loge + CH_C_PI * CH_C_PI);
+                    c.kn = (2.0 / 3) * Sn;
+                    c.kt = St;
+                    c.gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                    c.gt = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(St * eff_mass);
+                    c.b = 0.25;
+                } else {
+                    double tmp = eff_radius * std::sqrt(delta);
+                    c.kn = tmp * mat.kn;
+                    c.kt = tmp * mat.kt;
+                    c.gn = tmp * eff_mass * mat.gn;
+                    c.gt = tmp * eff_mass * mat.gt;
+                    c.b = 0.5;
+                }
+                c.a = 0.5;
+                break;
+
+            case ChSystemSMC::PlainCoulomb:
+                if (use_mat_props) {
+                    double sqrt_Rd = std::sqrt(delta);
+                    double Sn = 2 * mat.E_eff * sqrt_Rd;
+                    double loge = (mat.cr_eff < eps) ? std::log(eps) : std::log(mat.cr_eff);
+                    double beta = loge / std::sqrt(loge * loge + CH_C_PI * CH_C_PI);
+                    c.kn = (2.0 / 3) * Sn;
+                    c.gn = -2 * std::sqrt(5.0 / 6) * beta * std::sqrt(Sn * eff_mass);
+                    c.b = 0.25;
+                } else {
+                    double tmp = std::sqrt(delta);
+                    c.kn = tmp * mat.kn;
+                    c.gn = tmp * mat.gn;
+                    c.b = 0.5;
+                }
+                c.a = 0.5;
+                break;
+        }
+
+        return c;
+    }
 };
 
 /// Class for smooth (penalty-based) contact between two generic contactable objects.
@@ -236,11 +392,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChMatrixDynamic<double> m_R;  ///< R = dQ/dv
     };
 
-    ChVector<> m_force;        ///< contact force on objB
-    ChContactJacobian* m_Jac;  ///< contact Jacobian data
+    ChVector<> m_force;            ///< contact force on objB
+    ChContactJacobian* m_Jac;      ///< contact Jacobian data
+    ChMaterialCompositeSMC m_mat;  ///< composite material for contact pair
+    double m_weight;               ///< number of contacts represented by this contact (force scaling)
 
   public:
-    ChContactSMC() : m_Jac(NULL) {}
+    ChContactSMC() : m_Jac(NULL), m_weight(1) {}
+
+    /// Construct an uninitialized contact in the given container.
+    /// The contact must be initialized with Reset_data() and its force computed with Evaluate().
+    explicit ChContactSMC(ChContactContainer* mcontainer) : m_Jac(NULL), m_weight(1) { this->container = mcontainer; }
 
     ChContactSMC(ChContactContainer* mcontainer,           ///< contact container
                  Ta* mobjA,                                ///< collidable object A
@@ -248,7 +410,7 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
                  const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
                  const ChMaterialCompositeSMC& mat         ///< composite material
                  )
-        : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL) {
+        : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL), m_weight(1) {
         Reset(mobjA, mobjB, cinfo, mat);
     }
 
@@ -273,6 +435,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
                Tb* mobjB,                                ///< collidable object B
                const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
                const ChMaterialCompositeSMC& mat         ///< composite material
+    ) {
+        Reset_data(mobjA, mobjB, cinfo, mat);
+        Evaluate();
+    }
+
+    /// Reinitialize the geometric information and the composite material of this contact, without calculating the
+    /// contact force. The contact force (and Jacobians) must then be calculated with Evaluate().
+    void Reset_data(Ta* mobjA,                                ///< collidable object A
+                    Tb* mobjB,                                ///< collidable object B
+                    const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
+                    const ChMaterialCompositeSMC& mat         ///< composite material
     ) {
         // Reset geometric information
         this->Reset_cinfo(mobjA, mobjB, cinfo);
@@ -280,22 +453,34 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        m_mat = mat;
+        m_weight = cinfo.weight;
+    }
+
+    /// Calculate the contact force and, if the system uses stiff contact, its Jacobian matrices.
+    /// This function only writes data owned by this contact, so it can be called concurrently for different contacts
+    /// (provided the SMC contact force algorithm of the system is thread-safe).
+    void Evaluate() {
         // Calculate contact force.
         m_force = CalculateForce(-this->norm_dist,                            // overlap (here, always positive)
                                  this->normal,                                // normal contact direction
                                  this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
                                  this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
+                                 m_mat                                        // composite material for contact pair
         );
 
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->GetStiffContact()) {
             CreateJacobians();
-            CalculateJacobians(mat);
+            CalculateJacobians(m_mat);
+        } else if (m_Jac) {
+            delete m_Jac;
+            m_Jac = NULL;
         }
     }
 
     /// Calculate contact force, expressed in absolute coordinates.
+    /// The force is scaled by the number of contacts represented by this contact (see ChContactReduction).
     ChVector<> CalculateForce(
         double delta,                      ///< overlap in normal direction
         const ChVector<>& normal_dir,      ///< normal contact direction (expressed in global frame)
@@ -310,14 +495,17 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
 
         // Use current SMC algorithm to calculate the force
         ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
-        return sys->GetContactForceAlgorithm().CalculateForce(*sys,                                        //
-                                                              normal_dir, this->p1, this->p2, vel1, vel2,  //
-                                                              mat,                                         //
-                                                              delta, this->eff_radius,                     //
-                                                              this->objA->GetContactableMass(),            //
-                                                              this->objB->GetContactableMass()             //
+        const ChSystemSMC::ChContactForceSMC& algorithm = sys->GetContactForceAlgorithm();
+        ChVector<> force = algorithm.CalculateForce(*sys,                                        //
+                                                    normal_dir, this->p1, this->p2, vel1, vel2,  //
+                                                    mat,                                         //
+                                                    delta, this->eff_radius,                     //
+                                                    this->objA->GetContactableMass(),            //
+                                                    this->objB->GetContactableMass()             //
         );
 
+        return m_weight * force;
+
         /*
         // Extract parameters from containing system
         ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
@@ -532,10 +720,11 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     }
 
     /// Create the Jacobian matrices.
-    /// These matrices are created/resized as needed.
+    /// These matrices are created/resized as needed. Since the contact container recycles contact objects from one
+    /// step to the next, an existing Jacobian structure is reused (resizing to the same dimensions does not reallocate).
     void CreateJacobians() {
-        delete m_Jac;
-        m_Jac = new ChContactJacobian;
+        if (!m_Jac)
+            m_Jac = new ChContactJacobian;
 
         // Set variables and resize Jacobian matrices.
         // NOTE: currently, only contactable objects derived from ChContactable_1vars<6>,
@@ -564,7 +753,91 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     }
 
     /// Calculate Jacobian of generalized contact forces.
+    /// If the system uses the default SMC contact force algorithm, the Jacobians are evaluated in closed form.
+    /// Otherwise (user-provided contact force algorithm), they are approximated with finite differences.
     void CalculateJacobians(const ChMaterialCompositeSMC& mat) {
+        ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
+        if (typeid(sys->GetContactForceAlgorithm()) == typeid(ChDefaultContactForceSMC))
+            CalculateJacobiansAnalytic(mat);
+        else
+            CalculateJacobiansFD(mat);
+    }
+
+    /// Calculate Jacobian of generalized contact forces, in closed form.
+    /// The generalized forces are Q = G * F, with G = [-J1^T; J2^T] the transpose of the Jacobians of the contact
+    /// point velocities, so that K = G * dF/dd * G^T and R = -G * dF/dv * G^T. For rigid bodies, the term due to the
+    /// rotation of the contact force into the body frame and the terms due to the variation of the contact point
+    /// velocities with the body orientation are also included.
+    void CalculateJacobiansAnalytic(const ChMaterialCompositeSMC& mat) {
+        ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
+        const ChDefaultContactForceSMC& algorithm =
+            static_cast<const ChDefaultContactForceSMC&>(sys->GetContactForceAlgorithm());
+
+        int ndofA_x = this->objA->ContactableGet_ndof_x();
+        int ndofA_w = this->objA->ContactableGet_ndof_w();
+        int ndofB_x = this->objB->ContactableGet_ndof_x();
+        int ndofB_w = this->objB->ContactableGet_ndof_w();
+        ChState stateA_x(ndofA_x, NULL);
+        ChState stateB_x(ndofB_x, NULL);
+        ChStateDelta stateA_w(ndofA_w, NULL);
+        ChStateDelta stateB_w(ndofB_w, NULL);
+        this->objA->ContactableGetStateBlock_x(stateA_x);
+        this->objB->ContactableGetStateBlock_x(stateB_x);
+        this->objA->ContactableGetStateBlock_w(stateA_w);
+        this->objB->ContactableGetStateBlock_w(stateB_w);
+
+        // Jacobians of the force on objB w.r.t. separation vector (p1 - p2) and relative velocity
+        ChMatrix33<> dFdd;
+        ChMatrix33<> dFdv;
+        algorithm.CalculateForceJacobians(*sys, this->normal,                                     //
+                                          this->objA->GetContactPointSpeed(this->p1),             //
+                                          this->objB->GetContactPointSpeed(this->p2),             //
+                                          mat, -this->norm_dist, this->eff_radius,                //
+                                          this->objA->GetContactableMass(),                       //
+                                          this->objB->GetContactableMass(),                       //
+                                          dFdd, dFdv);
+        dFdd *= m_weight;
+        dFdv *= m_weight;
+
+        // Map from contact force (on objB) to generalized forces, one column per force component
+        ChMatrixDynamic<double> G(ndofA_w + ndofB_w, 3);
+        ChVectorDynamic<> Qk(ndofA_w + ndofB_w);
+        for (int k = 0; k < 3; k++) {
+            ChVector<> ek(0, 0, 0);
+            ek[k] = 1;
+            Qk.setZero();
+            this->objA->ContactForceLoadQ(-ek, this->p1, stateA_x, Qk, 0);
+            this->objB->ContactForceLoadQ(ek, this->p2, stateB_x, Qk, ndofA_w);
+            G.col(k) = Qk;
+        }
+
+        ChMatrixDynamic<double> GFd = G * dFdd;
+        ChMatrixDynamic<double> GFv = G * dFdv;
+        m_Jac->m_K.noalias() = GFd * G.transpose();
+        m_Jac->m_R.noalias() = -GFv * G.transpose();
+
+        // Geometric stiffness of rigid bodies: the torque r x f is evaluated with the force f expressed in the
+        // (rotating) body frame, which contributes -[r x][f x] to the rotational block of K.
+        if (ndofA_x == 7 && ndofA_w == 6)
+            AddRotationalStiffness(stateA_x, this->p1, -m_force, 3);
+        if (ndofB_x == 7 && ndofB_w == 6)
+            AddRotationalStiffness(stateB_x, this->p2, m_force, ndofA_w + 3);
+
+        // Velocity stiffness of rigid bodies: the velocity of a contact point rotates with the body, so the relative
+        // velocity (and hence the force) also depends on the body orientation.
+        if ((ndofA_x == 7 && ndofA_w == 6) || (ndofB_x == 7 && ndofB_w == 6)) {
+            ChMatrixDynamic<double> dvdx(3, ndofA_w + ndofB_w);  // derivative of relative velocity w.r.t. positions
+            dvdx.setZero();
+            if (ndofA_x == 7 && ndofA_w == 6)
+                dvdx.block(0, 3, 3, 3) = -ContactPointSpeedDerivative(stateA_x, stateA_w, this->p1);
+            if (ndofB_x == 7 && ndofB_w == 6)
+                dvdx.block(0, ndofA_w + 3, 3, 3) = ContactPointSpeedDerivative(stateB_x, stateB_w, this->p2);
+            m_Jac->m_K.noalias() -= GFv * dvdx;
+        }
+    }
+
+    /// Calculate Jacobian of generalized contact forces, using finite differences.
+    void CalculateJacobiansFD(const ChMaterialCompositeSMC& mat) {
         // Compute a finite-difference approximations to the Jacobians of the contact forces and
         // load dQ/dx into m_Jac->m_K and dQ/dw into m_Jac->m_R.
         // Note that we only calculate these Jacobians whenever the contact force itself is calculated,
@@ -636,6 +909,31 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         }
     }
 
+  private:
+    /// Add the rotational stiffness of a rigid body (with state x = [pos, rot]) to which the force F is applied at
+    /// the point P (both in absolute frame). The rotational block of K starts at the given offset.
+    void AddRotationalStiffness(const ChState& state_x, const ChVector<>& P, const ChVector<>& F, int offset) {
+        ChCoordsys<> csys(state_x.segment(0, 7));
+        ChVector<> r_loc = csys.TransformPointParentToLocal(P);
+        ChVector<> f_loc = csys.TransformDirectionParentToLocal(F);
+        ChStarMatrix33<> r_tilde(r_loc);
+        ChStarMatrix33<> f_tilde(f_loc);
+        m_Jac->m_K.block(offset, offset, 3, 3) -= r_tilde * f_tilde;
+    }
+
+    /// Derivative of the velocity of a point P (in absolute frame) fixed to a rigid body, with state x = [pos, rot] and
+    /// w = [vel, local angular velocity], w.r.t. a local rotation increment of the body.
+    /// The point velocity is v + R*(w_loc x r_loc), so its derivative is -R*[(w_loc x r_loc) x].
+    ChMatrix33<> ContactPointSpeedDerivative(const ChState& state_x, const ChStateDelta& state_w, const ChVector<>& P) {
+        ChCoordsys<> csys(state_x.segment(0, 7));
+        ChVector<> r_loc = csys.TransformPointParentToLocal(P);
+        ChVector<> w_loc(state_w.segment(3, 3));
+        ChMatrix33<> R(csys.rot);
+        ChStarMatrix33<> v_tilde(Vcross(w_loc, r_loc));
+        return ChMatrix33<>(-R * v_tilde);
+    }
+
+  public:
     /// Apply contact forces to the two objects.
     /// (new version, for interfacing to ChTimestepper and ChIntegrable)
     virtual void ContIntLoadResidual_F(ChVectorDynamic<>& R, const double c) override {
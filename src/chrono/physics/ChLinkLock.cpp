@@ -24,7 +24,14 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChLinkLock)
 
-ChLinkLock::ChLinkLock() : type(LinkType::FREE), ndoc(0), ndoc_c(0), ndoc_d(0), d_restlength(0) {
+ChLinkLock::ChLinkLock()
+    : type(LinkType::FREE),
+      ndoc(0),
+      ndoc_c(0),
+      ndoc_d(0),
+      d_restlength(0),
+      fixed_type(false),
+      state_kernel(nullptr) {
     // Need to zero out the bottom-right 4x3 block
     Cq1_temp.setZero();
     Cq2_temp.setZero();
@@ -60,6 +67,9 @@ ChLinkLock::ChLinkLock(const ChLinkLock& other) : ChLinkMarkers(other) {
 
     Ct_temp = other.Ct_temp;
 
+    fixed_type = other.fixed_type;
+    state_kernel = nullptr;
+
     BuildLinkType(other.type);
 }
 
@@ -273,6 +283,61 @@ void ChLinkLock::BuildLink() {
     // Need to zero out the first 3 entries in rows corrsponding to rotation constraints
     Cq1.setZero();
     Cq2.setZero();
+
+    // Select the UpdateState kernel specialized for the active constraints (standard joint types only)
+    state_kernel = nullptr;
+    if (!fixed_type || mask.Constr_E0().IsActive())
+        return;
+
+    int active = (mask.Constr_X().IsActive() << 5) | (mask.Constr_Y().IsActive() << 4) |
+                 (mask.Constr_Z().IsActive() << 3) | (mask.Constr_E1().IsActive() << 2) |
+                 (mask.Constr_E2().IsActive() << 1) | (mask.Constr_E3().IsActive() << 0);
+    switch (active) {
+        case 0b000000:  // FREE
+            SetFixedKernel<false, false, false, false, false, false>();
+            break;
+        case 0b111111:  // LOCK
+            SetFixedKernel<true, true, true, true, true, true>();
+            break;
+        case 0b111000:  // SPHERICAL
+            SetFixedKernel<true, true, true, false, false, false>();
+            break;
+        case 0b001000:  // POINTPLANE
+            SetFixedKernel<false, false, true, false, false, false>();
+            break;
+        case 0b011000:  // POINTLINE
+            SetFixedKernel<false, true, true, false, false, false>();
+            break;
+        case 0b111110:  // REVOLUTE
+            SetFixedKernel<true, true, true, true, true, false>();
+            break;
+        case 0b110110:  // CYLINDRICAL
+            SetFixedKernel<true, true, false, true, true, false>();
+            break;
+        case 0b110111:  // PRISMATIC
+            SetFixedKernel<true, true, false, true, true, true>();
+            break;
+        case 0b001110:  // PLANEPLANE
+            SetFixedKernel<false, false, true, true, true, false>();
+            break;
+        case 0b001111:  // OLDHAM
+            SetFixedKernel<false, false, true, true, true, true>();
+            break;
+        case 0b000111:  // ALIGN
+            SetFixedKernel<false, false, false, true, true, true>();
+            break;
+        case 0b000110:  // PARALLEL
+            SetFixedKernel<false, false, false, true, true, false>();
+            break;
+        case 0b000101:  // PERPEND
+            SetFixedKernel<false, false, false, true, false, true>();
+            break;
+        case 0b011110:  // REVOLUTEPRISMATIC
+            SetFixedKernel<false, true, true, true, true, false>();
+            break;
+        default:
+            break;
+    }
 }
 
 void ChLinkLock::BuildLink(bool x, bool y, bool z, bool e0, bool e1, bool e2, bool e3) {
@@ -335,6 +400,7 @@ void ChLinkLock::BuildLinkType(LinkType link_type) {
 }
 
 void ChLinkLock::ChangeLinkType(LinkType new_link_type) {
+    fixed_type = true;
     BuildLinkType(new_link_type);
 
     limit_X.reset(nullptr);
@@ -366,6 +432,12 @@ void ChLinkLock::Update(double time, bool update_assets) {
 
 // Updates Cq1_temp, Cq2_temp, Qc_temp, etc., i.e. all LOCK-FORMULATION temp.matrices
 void ChLinkLock::UpdateState() {
+    // Joint limits use the full lock jacobians (see ConstraintsLoadJacobians)
+    if (state_kernel && !limit_X && !limit_Y && !limit_Z && !limit_Rx && !limit_Ry && !limit_Rz) {
+        (this->*state_kernel)();
+        return;
+    }
+
     // ----------- SOME PRECALCULATED VARIABLES, to optimize speed
 
     ChStarMatrix33<> P1star(marker1->GetCoord().pos);  // [P] star matrix of rel pos of mark1
@@ -586,6 +658,160 @@ void ChLinkLock::UpdateCqw() {
     Transform_Cq_to_Cqw(Cq2, Cqw2, Body2);
 }
 
+// -----------------------------------------------------------------------------
+// UpdateState kernels specialized for the active constraints of the standard joint types.
+// These evaluate the same expressions as the generic UpdateState, but skip the translational or rotational part if
+// there are no such active constraints and write the active rows directly. Jacobian blocks are evaluated in place if
+// possible, otherwise in Cq1_temp and Cq2_temp; Qc_temp and Ct_temp are not set.
+
+template <bool X, bool Y, bool Z, bool E1, bool E2, bool E3>
+void ChLinkLock::SetFixedKernel() {
+    state_kernel = &ChLinkLock::UpdateStateFixed<X, Y, Z, E1, E2, E3>;
+}
+
+template <bool X, bool Y, bool Z, bool E1, bool E2, bool E3>
+void ChLinkLock::UpdateStateFixed() {
+    // Rows of the active constraints
+    constexpr int iX = 0;
+    constexpr int iY = iX + X;
+    constexpr int iZ = iY + Y;
+    constexpr int iE1 = iZ + Z;
+    constexpr int iE2 = iE1 + E1;
+    constexpr int iE3 = iE2 + E2;
+
+    if (X || Y || Z) {
+        ChStarMatrix33<> P1star(marker1->GetCoord().pos);
+        ChStarMatrix33<> Q2star(marker2->GetCoord().pos);
+
+        ChGlMatrix34<> body1Gl(Body1->GetCoord().rot);
+        ChGlMatrix34<> body2Gl(Body2->GetCoord().rot);
+
+        ChMatrix33<> m2_Rel_A_dt;
+        marker2->Compute_Adt(m2_Rel_A_dt);
+
+        ChVector<> Ct_pos =
+            m2_Rel_A_dt.transpose() * (Body2->GetA().transpose() * PQw) +
+            marker2->GetA().transpose() *
+                (Body2->GetA().transpose() * (Body1->GetA() * marker1->GetCoord_dt().pos) - marker2->GetCoord_dt().pos);
+
+        ChMatrix33<> CqxT = marker2->GetA().transpose() * Body2->GetA().transpose();
+        ChStarMatrix33<> tmpStar(Body2->GetA().transpose() * PQw);
+
+        if (X && Y && Z) {
+            Cq1.block<3, 3>(0, 0) = CqxT;
+            Cq2.block<3, 3>(0, 0) = -CqxT;
+            Cq1.block<3, 4>(0, 3) = -CqxT * Body1->GetA() * P1star * body1Gl;
+            Cq2.block<3, 4>(0, 3) = CqxT * Body2->GetA() * Q2star * body2Gl +  //
+                                    marker2->GetA().transpose() * tmpStar * body2Gl;
+        } else {
+            Cq1_temp.topRightCorner<3, 4>() = -CqxT * Body1->GetA() * P1star * body1Gl;
+            Cq2_temp.topRightCorner<3, 4>() = CqxT * Body2->GetA() * Q2star * body2Gl +  //
+                                              marker2->GetA().transpose() * tmpStar * body2Gl;
+            if (X) {
+                Cq1.block<1, 3>(iX, 0) = CqxT.row(0);
+                Cq2.block<1, 3>(iX, 0) = -CqxT.row(0);
+                Cq1.block<1, 4>(iX, 3) = Cq1_temp.block<1, 4>(0, 3);
+                Cq2.block<1, 4>(iX, 3) = Cq2_temp.block<1, 4>(0, 3);
+            }
+            if (Y) {
+                Cq1.block<1, 3>(iY, 0) = CqxT.row(1);
+                Cq2.block<1, 3>(iY, 0) = -CqxT.row(1);
+                Cq1.block<1, 4>(iY, 3) = Cq1_temp.block<1, 4>(1, 3);
+                Cq2.block<1, 4>(iY, 3) = Cq2_temp.block<1, 4>(1, 3);
+            }
+            if (Z) {
+                Cq1.block<1, 3>(iZ, 0) = CqxT.row(2);
+                Cq2.block<1, 3>(iZ, 0) = -CqxT.row(2);
+                Cq1.block<1, 4>(iZ, 3) = Cq1_temp.block<1, 4>(2, 3);
+                Cq2.block<1, 4>(iZ, 3) = Cq2_temp.block<1, 4>(2, 3);
+            }
+        }
+
+        ChVector<> Qcx;
+        ChVector<> vtemp1;
+        ChVector<> vtemp2;
+
+        vtemp1 = Vcross(Body1->GetWvel_loc(), Vcross(Body1->GetWvel_loc(), marker1->GetCoord().pos));
+        vtemp1 = Vadd(vtemp1, marker1->GetCoord_dtdt().pos);
+        vtemp1 = Vadd(vtemp1, Vmul(Vcross(Body1->GetWvel_loc(), marker1->GetCoord_dt().pos), 2));
+
+        vtemp2 = Vcross(Body2->GetWvel_loc(), Vcross(Body2->GetWvel_loc(), marker2->GetCoord().pos));
+        vtemp2 = Vadd(vtemp2, marker2->GetCoord_dtdt().pos);
+        vtemp2 = Vadd(vtemp2, Vmul(Vcross(Body2->GetWvel_loc(), marker2->GetCoord_dt().pos), 2));
+
+        Qcx = CqxT * (Body1->GetA() * vtemp1 - Body2->GetA() * vtemp2);
+
+        ChStarMatrix33<> mtemp1(Body2->GetWvel_loc());
+        ChMatrix33<> mtemp3 = Body2->GetA() * mtemp1 * mtemp1;
+        vtemp2 = marker2->GetA().transpose() * (mtemp3.transpose() * PQw);
+        Qcx = Vadd(Qcx, vtemp2);
+        Qcx = Vadd(Qcx, q_4);
+
+        if (X) {
+            Qc(iX) = -Qcx.x();
+            C(iX) = relM.pos.x();
+            C_dt(iX) = relM_dt.pos.x();
+            C_dtdt(iX) = relM_dtdt.pos.x();
+            Ct(iX) = Ct_pos.x();
+        }
+        if (Y) {
+            Qc(iY) = -Qcx.y();
+            C(iY) = relM.pos.y();
+            C_dt(iY) = relM_dt.pos.y();
+            C_dtdt(iY) = relM_dtdt.pos.y();
+            Ct(iY) = Ct_pos.y();
+        }
+        if (Z) {
+            Qc(iZ) = -Qcx.z();
+            C(iZ) = relM.pos.z();
+            C_dt(iZ) = relM_dt.pos.z();
+            C_dtdt(iZ) = relM_dtdt.pos.z();
+            Ct(iZ) = Ct_pos.z();
+        }
+    }
+
+    if (E1 || E2 || E3) {
+        ChStarMatrix44<> stempQ1(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
+        ChStarMatrix44<> stempQ2(marker1->GetCoord().rot);
+        stempQ2.semiTranspose();
+        Cq1_temp.bottomRightCorner<4, 4>() = stempQ1 * stempQ2;
+
+        ChStarMatrix44<> stempQ3(Qconjugate(marker2->GetCoord().rot));
+        ChStarMatrix44<> stempQ4(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
+        stempQ4.semiTranspose();
+        stempQ4.semiNegate();
+        Cq2_temp.bottomRightCorner<4, 4>() = stempQ3 * stempQ4;
+
+        if (E1) {
+            Cq1.block<1, 4>(iE1, 3) = Cq1_temp.block<1, 4>(4, 3);
+            Cq2.block<1, 4>(iE1, 3) = Cq2_temp.block<1, 4>(4, 3);
+            Qc(iE1) = -q_8.e1();
+            C(iE1) = relM.rot.e1();
+            C_dt(iE1) = relM_dt.rot.e1();
+            C_dtdt(iE1) = relM_dtdt.rot.e1();
+            Ct(iE1) = q_AD.e1();
+        }
+        if (E2) {
+            Cq1.block<1, 4>(iE2, 3) = Cq1_temp.block<1, 4>(5, 3);
+            Cq2.block<1, 4>(iE2, 3) = Cq2_temp.block<1, 4>(5, 3);
+            Qc(iE2) = -q_8.e2();
+            C(iE2) = relM.rot.e2();
+            C_dt(iE2) = relM_dt.rot.e2();
+            C_dtdt(iE2) = relM_dtdt.rot.e2();
+            Ct(iE2) = q_AD.e2();
+        }
+        if (E3) {
+            Cq1.block<1, 4>(iE3, 3) = Cq1_temp.block<1, 4>(6, 3);
+            Cq2.block<1, 4>(iE3, 3) = Cq2_temp.block<1, 4>(6, 3);
+            Qc(iE3) = -q_8.e3();
+            C(iE3) = relM.rot.e3();
+            C_dt(iE3) = relM_dt.rot.e3();
+            C_dtdt(iE3) = relM_dtdt.rot.e3();
+            Ct(iE3) = q_AD.e3();
+        }
+    }
+}
+
 // Override UpdateForces to include possible contributions from joint limits.
 void ChLinkLock::UpdateForces(double mytime) {
     ChLinkMarkers::UpdateForces(mytime);
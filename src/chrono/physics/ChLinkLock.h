@@ -140,6 +140,9 @@ class ChApi ChLinkLock : public ChLinkMarkers {
 
     /// Given current time and body state, computes the constraint differentiation to get the the state matrices Cq1,
     /// Cq2,  Qc,  Ct , and also C, C_dt, C_dtd.
+    /// For the standard joint types (and in the absence of joint limits), this uses a kernel specialized at compile
+    /// time for the set of active constraints. Otherwise, the full 7-row lock jacobians are computed and the rows of
+    /// the active constraints extracted.
     virtual void UpdateState();
 
     /// Updates the local F, M forces adding penalties from ChLinkLimit objects, if any.
@@ -234,7 +237,11 @@ class ChApi ChLinkLock : public ChLinkMarkers {
     ChMatrixNM<double, 7, BODY_QDOF> Cq1_temp;  //
     ChMatrixNM<double, 7, BODY_QDOF> Cq2_temp;  //   the temporary "lock" jacobians,
     ChVectorN<double, 7> Qc_temp;               //   i.e. the full x,y,z,r0,r1,r2,r3 joint
-    Coordsys Ct_temp;                           //
+    Coordsys Ct_temp;                           //   (not all set by the specialized kernels)
+
+    // Kernel specialized for the active constraints of a standard joint type (see BuildLink)
+    bool fixed_type;                     ///< true if the link type was set through ChangeLinkType
+    void (ChLinkLock::*state_kernel)();  ///< specialized UpdateState (nullptr if not available)
 
   public:
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -288,6 +295,15 @@ class ChApi ChLinkLock : public ChLinkMarkers {
     virtual void ConstraintsFetch_react(double factor = 1) override;
 
     friend class ChConveyor;
+
+  private:
+    /// Select the specialized UpdateState kernel for the given set of active constraints.
+    template <bool X, bool Y, bool Z, bool E1, bool E2, bool E3>
+    void SetFixedKernel();
+
+    /// UpdateState for the given set of active constraints, without the full lock jacobians.
+    template <bool X, bool Y, bool Z, bool E1, bool E2, bool E3>
+    void UpdateStateFixed();
 };
 
 CH_CLASS_VERSION(ChLinkLock, 0)
@@ -15,6 +15,9 @@
 #ifndef CHLOAD_H
 #define CHLOAD_H
 
+#include <algorithm>
+#include <type_traits>
+
 #include "chrono/physics/ChLoader.h"
 #include "chrono/physics/ChLoaderU.h"
 #include "chrono/physics/ChLoaderUV.h"
@@ -181,7 +184,9 @@ class ChLoad : public ChLoadBase {
                           ) override;
 
     /// Compute jacobians (default fallback).
-    /// Uses a numerical differentiation for computing K, R, M jacobians, if stiff load.
+    /// If the loader supports automatic differentiation (see ChLoaderSupportsAD) and the loadable has no rotational
+    /// coordinates (same number of position and speed coordinates), K and R are evaluated exactly with forward-mode AD.
+    /// Otherwise, uses a numerical differentiation for computing K, R, M jacobians, if stiff load.
     /// If possible, override this with an analytical jacobian.
     /// Compute the K=-dQ/dx, R=-dQ/dv , M=-dQ/da jacobians.
     /// Note the sign that is flipped because assuming Q a right hand side, and dQ/d... at left hand side!
@@ -193,6 +198,22 @@ class ChLoad : public ChLoadBase {
                                  ChMatrixRef mM          ///< result -dQ/da
                                  ) override;
 
+    /// Compute the K and R jacobians by finite differences (backward differentiation).
+    void ComputeJacobianFD(ChState* state_x,      ///< state position to evaluate jacobians
+                           ChStateDelta* state_w  ///< state speed to evaluate jacobians
+    );
+
+    /// Compute the K and R jacobians by forward-mode automatic differentiation.
+    /// All position and speed coordinates are seeded together, in sweeps of ChLoad::num_AD_directions directions.
+    /// Requires a loader with AD support and a loadable with the same number of position and speed coordinates.
+    /// Returns false, leaving the jacobians unchanged, if the loader cannot differentiate the load on this loadable.
+    bool ComputeJacobianAD(ChState* state_x,      ///< state position to evaluate jacobians
+                           ChStateDelta* state_w  ///< state speed to evaluate jacobians
+    );
+
+    /// Number of directions differentiated in one sweep of ComputeJacobianAD.
+    static const int num_AD_directions = 8;
+
     virtual void LoadIntLoadResidual_F(ChVectorDynamic<>& R, double c) override;
 
     /// Default fallback: compute jacobians via ComputeJacobian(), then use  M=-dQ/da  to do R += c*M*w.
@@ -209,6 +230,10 @@ class ChLoad : public ChLoadBase {
     /// Create the jacobian loads if needed, and also
     /// set the ChVariables referenced by the sparse KRM block.
     virtual void CreateJacobianMatrices() override;
+
+  private:
+    void ComputeJacobianImpl(ChState* state_x, ChStateDelta* state_w, std::true_type);
+    void ComputeJacobianImpl(ChState* state_x, ChStateDelta* state_w, std::false_type);
 };
 
 // -----------------------------------------------------------------------------
@@ -373,6 +398,67 @@ inline void ChLoad<Tloader>::ComputeJacobian(ChState* state_x,
                                              ChMatrixRef mK,
                                              ChMatrixRef mR,
                                              ChMatrixRef mM) {
+    ComputeJacobianImpl(state_x, state_w, ChLoaderSupportsAD<Tloader>());
+}
+
+template <class Tloader>
+inline void ChLoad<Tloader>::ComputeJacobianImpl(ChState* state_x, ChStateDelta* state_w, std::true_type) {
+    if (this->LoadGet_ndof_x() != this->LoadGet_ndof_w() || !ComputeJacobianAD(state_x, state_w))
+        ComputeJacobianFD(state_x, state_w);
+}
+
+template <class Tloader>
+inline void ChLoad<Tloader>::ComputeJacobianImpl(ChState* state_x, ChStateDelta* state_w, std::false_type) {
+    ComputeJacobianFD(state_x, state_w);
+}
+
+template <class Tloader>
+inline bool ChLoad<Tloader>::ComputeJacobianAD(ChState* state_x, ChStateDelta* state_w) {
+    typedef ChDual<num_AD_directions> Tdual;
+    const int num_dirs = num_AD_directions;
+
+    int mrows_w = this->LoadGet_ndof_w();
+    int mrows_x = this->LoadGet_ndof_x();
+    assert(mrows_x == mrows_w);
+
+    ChVectorDynamic<Tdual> x_ad(mrows_x);
+    ChVectorDynamic<Tdual> w_ad(mrows_w);
+    ChMatrixDynamic<> dQ;
+
+    // Directions 0...mrows_w-1 correspond to positions, directions mrows_w...2*mrows_w-1 to speeds.
+    // Process these in sweeps of num_AD_directions directions each.
+    for (int start = 0; start < 2 * mrows_w; start += num_dirs) {
+        int count = std::min(num_dirs, 2 * mrows_w - start);
+
+        for (int i = 0; i < mrows_x; ++i)
+            x_ad(i) = Tdual((*state_x)(i));
+        for (int i = 0; i < mrows_w; ++i)
+            w_ad(i) = Tdual((*state_w)(i));
+        for (int k = 0; k < count; ++k) {
+            int j = start + k;
+            if (j < mrows_w)
+                x_ad(j).deriv(k) = 1;
+            else
+                w_ad(j - mrows_w).deriv(k) = 1;
+        }
+
+        if (!this->loader.template ComputeQ_AD<Tloader>(state_x, state_w, x_ad, w_ad, dQ))
+            return false;
+
+        for (int k = 0; k < count; ++k) {
+            int j = start + k;
+            if (j < mrows_w)
+                this->jacobians->K.col(j) = -dQ.col(k);  // - sign because K=-dQ/dx
+            else
+                this->jacobians->R.col(j - mrows_w) = -dQ.col(k);  // - sign because R=-dQ/dv
+        }
+    }
+
+    return true;
+}
+
+template <class Tloader>
+inline void ChLoad<Tloader>::ComputeJacobianFD(ChState* state_x, ChStateDelta* state_w) {
     double Delta = 1e-8;
 
     int mrows_w = this->LoadGet_ndof_w();
@@ -70,6 +70,11 @@ class ChApi ChLoadable {
 
     /// Get the pointers to the contained ChVariables, appending to the mvars vector.
     virtual void LoadableGetVariables(std::vector<ChVariables*>& mvars) = 0;
+
+    /// Return true if the shape functions N and the det[J] used in ComputeNF do not depend on the current state (for
+    /// example, if they are evaluated in the reference configuration). Loaders with automatic differentiation support
+    /// differentiate only their load F and rely on this to produce exact Jacobians (see ChLoaderSupportsAD).
+    virtual bool IsNFStateIndependent() { return false; }
 };
 
 /// Interface for objects that can be subject to volume loads,
@@ -133,6 +138,15 @@ class ChApi ChLoadableUV : virtual public ChLoadable {
     /// Normal must be considered pointing outside in case the surface is a boundary to a volume.
     virtual ChVector<> ComputeNormal(const double U, const double V) = 0;
 
+    /// Compute the 3 x ndof_x matrices Tu and Tv that map the position coordinates x of this object to the surface
+    /// tangents at U,V, i.e. dr/du = Tu*x and dr/dv = Tv*x, with the parametrization used in ComputeNF (so that the
+    /// normal times det[J] is dr/du x dr/dv). Used by follower loads (e.g. ChLoaderPressure) to differentiate the
+    /// surface orientation. Only objects with a position field linear in their coordinates can provide these maps;
+    /// the default implementation returns false.
+    virtual bool ComputeTangentMaps(const double U, const double V, ChMatrixDynamic<>& Tu, ChMatrixDynamic<>& Tv) {
+        return false;
+    }
+
     /// If true, use quadrature over u,v in [0..1] range as triangle area coords (with z=1-u-v)
     /// otherwise use default quadrature over u,v in [-1..+1] as rectangular isoparametric coords.
     virtual bool IsTriangleIntegrationNeeded() { return false; }
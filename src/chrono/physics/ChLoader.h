@@ -13,6 +13,9 @@
 #ifndef CHLOADER_H
 #define CHLOADER_H
 
+#include <type_traits>
+
+#include "chrono/core/ChDual.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChQuadrature.h"
 #include "chrono/physics/ChLoadable.h"
@@ -39,8 +42,60 @@ class ChLoader {
     virtual std::shared_ptr<ChLoadable> GetLoadable() = 0;
 
     virtual bool IsStiff() { return false; }
+
+  protected:
+    /// Accumulate the contribution of one integration point to Q and to its derivatives dQ, given the value and the
+    /// derivatives of the load F (of dual type) at that point. Since N'*F is linear in F, the function NF (which must
+    /// compute N'*F and detJ for a given F) is applied to the value of F and, in turn, to each of its derivatives.
+    template <class Tdual, class Tnf>
+    static void AccumulateNF(const ChVectorDynamic<Tdual>& F_ad,
+                             double weight,
+                             Tnf&& NF,
+                             ChVectorDynamic<>& Q,
+                             ChMatrixDynamic<>& dQ) {
+        ChVectorDynamic<> mF(F_ad.size());
+        ChVectorDynamic<> mNF(Q.size());
+        double detJ;
+
+        for (int i = 0; i < F_ad.size(); i++)
+            mF(i) = F_ad(i).value();
+        mNF.setZero();
+        NF(mF, mNF, detJ);
+        Q += mNF * (detJ * weight);
+
+        for (int k = 0; k < Tdual::dim; k++) {
+            for (int i = 0; i < F_ad.size(); i++)
+                mF(i) = F_ad(i).deriv(k);
+            mNF.setZero();
+            NF(mF, mNF, detJ);
+            dQ.col(k) += mNF * (detJ * weight);
+        }
+    }
 };
 
+/// Type trait indicating whether the loader Tloader supports evaluation of its Jacobians with forward-mode automatic
+/// differentiation (see ChLoad). A loader opts in by declaring
+/// <pre>
+///    static const bool AD_enabled = true;
+/// </pre>
+/// and by implementing a template version of ComputeF, named ComputeF_AD, with the same parametric coordinates but
+/// with the load F and the states of templated scalar type:
+/// <pre>
+///    template <typename Real>
+///    void ComputeF_AD(const double U, [V, W,] ChVectorDynamic<Real>& F,
+///                     const ChVectorDynamic<Real>& state_x, const ChVectorDynamic<Real>& state_w);
+/// </pre>
+/// The virtual ComputeF can then simply forward to ComputeF_AD<double>. Only the dependency of F on the states is
+/// differentiated, so the default AD evaluation is used only for loadables whose shape functions and det[J] do not
+/// depend on the state (see ChLoadable::IsNFStateIndependent); otherwise ChLoad falls back to finite differences.
+/// Loaders whose load depends on the geometry of the loadable (e.g. ChLoaderPressure) can instead provide their own
+/// ComputeQ_AD.
+template <class Tloader, class = void>
+struct ChLoaderSupportsAD : std::false_type {};
+
+template <class Tloader>
+struct ChLoaderSupportsAD<Tloader, typename std::enable_if<Tloader::AD_enabled>::type> : std::true_type {};
+
 }  // end namespace chrono
 
 #endif
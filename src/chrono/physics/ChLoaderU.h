@@ -78,6 +78,41 @@ class ChLoaderUdistributed : public ChLoaderU {
             Q += mNF;
         }
     }
+
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number states x_ad and w_ad.
+    /// Tloader is the actual loader type, which must implement ComputeF_AD (see ChLoaderSupportsAD).
+    /// Returns false, without computing anything, if the loadable does not have state-independent N and det[J].
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        if (!loadable->IsNFStateIndependent())
+            return false;
+
+        assert(GetIntegrationPointsU() <= ChQuadrature::GetStaticTables()->Lroots.size());
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+
+        const std::vector<double>& Ulroots = ChQuadrature::GetStaticTables()->Lroots[GetIntegrationPointsU() - 1];
+        const std::vector<double>& Uweight = ChQuadrature::GetStaticTables()->Weight[GetIntegrationPointsU() - 1];
+
+        for (unsigned int iu = 0; iu < Ulroots.size(); iu++) {
+            F_ad.setZero();
+            static_cast<Tloader*>(this)->ComputeF_AD(Ulroots[iu], F_ad, x_ad, w_ad);
+            AccumulateNF(
+                F_ad, Uweight[iu],
+                [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                    loadable->ComputeNF(Ulroots[iu], NF, detJ, F, state_x, state_w);
+                },
+                Q, dQ);
+        }
+
+        return true;
+    }
 };
 
 /// Class of loaders for ChLoadableU objects (which support line loads) of atomic type,
@@ -105,6 +140,35 @@ class ChLoaderUatomic : public ChLoaderU {
         loadable->ComputeNF(Pu, Q, detJ, mF, state_x, state_w);
     }
 
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number states x_ad and w_ad.
+    /// Tloader is the actual loader type, which must implement ComputeF_AD (see ChLoaderSupportsAD).
+    /// Returns false, without computing anything, if the loadable does not have state-independent N and det[J].
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        if (!loadable->IsNFStateIndependent())
+            return false;
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+        F_ad.setZero();
+
+        static_cast<Tloader*>(this)->ComputeF_AD(Pu, F_ad, x_ad, w_ad);
+        AccumulateNF(
+            F_ad, 1.0,
+            [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                loadable->ComputeNF(Pu, NF, detJ, F, state_x, state_w);
+                detJ = 1;  // no integration for atomic loads
+            },
+            Q, dQ);
+
+        return true;
+    }
+
     /// Set the position, on the surface where the atomic load is applied
     void SetApplication(double mu) { Pu = mu; }
 };
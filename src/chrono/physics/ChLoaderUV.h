@@ -61,6 +61,56 @@ class ChLoaderUVdistributed : public ChLoaderUV {
         ChVectorDynamic<> mF(loadable->Get_field_ncoords());
         mF.setZero();
 
+        ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
+
+        // Gauss quadrature :  Q = sum (N'*F*detJ * wi*wj)
+        ForEachIntegrationPoint([&](double U, double V, double weight) {
+            double detJ;
+            // Compute F= F(u,v)
+            this->ComputeF(U, V, mF, state_x, state_w);
+            // Compute mNF= N(u,v)'*F
+            loadable->ComputeNF(U, V, mNF, detJ, mF, state_x, state_w);
+            // Compute Q+= mNF detJ * wi*wj
+            mNF *= (detJ * weight);
+            Q += mNF;
+        });
+    }
+
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number states x_ad and w_ad.
+    /// Tloader is the actual loader type, which must implement ComputeF_AD (see ChLoaderSupportsAD).
+    /// Returns false, without computing anything, if the loadable does not have state-independent N and det[J].
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        if (!loadable->IsNFStateIndependent())
+            return false;
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+
+        ForEachIntegrationPoint([&](double U, double V, double weight) {
+            F_ad.setZero();
+            static_cast<Tloader*>(this)->ComputeF_AD(U, V, F_ad, x_ad, w_ad);
+            AccumulateNF(
+                F_ad, weight,
+                [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                    loadable->ComputeNF(U, V, NF, detJ, F, state_x, state_w);
+                },
+                Q, dQ);
+        });
+
+        return true;
+    }
+
+  protected:
+    /// Invoke the function f(u, v, weight) at each quadrature point of the loadable domain.
+    /// The weight includes the scaling of the triangle quadrature tables.
+    template <class Tfunc>
+    void ForEachIntegrationPoint(Tfunc&& f) {
         if (!loadable->IsTriangleIntegrationNeeded()) {
             // Case of normal quadrilateral isoparametric coords
             assert(GetIntegrationPointsU() <= ChQuadrature::GetStaticTables()->Weight.size());
@@ -70,19 +120,9 @@ class ChLoaderUVdistributed : public ChLoaderUV {
             const std::vector<double>& Vlroots = ChQuadrature::GetStaticTables()->Lroots[GetIntegrationPointsV() - 1];
             const std::vector<double>& Vweight = ChQuadrature::GetStaticTables()->Weight[GetIntegrationPointsV() - 1];
 
-            ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
-
-            // Gauss quadrature :  Q = sum (N'*F*detJ * wi*wj)
             for (unsigned int iu = 0; iu < Ulroots.size(); iu++) {
                 for (unsigned int iv = 0; iv < Vlroots.size(); iv++) {
-                    double detJ;
-                    // Compute F= F(u,v)
-                    this->ComputeF(Ulroots[iu], Vlroots[iv], mF, state_x, state_w);
-                    // Compute mNF= N(u,v)'*F
-                    loadable->ComputeNF(Ulroots[iu], Vlroots[iv], mNF, detJ, mF, state_x, state_w);
-                    // Compute Q+= mNF detJ * wi*wj
-                    mNF *= (detJ * Uweight[iu] * Vweight[iv]);
-                    Q += mNF;
+                    f(Ulroots[iu], Vlroots[iv], Uweight[iu] * Vweight[iv]);
                 }
             }
         } else {
@@ -92,18 +132,10 @@ class ChLoaderUVdistributed : public ChLoaderUV {
             const std::vector<double>& Vlroots = ChQuadrature::GetStaticTablesTriangle()->LrootsV[GetIntegrationPointsU() - 1];
             const std::vector<double>& weight = ChQuadrature::GetStaticTablesTriangle()->Weight[GetIntegrationPointsU() - 1];
 
-            ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
-
-            // Gauss quadrature :  Q = sum (N'*F*detJ * wi *1/2)   often detJ= 2 * triangle area
+            // often detJ= 2 * triangle area
             for (unsigned int i = 0; i < Ulroots.size(); i++) {
-                double detJ;
-                // Compute F= F(u,v)
-                this->ComputeF(Ulroots[i], Vlroots[i], mF, state_x, state_w);
-                // Compute mNF= N(u,v)'*F
-                loadable->ComputeNF(Ulroots[i], Vlroots[i], mNF, detJ, mF, state_x, state_w);
-                // Compute Q+= mNF detJ * wi *1/2
-                mNF *= (detJ * weight[i] * (1. / 2.));  // (the 1/2 coefficient is not in the table);
-                Q += mNF;
+                // (the 1/2 coefficient is not in the table)
+                f(Ulroots[i], Vlroots[i], weight[i] * (1. / 2.));
             }
         }
     }
@@ -136,6 +168,35 @@ class ChLoaderUVatomic : public ChLoaderUV {
         loadable->ComputeNF(Pu, Pv, Q, detJ, mF, state_x, state_w);
     }
 
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number states x_ad and w_ad.
+    /// Tloader is the actual loader type, which must implement ComputeF_AD (see ChLoaderSupportsAD).
+    /// Returns false, without computing anything, if the loadable does not have state-independent N and det[J].
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        if (!loadable->IsNFStateIndependent())
+            return false;
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+        F_ad.setZero();
+
+        static_cast<Tloader*>(this)->ComputeF_AD(Pu, Pv, F_ad, x_ad, w_ad);
+        AccumulateNF(
+            F_ad, 1.0,
+            [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                loadable->ComputeNF(Pu, Pv, NF, detJ, F, state_x, state_w);
+                detJ = 1;  // no integration for atomic loads
+            },
+            Q, dQ);
+
+        return true;
+    }
+
     /// Set the position, on the surface where the atomic load is applied
     void SetApplication(double mu, double mv) {
         Pu = mu;
@@ -174,6 +235,8 @@ class ChLoaderForceOnSurface : public ChLoaderUVatomic {
 };
 
 /// A very usual type of surface loader: the constant pressure load, a 3D per-area force that is aligned to the surface normal.
+/// If the loadable provides its tangent maps (see ChLoadableUV::ComputeTangentMaps), the Jacobian of this follower load
+/// is evaluated exactly with automatic differentiation of the area-weighted normal.
 
 class ChLoaderPressure : public ChLoaderUVdistributed {
   private:
@@ -182,6 +245,8 @@ class ChLoaderPressure : public ChLoaderUVdistributed {
     int num_integration_points;
 
   public:
+    static const bool AD_enabled = true;
+
     ChLoaderPressure(std::shared_ptr<ChLoadableUV> mloadable)
         : ChLoaderUVdistributed(mloadable), is_stiff(false), num_integration_points(1) {}
 
@@ -195,6 +260,52 @@ class ChLoaderPressure : public ChLoaderUVdistributed {
         F.segment(0, 3) = -pressure * mnorm.eigen();
     }
 
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number state x_ad.
+    /// The load at each integration point is -p*(dr/du x dr/dv), so that both the rotation of the normal and the change
+    /// of area (det[J]) with the state are differentiated. Returns false if the loadable has no tangent maps.
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        ChMatrixDynamic<> Tu;
+        ChMatrixDynamic<> Tv;
+        if (!loadable->ComputeTangentMaps(0, 0, Tu, Tv))
+            return false;
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+
+        ForEachIntegrationPoint([&](double U, double V, double weight) {
+            loadable->ComputeTangentMaps(U, V, Tu, Tv);
+            Tdual ru[3];
+            Tdual rv[3];
+            for (int j = 0; j < 3; j++) {
+                ru[j] = Tdual(0);
+                rv[j] = Tdual(0);
+                for (int i = 0; i < x_ad.size(); i++) {
+                    ru[j] += Tu(j, i) * x_ad(i);
+                    rv[j] += Tv(j, i) * x_ad(i);
+                }
+            }
+            F_ad.setZero();
+            F_ad(0) = -pressure * (ru[1] * rv[2] - ru[2] * rv[1]);
+            F_ad(1) = -pressure * (ru[2] * rv[0] - ru[0] * rv[2]);
+            F_ad(2) = -pressure * (ru[0] * rv[1] - ru[1] * rv[0]);
+            AccumulateNF(
+                F_ad, weight,
+                [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                    loadable->ComputeNF(U, V, NF, detJ, F, state_x, state_w);
+                    detJ = 1;  // already included in the area-weighted normal
+                },
+                Q, dQ);
+        });
+
+        return true;
+    }
+
     void SetPressure(double mpressure) { pressure = mpressure; }
     double GetPressure() { return pressure; }
 
@@ -63,6 +63,56 @@ class ChLoaderUVWdistributed : public ChLoaderUVW {
         ChVectorDynamic<> mF(loadable->Get_field_ncoords());
         mF.setZero();
 
+        ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
+
+        // Gauss quadrature :  Q = sum (N'*F*detJ * wi*wj*wk)
+        ForEachIntegrationPoint([&](double U, double V, double W, double weight) {
+            double detJ;
+            // Compute F= F(u,v,w)
+            this->ComputeF(U, V, W, mF, state_x, state_w);
+            // Compute mNF= N(u,v,w)'*F
+            loadable->ComputeNF(U, V, W, mNF, detJ, mF, state_x, state_w);
+            // Compute Q+= mNF * detJ * wi*wj*wk
+            mNF *= (detJ * weight);
+            Q += mNF;
+        });
+    }
+
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number states x_ad and w_ad.
+    /// Tloader is the actual loader type, which must implement ComputeF_AD (see ChLoaderSupportsAD).
+    /// Returns false, without computing anything, if the loadable does not have state-independent N and det[J].
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        if (!loadable->IsNFStateIndependent())
+            return false;
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+
+        ForEachIntegrationPoint([&](double U, double V, double W, double weight) {
+            F_ad.setZero();
+            static_cast<Tloader*>(this)->ComputeF_AD(U, V, W, F_ad, x_ad, w_ad);
+            AccumulateNF(
+                F_ad, weight,
+                [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                    loadable->ComputeNF(U, V, W, NF, detJ, F, state_x, state_w);
+                },
+                Q, dQ);
+        });
+
+        return true;
+    }
+
+  protected:
+    /// Invoke the function f(u, v, w, weight) at each quadrature point of the loadable domain.
+    /// The weight includes the scaling of the tetrahedron and triangle quadrature tables.
+    template <class Tfunc>
+    void ForEachIntegrationPoint(Tfunc&& f) {
         if (loadable->IsTetrahedronIntegrationNeeded()) {
             // case of tetrahedron: use special 3d quadrature tables (given U,V,W orders, use the U only)
             assert(GetIntegrationPointsU() <= ChQuadrature::GetStaticTablesTetrahedron()->Weight.size());
@@ -71,18 +121,10 @@ class ChLoaderUVWdistributed : public ChLoaderUVW {
             const std::vector<double>& Wlroots = ChQuadrature::GetStaticTablesTetrahedron()->LrootsW[GetIntegrationPointsU() - 1];
             const std::vector<double>& weight =  ChQuadrature::GetStaticTablesTetrahedron()->Weight[GetIntegrationPointsU() - 1];
 
-            ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
-
             // Gauss quadrature :  Q = sum (N'*F*detJ * wi * 1/6)   often detJ=6*tetrahedron volume
             for (unsigned int i = 0; i < Ulroots.size(); i++) {
-                double detJ;
-                // Compute F= F(u,v,w)
-                this->ComputeF(Ulroots[i], Vlroots[i], Wlroots[i], mF, state_x, state_w);
-                // Compute mNF= N(u,v,w)'*F
-                loadable->ComputeNF(Ulroots[i], Vlroots[i], Wlroots[i], mNF, detJ, mF, state_x, state_w);
-                // Compute Q+= mNF * detJ * wi * 1/6
-                mNF *= (detJ * weight[i] * (1. / 6.));  // (the 1/6 coefficient is not in the table);
-                Q += mNF;
+                // (the 1/6 coefficient is not in the table)
+                f(Ulroots[i], Vlroots[i], Wlroots[i], weight[i] * (1. / 6.));
             }
 		}
 		else if (loadable->IsTrianglePrismIntegrationNeeded()) {
@@ -95,21 +137,13 @@ class ChLoaderUVWdistributed : public ChLoaderUVW {
 			const std::vector<double>& Wlroots = ChQuadrature::GetStaticTables()->Lroots[GetIntegrationPointsW() - 1];
             const std::vector<double>& Wweight = ChQuadrature::GetStaticTables()->Weight[GetIntegrationPointsW() - 1];
 
-			ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
-
 			// Gauss quadrature :  Q = sum (N'*F*detJ * wi * wj *1/2)   often detJ= 2 * triangle area
 			// This requires a single outer for loop over all triangle points, already queued in arrays Ulroots Vlroots, 
 			// and an inner loop over thickness points Wlroots.
             for (unsigned int i = 0; i < Ulroots.size(); i++) {
 				for (unsigned int iw = 0; iw < Wlroots.size(); iw++) {
-					double detJ;
-					// Compute F= F(u,v)
-					this->ComputeF(Ulroots[i], Vlroots[i], Vlroots[iw], mF, state_x, state_w);
-					// Compute mNF= N(u,v)'*F
-					loadable->ComputeNF(Ulroots[i], Vlroots[i], Vlroots[iw], mNF, detJ, mF, state_x, state_w);
-					// Compute Q+= mNF * detJ * wi *1/2
-					mNF *= (detJ * weight[i] * Wweight[iw] * (1. / 2.));  // (the 1/2 coefficient is not in the triangle table);
-					Q += mNF;
+					// (the 1/2 coefficient is not in the triangle table)
+					f(Ulroots[i], Vlroots[i], Wlroots[iw], weight[i] * Wweight[iw] * (1. / 2.));
 				}
             }
 		}
@@ -125,21 +159,11 @@ class ChLoaderUVWdistributed : public ChLoaderUVW {
             const std::vector<double>& Wlroots = ChQuadrature::GetStaticTables()->Lroots[GetIntegrationPointsW() - 1];
             const std::vector<double>& Wweight = ChQuadrature::GetStaticTables()->Weight[GetIntegrationPointsW() - 1];
 
-            ChVectorDynamic<> mNF(Q.size());  // temporary value for loop
-
             // Gauss quadrature :  Q = sum (N'*F*detJ * wi*wj*wk)
             for (unsigned int iu = 0; iu < Ulroots.size(); iu++) {
                 for (unsigned int iv = 0; iv < Vlroots.size(); iv++) {
                     for (unsigned int iw = 0; iw < Wlroots.size(); iw++) {
-                        double detJ;
-                        // Compute F= F(u,v,w)
-                        this->ComputeF(Ulroots[iu], Vlroots[iv], Wlroots[iw], mF, state_x, state_w);
-                        // Compute mNF= N(u,v,w)'*F
-                        loadable->ComputeNF(Ulroots[iu], Vlroots[iv], Wlroots[iw], mNF, detJ, mF, state_x,
-                                            state_w);
-                        // Compute Q+= mNF * detJ * wi*wj*wk
-                        mNF *= (detJ * Uweight[iu] * Vweight[iv] * Wweight[iw]);
-                        Q += mNF;
+                        f(Ulroots[iu], Vlroots[iv], Wlroots[iw], Uweight[iu] * Vweight[iv] * Wweight[iw]);
                     }
                 }
             }
@@ -176,6 +200,35 @@ class ChLoaderUVWatomic : public ChLoaderUVW {
         loadable->ComputeNF(Pu, Pv, Pw, Q, detJ, mF, state_x, state_w);
     }
 
+    /// Computes Q and its derivatives dQ along the directions seeded in the dual-number states x_ad and w_ad.
+    /// Tloader is the actual loader type, which must implement ComputeF_AD (see ChLoaderSupportsAD).
+    /// Returns false, without computing anything, if the loadable does not have state-independent N and det[J].
+    template <class Tloader, class Tdual>
+    bool ComputeQ_AD(ChVectorDynamic<>* state_x,
+                     ChVectorDynamic<>* state_w,
+                     const ChVectorDynamic<Tdual>& x_ad,
+                     const ChVectorDynamic<Tdual>& w_ad,
+                     ChMatrixDynamic<>& dQ) {
+        if (!loadable->IsNFStateIndependent())
+            return false;
+
+        Q.setZero(loadable->LoadableGet_ndof_w());
+        dQ.setZero(Q.size(), Tdual::dim);
+        ChVectorDynamic<Tdual> F_ad(loadable->Get_field_ncoords());
+        F_ad.setZero();
+
+        static_cast<Tloader*>(this)->ComputeF_AD(Pu, Pv, Pw, F_ad, x_ad, w_ad);
+        AccumulateNF(
+            F_ad, 1.0,
+            [&](const ChVectorDynamic<>& F, ChVectorDynamic<>& NF, double& detJ) {
+                loadable->ComputeNF(Pu, Pv, Pw, NF, detJ, F, state_x, state_w);
+                detJ = 1;  // no integration for atomic loads
+            },
+            Q, dQ);
+
+        return true;
+    }
+
     /// Set the position, in the volume, where the atomic load is applied
     void SetApplication(double mu, double mv, double mw) {
         Pu = mu;
@@ -118,6 +118,9 @@ class ChApi ChNodeXYZ : public virtual ChNodeBase, public ChLoadableUVW {
     /// This is not needed because not used in quadrature.
     virtual double GetDensity() override { return 1; }
 
+    /// The generalized load is the applied force itself, independent of the state.
+    virtual bool IsNFStateIndependent() override { return true; }
+
     // SERIALIZATION
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
@@ -59,6 +59,7 @@ ChSystem::ChSystem()
       tol_force(-1),
       maxiter(6),
       use_sleeping(false),
+      use_islands(false),
       min_bounce_speed(0.15),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
@@ -126,6 +127,7 @@ ChSystem::ChSystem(const ChSystem& other) {
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
     SetSolverType(other.GetSolverType());
     use_sleeping = other.use_sleeping;
+    use_islands = other.use_islands;
 
     ncontacts = other.ncontacts;
 
@@ -521,6 +523,21 @@ bool ChSystem::ManageSleepingBodies() {
         body->TrySleeping();
     }
 
+    // If islands are used, a body can sleep only if all bodies in its island (at the last solve) could sleep,
+    // so that islands are put to sleep as a whole.
+    if (use_islands && !body_islands.empty() && body_islands.size() == assembly.bodylist.size()) {
+        int num_islands = 1 + *std::max_element(body_islands.begin(), body_islands.end());
+        std::vector<char> island_awake(num_islands, false);
+        for (size_t i = 0; i < body_islands.size(); i++) {
+            if (body_islands[i] >= 0 && !assembly.bodylist[i]->BFlagGet(ChBody::BodyFlag::COULDSLEEP))
+                island_awake[body_islands[i]] = true;
+        }
+        for (size_t i = 0; i < body_islands.size(); i++) {
+            if (body_islands[i] >= 0 && island_awake[body_islands[i]])
+                assembly.bodylist[i]->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+        }
+    }
+
     // STEP 2:
     // See if some sleeping or potential sleeping body is touching a non sleeping one,
     // if so, set to no sleep.
@@ -768,7 +785,7 @@ void ChSystem::Update(bool update_assets) {
 
     // Update any attached visualization system only when also updating assets
     if (visual_system && update_assets)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     timer_update.stop();
 }
@@ -1123,6 +1140,17 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
 
     GetSolver()->EnableWrite(write_matrix, std::to_string(stepcount) + "_" + std::to_string(solvecount), output_dir);
 
+    // If indicated, partition the problem into independent islands.
+    // Record the island of each body (used to put islands to sleep as a whole).
+    if (use_islands) {
+        descriptor->SetNumThreads(nthreads_chrono);
+        descriptor->ComputeIslands();
+
+        body_islands.resize(assembly.bodylist.size());
+        for (size_t i = 0; i < assembly.bodylist.size(); i++)
+            body_islands[i] = descriptor->GetIslandIndex(&assembly.bodylist[i]->Variables());
+    }
+
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
@@ -1508,7 +1536,7 @@ bool ChSystem::Integrate_Y() {
 
     // Update the run-time visualization system, if present
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     // Tentatively mark system as unchanged (i.e., no updated necessary)
     is_updated = true;
@@ -1564,7 +1592,7 @@ bool ChSystem::DoAssembly(int action) {
 
     // Update any attached visualization system
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     return true;
 }
@@ -1621,7 +1649,7 @@ bool ChSystem::DoStaticLinear() {
 
     // Update any attached visualization system
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     return true;
 }
@@ -1659,7 +1687,7 @@ bool ChSystem::DoStaticNonlinear(int nsteps, bool verbose) {
 
     // Update any attached visualization system
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     return true;
 }
@@ -1682,7 +1710,7 @@ bool ChSystem::DoStaticAnalysis(ChStaticAnalysis& analysis) {
 
     // Update any attached visualization system
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     return true;
 }
@@ -1717,7 +1745,7 @@ bool ChSystem::DoStaticNonlinearRheonomic(int nsteps, bool verbose, std::shared_
 
     // Update any attached visualization system
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     return true;
 }
@@ -1775,7 +1803,7 @@ bool ChSystem::DoStaticRelaxing(int nsteps) {
 
     // Update any attached visualization system
     if (visual_system)
-        visual_system->OnUpdate(this);
+        visual_system->Synchronize(this);
 
     return last_err;
 }
@@ -218,8 +218,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians), in the
+    ///                           evaluation of SMC contact forces, and in SCM deformable terrain calculations.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -723,6 +723,19 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Turn on this feature to partition the problem at each solve into independent islands, i.e. groups of bodies
+    /// (and other items with variables) connected through links or contacts (default: false).
+    /// Solvers which support islands (e.g., ChSolverPSOR) solve each island separately, with its own convergence test,
+    /// and process islands concurrently (using the number of threads set with SetNumThreads for num_threads_chrono).
+    /// If sleeping is enabled, bodies in the same island are put to sleep together.
+    void SetUseIslands(bool val) { use_islands = val; }
+
+    /// Tell if the system partitions the problem into independent islands.
+    bool GetUseIslands() const { return use_islands; }
+
+    /// Return the number of islands found at the last solve (0 if islands not enabled).
+    int GetNumIslands() const { return (int)descriptor->GetIslands().size(); }
+
   private:
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
@@ -930,6 +943,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int maxiter;  ///< max iterations for nonlinear convergence in DoAssembly()
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
+    bool use_islands;   ///< if true, partition the problem into independent islands
+
+    std::vector<int> body_islands;  ///< island of each body at the last solve (-1 if not active)
 
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
@@ -110,6 +110,8 @@ class ChApi ChSystemSMC : public ChSystem {
     /// Base class for contact force calculation.
     /// A user can override thie default implementation by attaching a custom derived class; see
     /// SetContactForceAlgorithm.
+    /// Contact forces are calculated concurrently for different contacts if the system uses more than one thread
+    /// (see ChSystem::SetNumThreads), so CalculateForce must be thread-safe.
     class ChApi ChContactForceSMC {
       public:
         virtual ~ChContactForceSMC() {}
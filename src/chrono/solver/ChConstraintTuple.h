@@ -122,6 +122,8 @@ class ChConstraintTuple_1vars {
         if (variables->IsActive())
             PasteMatrix(storage, Cq.transpose(), variables->GetOffset(), inscol);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) { vars.push_back(variables); }
 };
 
 /// Case of tuple with reference to 2 ChVariable objects:
@@ -263,6 +265,11 @@ class ChConstraintTuple_2vars {
         if (variables_2->IsActive())
             PasteMatrix(storage, Cq_2.transpose(), variables_2->GetOffset(), inscol);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+    }
 };
 
 /// Case of tuple with reference to 3 ChVariable objects:
@@ -444,6 +451,12 @@ class ChConstraintTuple_3vars {
         if (variables_3->IsActive())
             PasteMatrix(storage, Cq_3.transpose(), variables_3->GetOffset(), inscol);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+    }
 };
 
 
@@ -666,6 +679,13 @@ class ChConstraintTuple_4vars {
         if (variables_4->IsActive())
             PasteMatrix(storage, Cq_4.transpose(), variables_4->GetOffset(), inscol);
     }
+
+    void AppendVariables(std::vector<ChVariables*>& vars) {
+        vars.push_back(variables_1);
+        vars.push_back(variables_2);
+        vars.push_back(variables_3);
+        vars.push_back(variables_4);
+    }
 };
 
 /// This is a set of 'helper' classes that make easier to manage the templated
@@ -123,6 +123,11 @@ class ChConstraintTwoTuples : public ChConstraint {
         tuple_a.Build_CqT(storage, inscol);
         tuple_b.Build_CqT(storage, inscol);
     }
+
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) override {
+        tuple_a.AppendVariables(vars);
+        tuple_b.AppendVariables(vars);
+    }
 };
 
 }  // end namespace chrono
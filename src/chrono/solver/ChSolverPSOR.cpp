@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChSolverPSOR.h"
 #include "chrono/core/ChMathematics.h"
 
@@ -23,11 +25,41 @@ CH_FACTORY_REGISTER(ChSolverPSOR)
 ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
-    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
-    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+    const auto& islands = sysd.GetIslands();
+
+    if (islands.empty()) {
+        maxviolation =
+            SolveIsland(sysd.GetConstraintsList(), sysd.GetVariablesList(), m_iterations, record_violation_history);
+        return maxviolation;
+    }
+
+    // Solve the independent islands concurrently, each with its own convergence test.
+    // Report the largest number of iterations and the largest violation over all islands.
+    int num_islands = (int)islands.size();
+    std::vector<int> iterations(num_islands);
+    std::vector<double> violations(num_islands);
+
+#pragma omp parallel for schedule(dynamic) num_threads(sysd.GetNumThreads())
+    for (int i = 0; i < num_islands; i++) {
+        violations[i] = SolveIsland(islands[i].constraints, islands[i].variables, iterations[i], false);
+    }
 
     m_iterations = 0;
     maxviolation = 0;
+    for (int i = 0; i < num_islands; i++) {
+        m_iterations = std::max(m_iterations, iterations[i]);
+        maxviolation = std::max(maxviolation, violations[i]);
+    }
+
+    return maxviolation;
+}
+
+double ChSolverPSOR::SolveIsland(const std::vector<ChConstraint*>& mconstraints,
+                                 const std::vector<ChVariables*>& mvariables,
+                                 int& iterations,
+                                 bool record) {
+    iterations = 0;
+    double violation = 0;
     double maxdeltalambda = 0.;
     int i_friction_comp = 0;
     double old_lambda_friction[3];
@@ -78,11 +110,14 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     // 4)  Perform the iteration loops
     //
 
+    if (mconstraints.empty())
+        return 0;
+
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // The iteration on all constraints
         //
 
-        maxviolation = 0;
+        violation = 0;
         maxdeltalambda = 0;
         i_friction_comp = 0;
 
@@ -131,7 +166,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
                         mconstraints[ic - 1]->Increment_q(true_delta_1);
                         mconstraints[ic - 0]->Increment_q(true_delta_2);
 
-                        if (this->record_violation_history) {
+                        if (record) {
                             maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
                             maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
                             maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
@@ -162,29 +197,29 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
                     // (and projected) lagrangian reactions:
                     mconstraints[ic]->Increment_q(true_delta);
 
-                    if (this->record_violation_history)
+                    if (record)
                         maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
                 }
 
-                maxviolation = ChMax(maxviolation, fabs(candidate_violation));
+                violation = ChMax(violation, fabs(candidate_violation));
 
             }  // end IsActive()
 
         }  // end loop on constraints
 
         // For recording into violation history, if debugging
-        if (this->record_violation_history)
-            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+        if (record)
+            AtIterationEnd(violation, maxdeltalambda, iter);
 
-        m_iterations++;
+        iterations++;
 
         // Terminate the loop if violation in constraints has been successfully limited.
-        if (maxviolation < m_tolerance)
+        if (violation < m_tolerance)
             break;
 
     }  // end iteration loop
 
-    return maxviolation;
+    return violation;
 }
 
 }  // end namespace chrono
@@ -25,7 +25,9 @@ namespace chrono {
 /// An iterative solver based on projective fixed point method, with overrelaxation and immediate variable update as in
 /// SOR methods.\n
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures passed to the
-/// solver.
+/// solver.\n
+/// If the system descriptor was partitioned into independent islands (see ChSystemDescriptor::ComputeIslands), each
+/// island is solved separately, with its own convergence test, and islands are processed concurrently.
 
 class ChApi ChSolverPSOR : public ChIterativeSolverVI {
   public:
@@ -45,6 +47,13 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     virtual double GetError() const override { return maxviolation; }
 
   private:
+    /// Perform the PSOR iterations on the given constraints and variables (the entire problem or one island).
+    /// Return the maximum constraint violation and set the number of iterations performed.
+    double SolveIsland(const std::vector<ChConstraint*>& mconstraints,
+                       const std::vector<ChVariables*>& mvariables,
+                       int& iterations,
+                       bool record);
+
     double maxviolation;
 };
 
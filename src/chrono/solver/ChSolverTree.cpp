@@ -0,0 +1,251 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "chrono/solver/ChSolverTree.h"
+
+namespace chrono {
+
+static int FindRoot(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+bool ChSolverTree::Setup(ChSystemDescriptor& sysd) {
+    // Record the block of each scalar variable (one block per active ChVariables object)
+    m_num_vars = sysd.CountActiveVariables();
+    m_var_blocks.assign(m_num_vars, -1);
+
+    int num_blocks = 0;
+    for (auto var : sysd.GetVariablesList()) {
+        if (!var->IsActive() || var->Get_ndof() == 0)
+            continue;
+        for (int i = 0; i < var->Get_ndof(); i++)
+            m_var_blocks[var->GetOffset() + i] = num_blocks;
+        num_blocks++;
+    }
+
+    return ChDirectSolverLS::Setup(sysd);
+}
+
+bool ChSolverTree::BuildTree() {
+    m_row_block.assign(m_dim, -1);
+    m_row_local.assign(m_dim, 0);
+    m_blocks.clear();
+    m_order.clear();
+
+    // Variable blocks
+    for (int r = 0; r < m_num_vars; r++) {
+        int b = m_var_blocks[r];
+        if ((int)m_blocks.size() <= b)
+            m_blocks.resize(b + 1);
+        m_row_block[r] = b;
+        m_row_local[r] = (int)m_blocks[b].rows.size();
+        m_blocks[b].rows.push_back(r);
+    }
+
+    // Constraint blocks: group the constraint rows by the set of variable blocks they act on.
+    // Constraints acting on a single variable block (e.g., joints to the ground) are merged in that block, so that no
+    // constraint block is a leaf of the tree (its pivot would be singular).
+    std::map<std::vector<int>, int> groups;
+    std::vector<int> key;
+    for (int r = m_num_vars; r < m_dim; r++) {
+        key.clear();
+        for (ChSparseMatrix::InnerIterator it(m_mat, r); it; ++it) {
+            if (it.col() < m_num_vars && it.value() != 0)
+                key.push_back(m_var_blocks[it.col()]);
+        }
+        std::sort(key.begin(), key.end());
+        key.erase(std::unique(key.begin(), key.end()), key.end());
+
+        int b = (int)m_blocks.size();
+        if (key.size() == 1) {
+            b = key[0];
+        } else if (!key.empty()) {
+            auto res = groups.insert({key, b});
+            b = res.first->second;
+        }
+        if (b == (int)m_blocks.size())
+            m_blocks.push_back(Block());
+        m_row_block[r] = b;
+        m_row_local[r] = (int)m_blocks[b].rows.size();
+        m_blocks[b].rows.push_back(r);
+    }
+
+    // Edges of the block graph (pairs of blocks with a nonzero coupling)
+    int num_blocks = (int)m_blocks.size();
+    std::vector<std::pair<int, int>> edges;
+    for (int r = 0; r < m_dim; r++) {
+        int bi = m_row_block[r];
+        for (ChSparseMatrix::InnerIterator it(m_mat, r); it; ++it) {
+            int bj = m_row_block[it.col()];
+            if (bi != bj && it.value() != 0)
+                edges.push_back(std::make_pair(std::min(bi, bj), std::max(bi, bj)));
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    // The block graph must be a forest
+    std::vector<int> uf(num_blocks);
+    std::iota(uf.begin(), uf.end(), 0);
+    std::vector<std::vector<int>> adjacency(num_blocks);
+    for (const auto& e : edges) {
+        int ra = FindRoot(uf, e.first);
+        int rb = FindRoot(uf, e.second);
+        if (ra == rb)
+            return false;
+        uf[rb] = ra;
+        adjacency[e.first].push_back(e.second);
+        adjacency[e.second].push_back(e.first);
+    }
+
+    // Breadth-first traversal of each tree; the elimination order is the reverse (leaves first)
+    std::vector<bool> visited(num_blocks, false);
+    for (int root = 0; root < num_blocks; root++) {
+        if (visited[root])
+            continue;
+        size_t start = m_order.size();
+        m_blocks[root].parent = -1;
+        visited[root] = true;
+        m_order.push_back(root);
+        for (size_t k = start; k < m_order.size(); k++) {
+            int b = m_order[k];
+            for (auto c : adjacency[b]) {
+                if (visited[c])
+                    continue;
+                visited[c] = true;
+                m_blocks[c].parent = b;
+                m_order.push_back(c);
+            }
+        }
+    }
+    std::reverse(m_order.begin(), m_order.end());
+
+    return true;
+}
+
+bool ChSolverTree::FactorizeTree() {
+    // Load the diagonal blocks and the coupling blocks with the parent
+    for (auto& blk : m_blocks) {
+        int n = (int)blk.rows.size();
+        int np = (blk.parent >= 0) ? (int)m_blocks[blk.parent].rows.size() : 0;
+        blk.D.setZero(n, n);
+        blk.Z_up.setZero(n, np);
+        blk.Z_dn.setZero(np, n);
+        blk.z.setZero(n);
+    }
+
+    for (int r = 0; r < m_dim; r++) {
+        int bi = m_row_block[r];
+        int li = m_row_local[r];
+        for (ChSparseMatrix::InnerIterator it(m_mat, r); it; ++it) {
+            int bj = m_row_block[it.col()];
+            int lj = m_row_local[it.col()];
+            if (bi == bj)
+                m_blocks[bi].D(li, lj) = it.value();
+            else if (bj == m_blocks[bi].parent)
+                m_blocks[bi].Z_up(li, lj) = it.value();
+            else if (bi == m_blocks[bj].parent)
+                m_blocks[bj].Z_dn(li, lj) = it.value();
+        }
+    }
+
+    // Block elimination from the leaves to the roots (no fill-in).
+    // Each pivot block is replaced by its inverse and the coupling with the parent Z_up by D^-1 * Z_up.
+    for (auto b : m_order) {
+        auto& blk = m_blocks[b];
+        Eigen::FullPivLU<Eigen::MatrixXd> lu(blk.D);
+        if (!lu.isInvertible())
+            return false;
+        blk.D = lu.inverse();
+        if (blk.parent >= 0) {
+            blk.Z_up = blk.D * blk.Z_up;
+            m_blocks[blk.parent].D -= blk.Z_dn * blk.Z_up;
+        }
+    }
+
+    return true;
+}
+
+bool ChSolverTree::FactorizeMatrix() {
+    m_is_tree = BuildTree() && FactorizeTree();
+
+    if (verbose) {
+        GetLog() << "  tree elimination: " << m_is_tree << "  (" << (int)m_blocks.size() << " blocks)\n";
+    }
+
+    if (m_is_tree)
+        return true;
+
+    // Fall back to a sparse LU factorization
+    m_engine.compute(m_mat);
+    return (m_engine.info() == Eigen::Success);
+}
+
+bool ChSolverTree::SolveSystem() {
+    if (!m_is_tree) {
+        m_sol = m_engine.solve(m_rhs);
+        return (m_engine.info() == Eigen::Success);
+    }
+
+    for (auto& blk : m_blocks) {
+        for (size_t k = 0; k < blk.rows.size(); k++)
+            blk.z(k) = m_rhs(blk.rows[k]);
+    }
+
+    // Forward elimination (leaves first)
+    for (auto b : m_order) {
+        auto& blk = m_blocks[b];
+        blk.z = blk.D * blk.z;
+        if (blk.parent >= 0)
+            m_blocks[blk.parent].z -= blk.Z_dn * blk.z;
+    }
+
+    // Back substitution (roots first)
+    for (auto it = m_order.rbegin(); it != m_order.rend(); ++it) {
+        auto& blk = m_blocks[*it];
+        if (blk.parent >= 0)
+            blk.z -= blk.Z_up * m_blocks[blk.parent].z;
+        for (size_t k = 0; k < blk.rows.size(); k++)
+            m_sol(blk.rows[k]) = blk.z(k);
+    }
+
+    return true;
+}
+
+void ChSolverTree::PrintErrorMessage() {
+    // There are only three possible return codes (see Eigen SparseLU.h)
+    switch (m_engine.info()) {
+        case Eigen::Success:
+            GetLog() << "computation was successful\n";
+            break;
+        case Eigen::NumericalIssue:
+            GetLog() << "LU factorization reported a problem, zero diagonal for instance\n";
+            break;
+        case Eigen::InvalidInput:
+            GetLog() << "inputs are invalid, or the algorithm has been improperly called\n";
+            break;
+        default:
+            break;
+    }
+}
+
+}  // end namespace chrono
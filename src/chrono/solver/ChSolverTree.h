@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+
+#ifndef CH_SOLVER_TREE_H
+#define CH_SOLVER_TREE_H
+
+#include <vector>
+
+#include "chrono/solver/ChDirectSolverLS.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/** \class ChSolverTree
+\brief Linear-time direct solver for tree-topology mechanisms.
+
+The system matrix is partitioned in blocks, one per active ChVariables object and one per group of constraints acting
+on the same set of variables (e.g., all scalar constraints of a joint). Constraints acting on a single ChVariables object
+(e.g., joints to a fixed body) are included in the block of that object. If the graph of the nonzero off-diagonal blocks
+is a tree (or a forest), i.e. the mechanism has no closed loops, the matrix is factorized by block elimination from the
+leaves to the root, which produces no fill-in: both factorization and solution then have a cost linear in the number
+of bodies and joints (see Baraff, "Linear-time dynamics using Lagrange multipliers", 1996).
+
+If the graph has loops (or a pivot block is singular, e.g. because of redundant constraints), the solver falls back to
+a sparse LU factorization of the entire matrix, as ChSolverSparseLU.
+
+Like the other direct solvers, it cannot handle VI and complementarity problems, so it cannot be used with NSC
+contacts. See ChDirectSolverLS for more details.
+*/
+class ChApi ChSolverTree : public ChDirectSolverLS {
+  public:
+    ChSolverTree() : m_is_tree(false), m_num_vars(0) {}
+    ~ChSolverTree() {}
+
+    /// Perform the solver setup operations.
+    /// Record the partition of the variables in blocks, then assemble and factorize the system matrix.
+    virtual bool Setup(ChSystemDescriptor& sysd) override;
+
+    /// Return true if the last factorization used the tree elimination (false if it fell back to sparse LU).
+    bool IsTree() const { return m_is_tree; }
+
+    /// Return the number of blocks (variables and constraint groups) in the last factorization.
+    int GetNumBlocks() const { return (int)m_blocks.size(); }
+
+  private:
+    /// Block of rows of the system matrix (variables or group of constraints).
+    struct Block {
+        std::vector<int> rows;   ///< rows of the system matrix in this block
+        int parent;              ///< parent block in the elimination tree (-1 for a root)
+        ChMatrixDynamic<> D;     ///< diagonal block (inverse of the pivot block after factorization)
+        ChMatrixDynamic<> Z_up;  ///< coupling block with the parent (rows of this block, columns of the parent)
+        ChMatrixDynamic<> Z_dn;  ///< coupling block with the parent (rows of the parent, columns of this block)
+        ChVectorDynamic<> z;     ///< work vector
+    };
+
+    /// Factorize the current sparse matrix and return true if successful.
+    virtual bool FactorizeMatrix() override;
+
+    /// Solve the linear system using the current factorization and right-hand side vector.
+    virtual bool SolveSystem() override;
+
+    /// Display an error message corresponding to the last failure.
+    virtual void PrintErrorMessage() override;
+
+    /// Partition the matrix in blocks and find an elimination order. Return false if the block graph has loops.
+    bool BuildTree();
+
+    /// Factorize the matrix through block elimination along the tree. Return false if a pivot block is singular.
+    bool FactorizeTree();
+
+    bool m_is_tree;                  ///< tree elimination used in last factorization?
+    int m_num_vars;                  ///< number of scalar variables (rows of the matrix before the constraints)
+    std::vector<int> m_var_blocks;   ///< block of each scalar variable (from the system descriptor)
+    std::vector<int> m_row_block;    ///< block of each row of the matrix
+    std::vector<int> m_row_local;    ///< index of each row in its block
+    std::vector<Block> m_blocks;     ///< blocks of the matrix
+    std::vector<int> m_order;        ///< elimination order (leaves first)
+
+    Eigen::SparseLU<ChSparseMatrix, Eigen::COLAMDOrdering<int>> m_engine;  ///< fallback Eigen SparseLU solver
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
@@ -12,7 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <numeric>
+
 #include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChKblockGeneric.h"
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
@@ -25,7 +28,7 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), num_threads(1), freeze_count(false) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -99,6 +102,136 @@ void ChSystemDescriptor::UpdateCountsAndOffsets() {
     freeze_count = true;
 }
 
+// -----------------------------------------------------------------------------
+
+// Find the root of the set containing 'i' (with path halving).
+static int FindRoot(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+// Merge the sets containing 'i' and 'j'.
+static void Merge(std::vector<int>& parent, int i, int j) {
+    int ri = FindRoot(parent, i);
+    int rj = FindRoot(parent, j);
+    if (ri < rj)
+        parent[rj] = ri;
+    else if (rj < ri)
+        parent[ri] = rj;
+}
+
+void ChSystemDescriptor::ComputeIslands() {
+    islands.clear();
+    offset_islands.assign(n_q, -1);
+
+    int nv = (int)vvariables.size();
+    int nc = (int)vconstraints.size();
+
+    // Index of the active variables, by offset
+    std::vector<int> var_index(n_q, -1);
+    for (int iv = 0; iv < nv; iv++) {
+        if (vvariables[iv]->IsActive())
+            var_index[vvariables[iv]->GetOffset()] = iv;
+    }
+    auto index = [&](const ChVariables* var) {
+        if (!var || !var->IsActive() || var->GetOffset() >= n_q)
+            return -1;
+        int iv = var_index[var->GetOffset()];
+        return (iv >= 0 && vvariables[iv] == var) ? iv : -1;
+    };
+
+    // Union-find over the variables connected by constraints and stiffness blocks.
+    // For each constraint, keep one of its active variables (if any) to later find its island.
+    std::vector<int> parent(nv);
+    std::iota(parent.begin(), parent.end(), 0);
+    std::vector<int> con_var(nc, -1);
+    std::vector<ChVariables*> vars;
+
+    for (int ic = 0; ic < nc; ic++) {
+        if (!vconstraints[ic]->IsActive())
+            continue;
+        vars.clear();
+        vconstraints[ic]->AppendVariables(vars);
+        for (auto var : vars) {
+            int iv = index(var);
+            if (iv < 0)
+                continue;
+            if (con_var[ic] < 0)
+                con_var[ic] = iv;
+            else
+                Merge(parent, con_var[ic], iv);
+        }
+    }
+
+    for (auto kblock : vstiffness) {
+        int first = -1;
+        if (auto kgeneric = dynamic_cast<ChKblockGeneric*>(kblock)) {
+            for (unsigned int k = 0; k < kgeneric->GetNvars(); k++) {
+                int iv = index(kgeneric->GetVariableN(k));
+                if (iv < 0)
+                    continue;
+                if (first < 0)
+                    first = iv;
+                else
+                    Merge(parent, first, iv);
+            }
+        } else {
+            // Unknown coupling: merge all active variables
+            for (int iv = 0; iv < nv; iv++) {
+                if (!vvariables[iv]->IsActive())
+                    continue;
+                if (first < 0)
+                    first = iv;
+                else
+                    Merge(parent, first, iv);
+            }
+        }
+    }
+
+    // Collect the variables of each island (islands ordered by their first variable)
+    std::vector<int> root_island(nv, -1);
+    for (int iv = 0; iv < nv; iv++) {
+        if (!vvariables[iv]->IsActive())
+            continue;
+        int root = FindRoot(parent, iv);
+        if (root_island[root] < 0) {
+            root_island[root] = (int)islands.size();
+            islands.push_back(Island());
+        }
+        islands[root_island[root]].variables.push_back(vvariables[iv]);
+        offset_islands[vvariables[iv]->GetOffset()] = root_island[root];
+    }
+
+    // Collect the constraints of each island
+    int free_island = -1;
+    for (int ic = 0; ic < nc; ic++) {
+        if (!vconstraints[ic]->IsActive())
+            continue;
+        int island;
+        if (con_var[ic] >= 0) {
+            island = root_island[FindRoot(parent, con_var[ic])];
+        } else {
+            if (free_island < 0) {
+                free_island = (int)islands.size();
+                islands.push_back(Island());
+            }
+            island = free_island;
+        }
+        islands[island].constraints.push_back(vconstraints[ic]);
+    }
+}
+
+int ChSystemDescriptor::GetIslandIndex(const ChVariables* var) const {
+    if (!var->IsActive() || var->GetOffset() >= (int)offset_islands.size())
+        return -1;
+    return offset_islands[var->GetOffset()];
+}
+
+// -----------------------------------------------------------------------------
+
 void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Cq,
                                              ChSparseMatrix* H,
                                              ChSparseMatrix* E,
@@ -70,6 +70,14 @@ namespace chrono {
 /// and variables structures with other, more efficient data schemes.
 
 class ChApi ChSystemDescriptor {
+  public:
+    /// Independent subproblem: a group of active variables coupled through constraints (or stiffness blocks), and the
+    /// active constraints acting on them.
+    struct Island {
+        std::vector<ChVariables*> variables;     ///< active variables in the island
+        std::vector<ChConstraint*> constraints;  ///< active constraints in the island (in descriptor order)
+    };
+
   protected:
     std::vector<ChConstraint*> vconstraints;  ///< list of pointers to all the ChConstraint in the current Chrono system
     std::vector<ChVariables*> vvariables;     ///< list of pointers to all the ChVariables in the current Chrono system
@@ -77,6 +85,10 @@ class ChApi ChSystemDescriptor {
 
     double c_a;  // coefficient form M mass matrices in vvariables
 
+    std::vector<Island> islands;      ///< independent islands (see ComputeIslands)
+    std::vector<int> offset_islands;  ///< island of the active variables, indexed by their offset in 'q'
+    int num_threads;                  ///< number of threads for processing islands
+
   private:
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
@@ -105,6 +117,8 @@ class ChApi ChSystemDescriptor {
         vconstraints.clear();
         vvariables.clear();
         vstiffness.clear();
+        islands.clear();
+        offset_islands.clear();
     }
 
     /// Insert reference to a ChConstraint object
@@ -138,6 +152,29 @@ class ChApi ChSystemDescriptor {
     /// otherwise CountActiveVariables() and CountActiveConstraints() might fail.
     virtual void UpdateCountsAndOffsets();
 
+    // ISLANDS
+
+    /// Partition the active variables and constraints into independent islands.
+    /// Two variables are in the same island if they are connected through a chain of active constraints or stiffness
+    /// blocks (inactive variables, e.g. of fixed bodies, do not connect islands). Constraints keep their relative order
+    /// within an island; constraints which do not act on any active variable are collected in a separate island.
+    /// The islands are discarded at the next BeginInsertion.
+    virtual void ComputeIslands();
+
+    /// Return the islands found by the last call to ComputeIslands (empty if not available).
+    /// Solvers which support islands (e.g., ChSolverPSOR) solve each island as a separate problem.
+    const std::vector<Island>& GetIslands() const { return islands; }
+
+    /// Return the index of the island containing the given variables.
+    /// Return -1 if islands are not available or if the variables are not active.
+    int GetIslandIndex(const ChVariables* var) const;
+
+    /// Set the number of threads used by solvers to process independent islands concurrently (default: 1).
+    void SetNumThreads(int nthreads) { num_threads = nthreads > 0 ? nthreads : 1; }
+
+    /// Return the number of threads used by solvers to process independent islands concurrently.
+    int GetNumThreads() const { return num_threads; }
+
     /// Sets the c_a coefficient (default=1) used for scaling the M masses of the vvariables
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual void SetMassFactor(const double mc_a) { c_a = mc_a; }
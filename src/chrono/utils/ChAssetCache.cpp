@@ -0,0 +1,218 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Content-addressed cache of immutable assets (file contents, triangle meshes,
+// convex hulls, user-defined data) shared across independent simulations.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+#include "chrono/core/ChTypes.h"
+#include "chrono/utils/ChAssetCache.h"
+
+namespace chrono {
+namespace utils {
+
+ChAssetCache::ChAssetCache() : m_num_hits(0), m_num_misses(0) {}
+
+// -----------------------------------------------------------------------------
+
+ChAssetCache::Key ChAssetCache::HashBytes(const void* data, size_t size, Key seed) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    Key hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<Key>(bytes[i]);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+ChAssetCache::Key ChAssetCache::HashCombine(Key a, Key b) {
+    return a ^ (b + 0x9e3779b97f4a7c15ULL + (a << 6) + (a >> 2));
+}
+
+bool ChAssetCache::ReadFile(const std::string& filename, std::string& contents) {
+    std::ifstream ifs(filename, std::ios::in | std::ios::binary);
+    if (!ifs.good())
+        return false;
+    std::ostringstream oss;
+    oss << ifs.rdbuf();
+    contents = oss.str();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChAssetCache::GetFileKey(const std::string& filename, Key& key) {
+    std::shared_ptr<const std::string> contents;
+    return GetFileKey(filename, key, contents);
+}
+
+bool ChAssetCache::GetFileKey(const std::string& filename, Key& key, std::shared_ptr<const std::string>& contents) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_file_keys.find(filename);
+        if (it != m_file_keys.end()) {
+            key = it->second;
+            return true;
+        }
+    }
+
+    auto buffer = chrono_types::make_shared<std::string>();
+    if (!ReadFile(filename, *buffer))
+        return false;
+    key = HashBytes(buffer->data(), buffer->size());
+    contents = buffer;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_file_keys[filename] = key;
+    return true;
+}
+
+std::shared_ptr<const std::string> ChAssetCache::GetFileContents(const std::string& filename) {
+    Key key;
+    std::shared_ptr<const std::string> contents;
+    if (!GetFileKey(filename, key, contents))
+        return nullptr;
+
+    return Get<const std::string>(key, [&filename, &contents]() -> std::shared_ptr<const std::string> {
+        if (contents)
+            return contents;
+        auto buffer = chrono_types::make_shared<std::string>();
+        if (!ReadFile(filename, *buffer))
+            return nullptr;
+        return buffer;
+    });
+}
+
+void ChAssetCache::SetMeshCacheDirectory(const std::string& dir) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mesh_dir = dir;
+}
+
+std::string ChAssetCache::GetMeshCacheDirectory() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_mesh_dir;
+}
+
+std::shared_ptr<const geometry::ChTriangleMeshConnected> ChAssetCache::GetTriangleMesh(const std::string& filename,
+                                                                                       bool load_normals,
+                                                                                       bool load_uv) {
+    // Note: the OBJ file may reference other files (e.g., materials) which are not part of the content key.
+    std::string tag = std::string("obj") + (load_normals ? "n" : "") + (load_uv ? "t" : "");
+    std::string mesh_dir = GetMeshCacheDirectory();
+    return GetFromFile<const geometry::ChTriangleMeshConnected>(
+        filename, tag,
+        [this, &filename, &tag, &mesh_dir, load_normals,
+         load_uv](const std::string& contents) -> std::shared_ptr<const geometry::ChTriangleMeshConnected> {
+            auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+
+            // Binary mesh file, named after the asset key (the file key is memoized at this point)
+            std::string binary_file;
+            Key key;
+            if (!mesh_dir.empty() && GetFileKey(filename, key)) {
+                key = HashBytes(tag.data(), tag.size(), key);
+                char name[32];
+                snprintf(name, sizeof(name), "%016llx.chmesh", (unsigned long long)key);
+                binary_file = mesh_dir + "/" + name;
+                if (trimesh->LoadBinaryMesh(binary_file)) {
+                    trimesh->m_filename = filename;
+                    return trimesh;
+                }
+            }
+
+            std::istringstream iss(contents);
+            if (!trimesh->LoadWavefrontMesh(iss, filename, load_normals, load_uv))
+                return nullptr;
+
+            // Write the binary mesh file under a temporary name, then rename it, so that concurrent processes never
+            // see a partially written file.
+            if (!binary_file.empty()) {
+                trimesh->ComputeAdjacency();
+                std::string tmp_file = binary_file + "." + std::to_string(std::random_device()()) + ".tmp";
+                if (trimesh->WriteBinaryMesh(tmp_file) && std::rename(tmp_file.c_str(), binary_file.c_str()) == 0)
+                    return trimesh;
+                std::remove(tmp_file.c_str());
+            }
+
+            return trimesh;
+        });
+}
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> ChAssetCache::GetTriangleMeshCopy(const std::string& filename,
+                                                                                     bool load_normals,
+                                                                                     bool load_uv) {
+    auto trimesh = GetTriangleMesh(filename, load_normals, load_uv);
+    if (!trimesh)
+        return nullptr;
+    return chrono_types::make_shared<geometry::ChTriangleMeshConnected>(*trimesh);
+}
+
+std::shared_ptr<const ChAssetCache::ConvexHulls> ChAssetCache::GetConvexHulls(const std::string& filename) {
+    return GetFromFile<const ConvexHulls>(
+        filename, "chulls", [](const std::string& contents) -> std::shared_ptr<const ConvexHulls> {
+            auto hulls = chrono_types::make_shared<ConvexHulls>();
+            std::vector<ChVector<>> points;
+            std::istringstream iss(contents);
+            std::string line;
+            while (std::getline(iss, line)) {
+                if (!line.empty() && line.back() == '\r')
+                    line.pop_back();
+                if (line == "hull") {
+                    if (!points.empty())
+                        hulls->push_back(points);
+                    points.clear();
+                    continue;
+                }
+                float vx, vy, vz;
+                if (sscanf(line.c_str(), "%g %g %g", &vx, &vy, &vz) == 3)
+                    points.push_back(ChVector<>(vx, vy, vz));
+            }
+            if (!points.empty())
+                hulls->push_back(points);
+            return hulls;
+        });
+}
+
+// -----------------------------------------------------------------------------
+
+void ChAssetCache::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_assets.clear();
+    m_file_keys.clear();
+    m_num_hits = 0;
+    m_num_misses = 0;
+}
+
+size_t ChAssetCache::GetNumAssets() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_assets.size();
+}
+
+size_t ChAssetCache::GetNumHits() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_hits;
+}
+
+size_t ChAssetCache::GetNumMisses() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_misses;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,219 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Content-addressed cache of immutable assets (file contents, triangle meshes,
+// convex hulls, user-defined data) shared across independent simulations.
+//
+// =============================================================================
+
+#ifndef CH_ASSET_CACHE_H
+#define CH_ASSET_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChTypes.h"
+#include "chrono/core/ChVector.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Thread-safe, content-addressed cache of immutable assets.
+/// Assets are identified by a 64-bit hash of their source data (typically the contents of the file they are loaded
+/// from) combined with the asset type and any load options, so that the same data referenced through different paths
+/// is loaded only once. If several threads request the same asset concurrently, the loader is invoked only once and
+/// all other callers wait for its result.
+///
+/// Cached assets are returned as shared pointers and must be treated as read-only by all users. Source files are
+/// assumed not to change during the lifetime of the cache; call Clear() otherwise.
+class ChApi ChAssetCache {
+  public:
+    typedef uint64_t Key;
+
+    /// Convex hulls loaded from a '.chulls' file (one point list per hull).
+    typedef std::vector<std::vector<ChVector<>>> ConvexHulls;
+
+    ChAssetCache();
+    ~ChAssetCache() {}
+
+    /// Return the cached asset of type T with the given key, invoking the specified loader on a cache miss.
+    /// The loader may return an empty pointer (e.g., on failure); this result is cached as well.
+    /// An exception thrown by the loader is propagated to all callers waiting on this asset and the entry is removed.
+    template <typename T>
+    std::shared_ptr<T> Get(Key key, std::function<std::shared_ptr<T>()> loader);
+
+    /// Return the cached asset of type T loaded from the specified file.
+    /// The asset key is computed from the file contents and the given tag (used to encode any load options).
+    /// The loader is passed the file contents; on a cache miss, the file is read only once (for both hashing and
+    /// loading). Returns an empty pointer if the file cannot be read.
+    template <typename T>
+    std::shared_ptr<T> GetFromFile(const std::string& filename,
+                                   const std::string& tag,
+                                   std::function<std::shared_ptr<T>(const std::string& contents)> loader);
+
+    /// Return the contents of the specified file.
+    /// Returns an empty pointer if the file cannot be read.
+    std::shared_ptr<const std::string> GetFileContents(const std::string& filename);
+
+    /// Set a directory for binary versions of the triangle meshes loaded with GetTriangleMesh.
+    /// If set, a mesh is first looked up in this directory, in a binary file named after the content hash of the OBJ
+    /// file and the load options. If not found, the OBJ file is parsed, its connectivity data is precomputed (see
+    /// ChTriangleMeshConnected::ComputeAdjacency), and the binary file is written for use in subsequent runs.
+    /// The directory must exist. By default (empty directory), no binary mesh files are used.
+    void SetMeshCacheDirectory(const std::string& dir);
+
+    /// Return the directory for binary mesh files (empty if not set).
+    std::string GetMeshCacheDirectory() const;
+
+    /// Return a triangle mesh loaded from the specified Wavefront OBJ file.
+    /// The returned mesh is shared by all users of the cache and cannot be modified (see GetTriangleMeshCopy).
+    /// Returns an empty pointer if the file cannot be read or parsed.
+    std::shared_ptr<const geometry::ChTriangleMeshConnected> GetTriangleMesh(const std::string& filename,
+                                                                             bool load_normals = true,
+                                                                             bool load_uv = false);
+
+    /// Return a new copy of the cached triangle mesh loaded from the specified Wavefront OBJ file.
+    /// Use this function if the mesh must be modified (e.g., transformed) or passed to functions that require a
+    /// mutable mesh. Returns an empty pointer if the file cannot be read or parsed.
+    std::shared_ptr<geometry::ChTriangleMeshConnected> GetTriangleMeshCopy(const std::string& filename,
+                                                                           bool load_normals = true,
+                                                                           bool load_uv = false);
+
+    /// Return the convex hulls specified in a '.chulls' file.
+    /// The file is an ASCII file with lines "[x] [y] [z]" of hull points, with hulls separated by lines "hull".
+    /// Returns an empty pointer if the file cannot be read.
+    std::shared_ptr<const ConvexHulls> GetConvexHulls(const std::string& filename);
+
+    /// Return the content hash of the specified file.
+    /// The hash is memoized by file name. Return false if the file cannot be read.
+    bool GetFileKey(const std::string& filename, Key& key);
+
+    /// Remove all cached assets.
+    void Clear();
+
+    /// Return the number of assets currently in the cache.
+    size_t GetNumAssets() const;
+
+    /// Return the number of cache hits since construction (or last call to Clear).
+    size_t GetNumHits() const;
+
+    /// Return the number of cache misses (loader invocations) since construction (or last call to Clear).
+    size_t GetNumMisses() const;
+
+    /// Compute the 64-bit FNV-1a hash of the given data, optionally continuing from a previous hash value.
+    static Key HashBytes(const void* data, size_t size, Key seed = 14695981039346656037ULL);
+
+    /// Combine two hash values.
+    static Key HashCombine(Key a, Key b);
+
+    /// Read the contents of the specified file. Return false if the file cannot be read.
+    static bool ReadFile(const std::string& filename, std::string& contents);
+
+  private:
+    /// Return the content hash of the specified file. If the file had to be read (i.e., its hash was not memoized),
+    /// also return its contents, so that they can be used to load the asset without reading the file again.
+    bool GetFileKey(const std::string& filename, Key& key, std::shared_ptr<const std::string>& contents);
+
+    typedef std::pair<Key, std::type_index> EntryKey;
+    typedef std::shared_future<std::shared_ptr<void>> Entry;
+
+    std::map<EntryKey, Entry> m_assets;                  ///< cached assets, by content key and type
+    std::unordered_map<std::string, Key> m_file_keys;    ///< memoized content hash, by file name
+    std::string m_mesh_dir;                              ///< directory for binary mesh files
+    mutable std::mutex m_mutex;                          ///< protects all members above
+    size_t m_num_hits;
+    size_t m_num_misses;
+};
+
+/// @} chrono_utils
+
+// -----------------------------------------------------------------------------
+// Implementation of template functions
+// -----------------------------------------------------------------------------
+
+template <typename T>
+std::shared_ptr<T> ChAssetCache::Get(Key key, std::function<std::shared_ptr<T>()> loader) {
+    EntryKey ekey(key, std::type_index(typeid(T)));
+    std::promise<std::shared_ptr<void>> promise;
+    Entry entry;
+    bool found = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_assets.find(ekey);
+        if (it != m_assets.end()) {
+            entry = it->second;
+            found = true;
+            m_num_hits++;
+        } else {
+            m_assets.emplace(ekey, promise.get_future().share());
+            m_num_misses++;
+        }
+    }
+
+    // Wait for the asset to become available (if it is being loaded by a different thread)
+    if (found)
+        return std::static_pointer_cast<T>(entry.get());
+
+    // Load the asset outside the lock (other requests for the same asset will wait on the future)
+    try {
+        std::shared_ptr<T> asset = loader();
+        promise.set_value(std::const_pointer_cast<void>(std::static_pointer_cast<const void>(asset)));
+        return asset;
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_assets.erase(ekey);
+        throw;
+    }
+}
+
+template <typename T>
+std::shared_ptr<T> ChAssetCache::GetFromFile(const std::string& filename,
+                                             const std::string& tag,
+                                             std::function<std::shared_ptr<T>(const std::string& contents)> loader) {
+    Key key;
+    std::shared_ptr<const std::string> contents;
+    if (!GetFileKey(filename, key, contents))
+        return nullptr;
+    key = HashBytes(tag.data(), tag.size(), key);
+
+    return Get<T>(key, [&filename, &loader, &contents]() -> std::shared_ptr<T> {
+        if (!contents) {
+            auto buffer = chrono_types::make_shared<std::string>();
+            if (!ReadFile(filename, *buffer))
+                return nullptr;
+            contents = buffer;
+        }
+        return loader(*contents);
+    });
+}
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
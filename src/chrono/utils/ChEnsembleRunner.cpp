@@ -0,0 +1,179 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Utility for concurrent execution of many independent simulations (e.g., for
+// Monte-Carlo studies), with a shared cache of immutable assets.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/core/ChTypes.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+
+namespace chrono {
+namespace utils {
+
+// -----------------------------------------------------------------------------
+// Work queue of run indices for one worker thread.
+// The owner pops runs from the back, other workers steal runs from the front.
+// -----------------------------------------------------------------------------
+
+class ChEnsembleQueue {
+  public:
+    void Push(int index) { m_runs.push_back(index); }
+
+    bool Pop(int& index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_runs.empty())
+            return false;
+        index = m_runs.back();
+        m_runs.pop_back();
+        return true;
+    }
+
+    bool Steal(int& index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_runs.empty())
+            return false;
+        index = m_runs.front();
+        m_runs.pop_front();
+        return true;
+    }
+
+  private:
+    std::deque<int> m_runs;
+    std::mutex m_mutex;
+};
+
+// -----------------------------------------------------------------------------
+
+ChEnsembleRunner::ChEnsembleRunner(int num_threads) : m_total_time(0), m_num_stolen(0) {
+    SetNumThreads(num_threads);
+    m_cache = chrono_types::make_shared<ChAssetCache>();
+}
+
+void ChEnsembleRunner::SetNumThreads(int num_threads) {
+    if (num_threads <= 0)
+        num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+    m_num_threads = num_threads;
+}
+
+void ChEnsembleRunner::Run(int num_runs, RunFunction func) {
+    m_results.clear();
+    m_results.resize(std::max(num_runs, 0));
+    m_num_stolen = 0;
+    m_total_time = 0;
+    if (num_runs <= 0)
+        return;
+
+    int num_threads = std::min(m_num_threads, num_runs);
+
+    // Distribute runs in contiguous blocks over the worker queues.
+    // Each worker processes its own block from the end and steals from the start of other blocks.
+    std::vector<ChEnsembleQueue> queues(num_threads);
+    for (int i = 0; i < num_runs; i++)
+        queues[(int)(((long long)i * num_threads) / num_runs)].Push(i);
+
+    std::atomic<int> num_stolen(0);
+    ChAssetCache& cache = *m_cache;
+
+    auto worker = [&](int thread) {
+        int index;
+        while (true) {
+            bool found = queues[thread].Pop(index);
+            for (int k = 1; !found && k < num_threads; k++) {
+                found = queues[(thread + k) % num_threads].Steal(index);
+                if (found)
+                    num_stolen++;
+            }
+            if (!found)
+                return;
+
+            RunResult& result = m_results[index];
+            result.index = index;
+            result.thread = thread;
+            result.success = true;
+
+            ChTimer<> timer;
+            timer.start();
+            try {
+                func(index, cache, result);
+            } catch (const std::exception& e) {
+                result.success = false;
+                result.message = e.what();
+            } catch (...) {
+                result.success = false;
+                result.message = "unknown exception";
+            }
+            timer.stop();
+            result.time = timer();
+        }
+    };
+
+    ChTimer<> timer;
+    timer.start();
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < num_threads; t++)
+        threads.push_back(std::thread(worker, t));
+    worker(0);
+    for (auto& t : threads)
+        t.join();
+
+    timer.stop();
+    m_total_time = timer();
+    m_num_stolen = num_stolen;
+}
+
+int ChEnsembleRunner::GetNumFailed() const {
+    return (int)std::count_if(m_results.begin(), m_results.end(), [](const RunResult& r) { return !r.success; });
+}
+
+double ChEnsembleRunner::GetCumulativeRunTime() const {
+    double time = 0;
+    for (const auto& r : m_results)
+        time += r.time;
+    return time;
+}
+
+double ChEnsembleRunner::GetThroughput() const {
+    if (m_total_time <= 0)
+        return 0;
+    return 3600.0 * m_results.size() / m_total_time;
+}
+
+void ChEnsembleRunner::PrintStats() const {
+    GetLog() << "Ensemble statistics\n";
+    GetLog() << "  Number of runs:          " << (int)m_results.size() << "\n";
+    GetLog() << "  Number of failed runs:   " << GetNumFailed() << "\n";
+    GetLog() << "  Number of threads:       " << m_num_threads << "\n";
+    GetLog() << "  Number of stolen runs:   " << m_num_stolen << "\n";
+    GetLog() << "  Total time (s):          " << m_total_time << "\n";
+    GetLog() << "  Cumulative run time (s): " << GetCumulativeRunTime() << "\n";
+    GetLog() << "  Throughput (runs/hour):  " << GetThroughput() << "\n";
+    GetLog() << "  Cached assets:           " << (int)m_cache->GetNumAssets() << "\n";
+    GetLog() << "  Cache hits / misses:     " << (int)m_cache->GetNumHits() << " / " << (int)m_cache->GetNumMisses()
+             << "\n";
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Utility for concurrent execution of many independent simulations (e.g., for
+// Monte-Carlo studies), with a shared cache of immutable assets.
+//
+// =============================================================================
+
+#ifndef CH_ENSEMBLE_RUNNER_H
+#define CH_ENSEMBLE_RUNNER_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/utils/ChAssetCache.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Concurrent execution of an ensemble of independent simulations.
+/// Each run is a user-provided function which typically creates its own ChSystem, builds the model (using the shared
+/// asset cache for any data loaded from files), simulates, and records its outputs in the provided result structure.
+/// Runs are executed on a pool of worker threads with per-thread work queues and work stealing, so that runs of very
+/// different durations are balanced across threads.
+///
+/// Since the ensemble already provides coarse-grained parallelism, each run should usually use a single thread
+/// (see ChSystem::SetNumThreads). Any exception thrown by a run is caught and recorded as a failure of that run.
+class ChApi ChEnsembleRunner {
+  public:
+    /// Result of a single ensemble run.
+    struct RunResult {
+        int index;                 ///< run index
+        int thread;                ///< index of the worker thread that executed the run
+        bool success;              ///< false if the run function threw an exception
+        double time;               ///< wall-clock time for this run (s)
+        std::string message;       ///< error message (if run failed) or user message
+        std::vector<double> data;  ///< user-defined output values
+    };
+
+    /// Function executed for each run.
+    /// Note that run functions are called concurrently from different threads.
+    typedef std::function<void(int index, ChAssetCache& cache, RunResult& result)> RunFunction;
+
+    /// Construct an ensemble runner using the specified number of worker threads.
+    /// If num_threads <= 0, the number of hardware threads is used.
+    ChEnsembleRunner(int num_threads = 0);
+
+    ~ChEnsembleRunner() {}
+
+    /// Set the number of worker threads used in subsequent calls to Run.
+    /// If num_threads <= 0, the number of hardware threads is used.
+    void SetNumThreads(int num_threads);
+
+    /// Get the number of worker threads.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Set the asset cache shared by all runs (default: a cache owned by this runner).
+    /// A cache may be shared across several ensembles to reuse assets loaded in previous ensembles.
+    void SetAssetCache(std::shared_ptr<ChAssetCache> cache) { m_cache = cache; }
+
+    /// Get the asset cache shared by all runs.
+    ChAssetCache& GetAssetCache() { return *m_cache; }
+
+    /// Execute the specified number of runs and block until all runs are completed.
+    /// Results from any previous call are discarded.
+    void Run(int num_runs, RunFunction func);
+
+    /// Get the results of all runs in the last ensemble, ordered by run index.
+    const std::vector<RunResult>& GetResults() const { return m_results; }
+
+    /// Get the number of failed runs in the last ensemble.
+    int GetNumFailed() const;
+
+    /// Get the wall-clock time for the last ensemble (s).
+    double GetTotalTime() const { return m_total_time; }
+
+    /// Get the cumulative time of all runs in the last ensemble (s).
+    double GetCumulativeRunTime() const;
+
+    /// Get the number of runs stolen from a different worker queue in the last ensemble.
+    int GetNumStolen() const { return m_num_stolen; }
+
+    /// Get the throughput of the last ensemble, in runs per hour.
+    double GetThroughput() const;
+
+    /// Print statistics for the last ensemble (run counts, timing, throughput, asset cache use).
+    void PrintStats() const;
+
+  private:
+    int m_num_threads;
+    std::shared_ptr<ChAssetCache> m_cache;
+    std::vector<RunResult> m_results;
+    double m_total_time;
+    int m_num_stolen;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
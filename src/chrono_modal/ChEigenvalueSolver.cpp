@@ -522,58 +522,41 @@ bool ChQuadraticEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M, cons
 	ChVectorDynamic<double>& damping_ratio,		///< output vector with n damping rations r=damping/critical_damping.
 	ChEigenvalueSolverSettings settings) const
 {
-	// Generate the A and B in state space
+	// The constrained quadratic problem is linearized in the state space of size 2*n_vars + n_constr, with the pencil
+	// A  =  [  0     I     0 ]      B  =  [  I     0     0 ]
+	//       [ -K    -R  -Cq' ]            [  0     M     0 ]
+	//       [ -Cq    0     0 ]            [  0     0     0 ]
+	// Since the shift&invert operator (A - sigma*B)^-1 * B does not depend on the multipliers, the Krylov-Schur
+	// iteration is done on the state [q; v] of size 2*n_vars only, and the operator is applied by factorizing the
+	// sparse saddle-point matrix [K + sigma*R + sigma^2*M, Cq'; Cq, 0] of size n_vars + n_constr (no dense null-space,
+	// no dense inverse).
 	int n_vars = M.rows();
 	int n_constr = Cq.rows();
+	int n_state = 2 * n_vars;
 
-	GetLog() << "Scaling Cq\n";
-	double scaling = K.diagonal().mean();
-	for (int k=0; k<Cq.outerSize(); ++k)
-		for (ChSparseMatrix::InnerIterator it(Cq,k); it; ++it) {
-			it.valueRef() *= scaling;
-		}
-
-	Eigen::SparseMatrix<double, Eigen::ColMajor> As(2 * n_vars + n_constr, 2 * n_vars + n_constr);
-	Eigen::SparseMatrix<double, Eigen::ColMajor> Bs(2 * n_vars + n_constr, 2 * n_vars + n_constr);
-	ChSparseMatrix identity_n_vars(n_vars, n_vars); identity_n_vars.setIdentity();
-	// A  =  [  0     I     0 ]
-	//       [ -K    -R  -Cq' ]
-	//       [ -Cq    0     0 ]
-
-	As.setZero();
-	placeMatrix(As, -K, n_vars, 0);
-	placeMatrix(As, -Cq, 2 * n_vars, 0);
-	placeMatrix(As, identity_n_vars, 0, n_vars);
-	placeMatrix(As, -R, n_vars, n_vars);
-	placeMatrix(As, -Cq.transpose(), n_vars, 2 * n_vars);
-	As.makeCompressed();
-
-
-
-	// B  =  [  I     0     0 ]
-	//       [  0     M     0 ]
-	//       [  0     0     0 ]
-	Bs.setZero();
-	placeMatrix(Bs, identity_n_vars, 0, 0);
-	placeMatrix(Bs, M, n_vars, n_vars);
-	Bs.makeCompressed();
+	// if n_modes==0, then compute all eigs (performance warning)
+	int n_modes = settings.n_modes;
+	if (n_modes == 0)
+		n_modes = n_vars - n_constr;
+	n_modes = ChMin(n_modes, n_vars - n_constr);
 
-
-	int n_computed_eigs = 2 * settings.n_modes;
+	int n_computed_eigs = ChMin(2 * n_modes, n_state);
 	int m = 2 * n_computed_eigs >= 30 ? 2 * n_computed_eigs : 30;  // minimum subspace size   //**TO DO*** make parametric
-	if (m > 2 * n_vars + n_constr)
-		m = 2 * n_vars + n_constr;
+	if (m > n_state)
+		m = n_state;
 
 	// Setup the Krylov Schur solver:
 	ChVectorDynamic<std::complex<double>> eigen_values;
 	ChMatrixDynamic<std::complex<double>> eigen_vectors;
 	ChVectorDynamic<std::complex<double>> v1;
-	v1.setRandom(As.cols()); // note: to make deterministic may be preceded by something like  std::srand((unsigned int)1234567);
+	v1.setRandom(n_state); // note: to make deterministic may be preceded by something like  std::srand((unsigned int)1234567);
 
 	// Setup the callback for matrix * vector
-	callback_Ax_sparse_complexshiftinvert Ax_function3(
-		As,
-		Bs,
+	callback_Ax_sparse_quadratic_complexshiftinvert Ax_function3(
+		M,
+		R,
+		K,
+		Cq,
 		settings.sigma,
 		this->linear_solver);
 
@@ -588,7 +571,7 @@ bool ChQuadraticEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M, cons
 		niter,									///< number of used iterations
 		&Ax_function3,						///< callback for A*v
 		v1,								///< initial approx of eigenvector, or random
-		As.cols(),						///< size of A
+		n_state,						///< size of A
 		n_computed_eigs,				///< number of needed eigenvalues
 		m,								///< Krylov restart threshold (largest dimension of krylov subspace)
 		settings.max_iterations,		///< max iteration number
@@ -600,30 +583,27 @@ bool ChQuadraticEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M, cons
 	//Eigen::saveMarket(K, "D:/workspace/KrylovSchur-master/ChronoDump/K.dat");
 	//Eigen::saveMarket(Cq, "D:/workspace/KrylovSchur-master/ChronoDump/Cq.dat");
 
-	//Eigen::saveMarket(As, "D:/workspace/KrylovSchur-master/ChronoDump/As.dat");
-	//Eigen::saveMarket(Bs, "D:/workspace/KrylovSchur-master/ChronoDump/Bs.dat");
-
 	//Eigen::saveMarket(ChSparseMatrix(eigen_values.real().sparseView()), "D:/workspace/KrylovSchur-master/ChronoDump/eigen_values_real.dat");
 	//Eigen::saveMarket(ChSparseMatrix(eigen_values.imag().sparseView()), "D:/workspace/KrylovSchur-master/ChronoDump/eigen_values_imag.dat");
 	//Eigen::saveMarket(ChSparseMatrix(eigen_vectors.real().sparseView()), "D:/workspace/KrylovSchur-master/ChronoDump/eigen_vectors_real.dat");
 	//Eigen::saveMarket(ChSparseMatrix(eigen_vectors.imag().sparseView()), "D:/workspace/KrylovSchur-master/ChronoDump/eigen_vectors_imag.dat");
 
-	if (settings.verbose) {
-		if (flag==1)
-		{
+	if (flag==1)
+	{
+		if (settings.verbose) {
 			GetLog() << "KrylovSchurEig FAILED. \n";
 			GetLog() << " shift   = (" << settings.sigma.real() << "," << settings.sigma.imag() << ")\n";
 			GetLog() << " nconv = " << nconv << "\n";
 			GetLog() << " niter = " << niter << "\n";	
-			return false;
-		}
-		else
-		{
-			GetLog() << "KrylovSchurEig successfull. \n";
-			GetLog() << " shift   = (" << settings.sigma.real() << "," << settings.sigma.imag() << ")\n";
-			GetLog() << " nconv   = " << nconv << "\n";
-			GetLog() << " niter   = " << niter << "\n";
 		}
+		return false;
+	}
+	else if (settings.verbose)
+	{
+		GetLog() << "KrylovSchurEig successfull. \n";
+		GetLog() << " shift   = (" << settings.sigma.real() << "," << settings.sigma.imag() << ")\n";
+		GetLog() << " nconv   = " << nconv << "\n";
+		GetLog() << " niter   = " << niter << "\n";
 	}
  
 	// Restore eigenvals, trasform back  from  shift-inverted problem to original problem:
@@ -675,7 +655,7 @@ bool ChQuadraticEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M, cons
 
 
 	if (settings.verbose) {
-		ChVectorDynamic<std::complex<double>> resCallback(2 * n_vars + n_constr);
+		ChVectorDynamic<std::complex<double>> resCallback(n_state);
 		for (int i = 0; i < all_eigen_values_and_vectors.size(); i++) {
 			ChVectorDynamic<std::complex<double>> temp;
 			Ax_function3.compute(temp, all_eigen_values_and_vectors[i].eigen_vect);
@@ -693,13 +673,15 @@ bool ChQuadraticEigenvalueSolverKrylovSchur::Solve(const ChSparseMatrix& M, cons
 	// organize and return results
 	int middle_number = (int)(all_eigen_values_and_vectors.size() / 2);  // The eigenvalues ​​filtered out are conjugate complex roots, just take half
 
+	n_modes = ChMin(n_modes, (int)all_eigen_values_and_vectors.size() - middle_number);
+
     // Return values
-    V.setZero(M.rows(), settings.n_modes);
-    eig.setZero(settings.n_modes);
-	freq.setZero(settings.n_modes);
-	damping_ratio.setZero(settings.n_modes);
+    V.setZero(M.rows(), n_modes);
+    eig.setZero(n_modes);
+	freq.setZero(n_modes);
+	damping_ratio.setZero(n_modes);
 
-    for (int i = 0; i < settings.n_modes; i++) {
+    for (int i = 0; i < n_modes; i++) {
         int i_half = middle_number + i; // because the n.of eigenvalues is double (conjugate pairs), so just use the 2nd half after sorting
 
         V.col(i) = all_eigen_values_and_vectors.at(i_half).eigen_vect.head(n_vars);  // store only displacement part of eigenvector, no speed part, no constraint part
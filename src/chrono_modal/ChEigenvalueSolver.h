@@ -265,10 +265,12 @@ public:
 /// Solves the eigenvalue problem with the Krylov-Schur iterative method.
 /// This is an efficient method to compute only the lower n modes, ex. when there are so many degreees of 
 /// freedom that it would make a full solution impossible.
-/// It uses an iterative method and it exploits the sparsity of the matrices.
+/// It uses an iterative method and it exploits the sparsity of the matrices: the shift&invert of the linearized
+/// state-space problem only requires the factorization of the sparse saddle-point matrix
+/// [K + sigma*R + sigma^2*M, Cq'; Cq, 0], so constraints are handled via Lagrange multipliers, without null-space.
 class ChApiModal ChQuadraticEigenvalueSolverKrylovSchur : public ChQuadraticEigenvalueSolver {
 public:
-    /// Default: uses Eigen::SparseQR as factorization for the shift&invert, 
+    /// Default: uses Eigen::SparseLU as factorization for the shift&invert, 
     /// otherwise pass a custom complex sparse solver for faster factorization (ex. ChSolverComplexPardisoMKL)
     ChQuadraticEigenvalueSolverKrylovSchur(ChDirectSolverLScomplex* mlinear_solver = 0);
 
@@ -317,6 +319,7 @@ public:
     /// Ex. 
     ///  ChModalSolveDamped(5, 1e-5, 500, 1e-10, false, ChQuadraticEigenvalueSolverKrylovSchur()); 
     /// finds first 5 lowest damped modes using the ChQuadraticEigenvalueSolverKrylovSchur() solver.
+    /// Note: the default direct solver builds dense matrices; use ChQuadraticEigenvalueSolverKrylovSchur for large models.
     ChModalSolveDamped(
         int n_lower_modes,         ///< n of lower modes
         double base_freq = 1e-5,   ///< frequency to whom the nodes are clustered. Use 1e-5 to get n lower modes. As sigma in shift&invert, as: sigma = -pow(base_freq * CH_C_2PI, 2). Too small gives ill conditioning (no convergence). Too large misses rigid body modes.
@@ -112,6 +112,77 @@ void callback_Ax_sparse_complexshiftinvert::compute(chrono::ChVectorDynamic<std:
 };
 
 
+//----------------
+
+callback_Ax_sparse_quadratic_complexshiftinvert::callback_Ax_sparse_quadratic_complexshiftinvert(
+            const chrono::ChSparseMatrix& mM,
+            const chrono::ChSparseMatrix& mR,
+            const chrono::ChSparseMatrix& mK,
+            const chrono::ChSparseMatrix& mCq,
+            std::complex<double> shift,
+            ChDirectSolverLScomplex* mlinear_solver  ///< optional direct solver/factorization. Default is ChSolverSparseComplexLU
+        )
+        :  linear_solver(mlinear_solver), Md(mM.cast<std::complex<double>>()), Rd(mR.cast<std::complex<double>>()), sigma(shift) {
+
+	if (!linear_solver) {
+		linear_solver = new ChSolverSparseComplexLU();
+		default_solver = true;
+	}
+	else {
+		default_solver = false;
+	}
+
+	n_vars = (int)mM.rows();
+	n_constr = (int)mCq.rows();
+
+	// Scale the constraint jacobians to the magnitude of the stiffness, for a better conditioning of the
+	// saddle-point matrix. This only affects the (discarded) multipliers.
+	double scaling = mK.diagonal().cwiseAbs().mean();
+	if (scaling == 0)
+		scaling = 1;
+
+	// P = K + sigma*R + sigma^2*M
+	Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor> P = mK.cast<std::complex<double>>();
+	P += shift * Rd + (shift * shift) * Md;
+
+	// Assemble the saddle-point matrix [P, Cq'; Cq, 0]
+	std::vector<Eigen::Triplet<std::complex<double>>> triplets;
+	triplets.reserve(P.nonZeros() + 2 * mCq.nonZeros());
+	for (int k = 0; k < P.outerSize(); ++k)
+		for (Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor>::InnerIterator it(P, k); it; ++it)
+			triplets.push_back(Eigen::Triplet<std::complex<double>>((int)it.row(), (int)it.col(), it.value()));
+	for (int k = 0; k < mCq.outerSize(); ++k)
+		for (chrono::ChSparseMatrix::InnerIterator it(mCq, k); it; ++it) {
+			triplets.push_back(Eigen::Triplet<std::complex<double>>(n_vars + (int)it.row(), (int)it.col(), scaling * it.value()));
+			triplets.push_back(Eigen::Triplet<std::complex<double>>((int)it.col(), n_vars + (int)it.row(), scaling * it.value()));
+		}
+
+	linear_solver->A().resize(n_vars + n_constr, n_vars + n_constr);
+	linear_solver->A().setFromTriplets(triplets.begin(), triplets.end());
+	linear_solver->Setup(); // factorize
+}
+
+callback_Ax_sparse_quadratic_complexshiftinvert::~callback_Ax_sparse_quadratic_complexshiftinvert() {
+	if (default_solver)
+		delete linear_solver;
+}
+
+void callback_Ax_sparse_quadratic_complexshiftinvert::compute(chrono::ChVectorDynamic<std::complex<double>>& A_x,     ///< output: result of A*x
+                const chrono::ChVectorDynamic<std::complex<double>>& x  ///< input:  x in A*x
+                )  {
+	// With y = (As - sigma*Bs)^-1 * Bs*x, the first block row gives y_v = x_q + sigma*y_q, so that y_q solves
+	//   (K + sigma*R + sigma^2*M)*y_q + Cq'*l = -M*(x_v + sigma*x_q) - R*x_q,   Cq*y_q = 0
+	ChVectorDynamic<std::complex<double>> b(n_vars + n_constr);
+	b.head(n_vars) = -(Md * (x.tail(n_vars) + sigma * x.head(n_vars)) + Rd * x.head(n_vars));
+	b.tail(n_constr).setZero();
+	linear_solver->Solve(b);
+
+	A_x.resize(2 * n_vars);
+	A_x.head(n_vars) = linear_solver->x().head(n_vars);
+	A_x.tail(n_vars) = x.head(n_vars) + sigma * A_x.head(n_vars);
+};
+
+
 
 
 
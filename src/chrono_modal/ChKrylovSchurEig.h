@@ -91,6 +91,39 @@ class ChApiModal callback_Ax_sparse_complexshiftinvert : public callback_Ax {
     std::complex<double> sigma;
 };
 
+/// The callback to be used for "A*x" in the shift&invert of the linearized constrained quadratic eigenvalue problem
+/// (lambda^2*M + lambda*R + K)*x = 0 s.t. Cq*x = 0, with COMPLEX sigma shift, working on the state x = [q; v] of size 2*n_v.
+/// Rather than factorizing the (2*n_v + n_c) pencil As - sigma Bs, the velocity block is eliminated and only the
+/// sparse saddle-point matrix of size n_v + n_c is factorized:
+///   [ K + sigma*R + sigma^2*M   Cq' ]
+///   [ Cq                        0   ]
+/// so that each A*x costs one sparse back-substitution of half the size.
+class ChApiModal callback_Ax_sparse_quadratic_complexshiftinvert : public callback_Ax {
+    public:
+    callback_Ax_sparse_quadratic_complexshiftinvert(
+            const chrono::ChSparseMatrix& mM,
+            const chrono::ChSparseMatrix& mR,
+            const chrono::ChSparseMatrix& mK,
+            const chrono::ChSparseMatrix& mCq,
+            std::complex<double> shift,
+            ChDirectSolverLScomplex* mlinear_solver = 0  ///< optional direct solver/factorization. Default is ChSolverSparseComplexLU
+        );
+
+    ~callback_Ax_sparse_quadratic_complexshiftinvert();
+
+    void compute(   chrono::ChVectorDynamic<std::complex<double>>& A_x,     ///< output: result of A*x, size 2*n_v
+                    const chrono::ChVectorDynamic<std::complex<double>>& x  ///< input:  x in A*x, size 2*n_v
+    ) override;
+
+	ChDirectSolverLScomplex* linear_solver;
+    Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor> Md;
+    Eigen::SparseMatrix<std::complex<double>, Eigen::ColMajor> Rd;
+	bool default_solver;
+    std::complex<double> sigma;
+    int n_vars;
+    int n_constr;
+};
+
 
 
 /// Compute (complex) eigenvalues and eigenvectors
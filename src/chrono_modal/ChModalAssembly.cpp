@@ -130,6 +130,31 @@ void util_sparse_assembly_2x2symm(Eigen::SparseMatrix<double, Eigen::ColMajor, i
 
 
 
+// Solve the factorized system A*X = B for all the columns of B at once, and store -X (only the first n rows) in Psi.
+// Columns are processed in blocks, densifying only one block of right-hand sides at a time, and blocks are
+// distributed over threads (the solve step of the factorization is read-only).
+template <class Solver, class RhsMatrix>
+void util_solve_multi_rhs(ChMatrixDynamic<>& Psi,   ///< resulting n x B.cols() matrix
+	const Solver& solver,     ///< factorized matrix A
+	const RhsMatrix& B,       ///< right-hand sides, as columns
+	int n,                    ///< number of rows to keep in the solution
+	int nthreads)             ///< number of threads
+{
+	const int block_size = 16;
+	int n_rhs = (int)B.cols();
+	int n_blocks = (n_rhs + block_size - 1) / block_size;
+	Psi.resize(n, n_rhs);
+
+	#pragma omp parallel for schedule(dynamic) num_threads(nthreads)
+	for (int ib = 0; ib < n_blocks; ++ib) {
+		int col = ib * block_size;
+		int ncols = std::min(block_size, n_rhs - col);
+		Eigen::MatrixXd rhs = B.middleCols(col, ncols);
+		Eigen::MatrixXd x = solver.solve(rhs);
+		Psi.middleCols(col, ncols) = -x.topRows(n);
+	}
+}
+
 //---------------------------------------------------------------------------------------
 
 void ChModalAssembly::SwitchModalReductionON(ChSparseMatrix& full_M, ChSparseMatrix& full_K, ChSparseMatrix& full_Cq, 
@@ -188,20 +213,30 @@ void ChModalAssembly::SwitchModalReductionON(ChSparseMatrix& full_M, ChSparseMat
     
     ChMatrixDynamic<> Psi_S(this->n_internal_coords_w, this->n_boundary_coords_w);
 
-    // avoid computing K_IIc^{-1}, effectively do n times a linear solve:
+    // avoid computing K_IIc^{-1}: factorize K_IIc once, then solve for all the boundary columns as a
+    // multi right-hand side solve, distributed over threads
     Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int> >   solver;
     solver.analyzePattern(K_IIc);
     solver.factorize(K_IIc); 
-    for (int i = 0; i < K_IB.cols(); ++i) { 
-        ChVectorDynamic<> rhs(this->n_internal_coords_w + full_Cq.rows());
-        if (Cq_B.rows())
-            rhs << K_IB.col(i).toDense(), Cq_B.col(i).toDense();
-        else
-            rhs << K_IB.col(i).toDense();
-        ChVectorDynamic<> x = solver.solve(rhs);
-        Psi_S.block(0,i, this->n_internal_coords_w, 1) = -x.head(this->n_internal_coords_w);
+
+    int nthreads = this->GetSystem() ? this->GetSystem()->GetNumThreadsChrono() : 1;
+
+    // rhs_S = {K_IB ; Cq_B}, kept sparse (column major, so that blocks of columns can be extracted)
+    Eigen::SparseMatrix<double> rhs_S(this->n_internal_coords_w + full_Cq.rows(), this->n_boundary_coords_w);
+    {
+        std::vector<Eigen::Triplet<double>> triplets;
+        triplets.reserve(K_IB.nonZeros() + Cq_B.nonZeros());
+        for (int k = 0; k < K_IB.outerSize(); ++k)
+            for (ChSparseMatrix::InnerIterator it(K_IB, k); it; ++it)
+                triplets.push_back(Eigen::Triplet<double>((int)it.row(), (int)it.col(), it.value()));
+        for (int k = 0; k < Cq_B.outerSize(); ++k)
+            for (ChSparseMatrix::InnerIterator it(Cq_B, k); it; ++it)
+                triplets.push_back(Eigen::Triplet<double>(this->n_internal_coords_w + (int)it.row(), (int)it.col(), it.value()));
+        rhs_S.setFromTriplets(triplets.begin(), triplets.end());
     }
 
+    util_solve_multi_rhs(Psi_S, solver, rhs_S, this->n_internal_coords_w, nthreads);
+
     // Matrix of dynamic modes (V_B and V_I already computed as constrained eigenmodes, 
     // but use K_IIc instead of K_II anyway, to reuse K_IIc already factored before)
     //
@@ -209,12 +244,10 @@ void ChModalAssembly::SwitchModalReductionON(ChSparseMatrix& full_M, ChSparseMat
 
     ChMatrixDynamic<> Psi_D(this->n_internal_coords_w, this->n_modes_coords_w);
 
-    for (int i = 0; i < this->n_modes_coords_w; ++i) { 
-        ChVectorDynamic<> rhs(this->n_internal_coords_w + full_Cq.rows());
-        rhs << (M_IB * V_B + M_II * V_I).col(i) , Eigen::VectorXd::Zero(full_Cq.rows()) ;
-        ChVectorDynamic<> x = solver.solve(rhs);
-        Psi_D.block(0,i, this->n_internal_coords_w, 1) = -x.head(this->n_internal_coords_w);
-    }
+    Eigen::MatrixXd rhs_D(this->n_internal_coords_w + full_Cq.rows(), this->n_modes_coords_w);
+    rhs_D << M_IB * V_B + M_II * V_I, Eigen::MatrixXd::Zero(full_Cq.rows(), this->n_modes_coords_w);
+
+    util_solve_multi_rhs(Psi_D, solver, rhs_D, this->n_internal_coords_w, nthreads);
 
 
 
@@ -41,6 +41,7 @@ M113::M113()
       m_fixed(false),
       m_wheel_cyl(true),
       m_idler_cyl(true),
+      m_analytic_wheel_contact(false),
       m_create_track(true),
       m_brake_type(BrakeType::SIMPLE),
       m_shoe_type(TrackShoeType::SINGLE_PIN),
@@ -67,6 +68,7 @@ M113::M113(ChSystem* system)
       m_chassisCollisionType(CollisionType::NONE),
       m_wheel_cyl(true),
       m_idler_cyl(true),
+      m_analytic_wheel_contact(false),
       m_fixed(false),
       m_create_track(true),
       m_brake_type(BrakeType::SIMPLE),
@@ -119,6 +121,8 @@ void M113::Initialize() {
     m_vehicle->CreateTrack(m_create_track);
     m_vehicle->GetTrackAssembly(LEFT)->SetWheelCollisionType(m_wheel_cyl, m_idler_cyl, true);
     m_vehicle->GetTrackAssembly(RIGHT)->SetWheelCollisionType(m_wheel_cyl, m_idler_cyl, true);
+    m_vehicle->GetTrackAssembly(LEFT)->EnableAnalyticWheelContact(m_analytic_wheel_contact);
+    m_vehicle->GetTrackAssembly(RIGHT)->EnableAnalyticWheelContact(m_analytic_wheel_contact);
     m_vehicle->Initialize(m_initPos, m_initFwdVel);
 
     // If specified, enable aerodynamic drag
@@ -51,6 +51,7 @@ class CH_MODELS_API M113 {
         m_wheel_cyl = roadwheel_as_cylinder;
         m_idler_cyl = idler_as_cylinder;
     }
+    void SetAnalyticWheelContact(bool val) { m_analytic_wheel_contact = val; }
 
     void SetBrakeType(BrakeType brake_type) { m_brake_type = brake_type; }
     void SetTrackShoeType(TrackShoeType shoe_type) { m_shoe_type = shoe_type; }
@@ -114,6 +115,7 @@ class CH_MODELS_API M113 {
     bool m_create_track;
     bool m_wheel_cyl;
     bool m_idler_cyl;
+    bool m_analytic_wheel_contact;
 
     BrakeType m_brake_type;
     TrackShoeType m_shoe_type;
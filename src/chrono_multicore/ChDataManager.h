@@ -293,6 +293,10 @@ struct host_container {
     /// entire operation happens inline without a temp variable.
     CompressedMatrix<real> M_invD;
 
+    /// Single-precision copies of D_T and M_invD, used in the Shur product if mixed precision is enabled.
+    CompressedMatrix<float> D_T_sp;
+    CompressedMatrix<float> M_invD_sp;
+
     DynamicVector<real> R_full;  ///< The right hand side of the system
     DynamicVector<real> R;       ///< The rhs of the system, changes during solve
     DynamicVector<real> b;       ///< Correction terms
@@ -42,6 +42,7 @@ class collision_settings {
           bins_per_axis(vec3(10, 10, 10)),
           bin_size(real3(1, 1, 1)),
           grid_density(5),
+          grid_level_ratio(2),
           broadphase_grid(collision::ChBroadphase::GridType::FIXED_RESOLUTION),
           narrowphase_algorithm(collision::ChNarrowphase::Algorithm::HYBRID) {}
 
@@ -79,6 +80,10 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Ratio of cell sizes of consecutive levels of the hierarchical broadphase grid. This value is used if the
+    /// `broadphase_grid` type is set to MULTI_LEVEL (recommended for scenes with shapes of very different sizes).
+    real grid_level_ratio;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -126,6 +131,7 @@ class solver_settings {
         max_power_iteration = 15;
         power_iter_tolerance = 0.1;
         skip_residual = 1;
+        use_mixed_precision = false;
     }
 
     /// The solver type variable defines name of the solver that will be used to
@@ -213,6 +219,11 @@ class solver_settings {
     real tolerance_objective;
     /// Compute residual every x iterations.
     int skip_residual;
+    /// Store single-precision copies of the constraint Jacobian blocks D_T and M_invD and use them in the Shur product
+    /// (NSC only). Matrix entries are converted on the fly and all products and sums are accumulated in double
+    /// precision, so that body states and Lagrange multipliers keep full precision while the memory traffic of the
+    /// solver iterations is roughly halved. Has no effect if Chrono::Multicore is built in single precision.
+    bool use_mixed_precision;
 };
 
 /// Aggregate of all settings for Chrono::Multicore.
@@ -228,6 +239,7 @@ class settings_container {
         perform_thread_tuning = false;
         system_type = SystemType::SYSTEM_NSC;
         step_size = 0.01;
+        num_fea_substeps = 1;
     }
 
     collision_settings collision;  ///< settings for collision detection
@@ -236,6 +248,8 @@ class settings_container {
     real step_size;  ///< current integration step size
     real3 gravity;   ///< gravitational acceleration vector
 
+    int num_fea_substeps;  ///< number of explicit integration substeps per step for FEA meshes
+
   private:
     bool perform_thread_tuning;  ///< dynamically tune number of threads
     int min_threads;             ///< lower bound for number of threads (if dynamic tuning)
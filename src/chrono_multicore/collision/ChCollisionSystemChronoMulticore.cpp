@@ -75,6 +75,7 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.level_ratio = settings.grid_level_ratio;
     narrowphase.algorithm = settings.narrowphase_algorithm;
 }
 
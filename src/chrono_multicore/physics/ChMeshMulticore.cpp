@@ -0,0 +1,273 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Support for FEA meshes in a Chrono::Multicore system.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/fea/ChContactSurfaceMesh.h"
+#include "chrono/fea/ChContactSurfaceNodeCloud.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_multicore/physics/ChMeshMulticore.h"
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+namespace chrono {
+
+using namespace fea;
+
+// Collision family for all proxy bodies (no collisions between proxies).
+static const int proxy_family = 1;
+
+// Create a proxy body, with collision enabled.
+// Proxies are not fixed to ground (contacts between two fixed bodies are ignored by the collision system); their state
+// is reset at each step from the current mesh configuration.
+static std::shared_ptr<ChBody> CreateProxyBody(ChSystemMulticore* sys) {
+    auto body = std::shared_ptr<ChBody>(sys->NewBody());
+    body->SetMass(1);
+    body->SetBodyFixed(false);
+    body->SetCollide(true);
+    return body;
+}
+
+static void FinalizeProxyBody(ChSystemMulticore* sys, std::shared_ptr<ChBody> body) {
+    body->GetCollisionModel()->SetFamily(proxy_family);
+    body->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(proxy_family);
+    body->GetCollisionModel()->BuildModel();
+    sys->AddBody(body);
+}
+
+// Return the index of the vertex associated with the given node (create a new one if needed).
+template <class NODE>
+int ChMeshMulticore::AddVertex(NODE* node) {
+    auto it = std::find_if(m_vertices.begin(), m_vertices.end(), [node](const Vertex& v) { return v.node == node; });
+    if (it != m_vertices.end())
+        return (int)(it - m_vertices.begin());
+
+    Vertex v;
+    v.node = node;
+    v.pos = &node->GetPos();
+    v.vel = &node->GetPos_dt();
+    v.mass = [node]() { return node->GetMass(); };
+    m_vertices.push_back(v);
+    return (int)m_vertices.size() - 1;
+}
+
+ChMeshMulticore::ChMeshMulticore(std::shared_ptr<fea::ChMesh> mesh, ChSystemMulticore* sys, bool triangle_proxies)
+    : m_mesh(mesh), m_system(sys), m_tri_start(0), m_initialized(false) {
+    // Proxy triangles are added contiguously to the collision shape data
+    if (triangle_proxies)
+        m_tri_start = (int)sys->data_manager->cd_data->shape_data.triangle_rigid.size();
+
+    for (unsigned int is = 0; is < mesh->GetNcontactSurfaces(); is++) {
+        auto surf = mesh->GetContactSurface(is);
+        auto mat = surf->GetMaterialSurface();
+
+        if (auto cloud = std::dynamic_pointer_cast<ChContactSurfaceNodeCloud>(surf)) {
+            for (auto& cnode : cloud->GetNodeList()) {
+                NodeProxy proxy;
+                proxy.vertex = AddVertex(cnode->GetNode());
+                proxy.radius = cnode->GetRadius();
+                proxy.body = CreateProxyBody(sys);
+                proxy.body->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(proxy.body.get(), mat, cnode->GetRadius(), VNULL, QUNIT, false);
+                FinalizeProxyBody(sys, proxy.body);
+                m_node_proxies.push_back(proxy);
+            }
+            for (auto& cnode : cloud->GetNodeListRot()) {
+                NodeProxy proxy;
+                proxy.vertex = AddVertex(cnode->GetNode());
+                proxy.radius = cnode->GetRadius();
+                proxy.body = CreateProxyBody(sys);
+                proxy.body->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(proxy.body.get(), mat, cnode->GetRadius(), VNULL, QUNIT, false);
+                FinalizeProxyBody(sys, proxy.body);
+                m_node_proxies.push_back(proxy);
+            }
+        } else if (auto cmesh = std::dynamic_pointer_cast<ChContactSurfaceMesh>(surf)) {
+            if (!triangle_proxies)
+                throw ChException("Mesh contact surfaces in a Multicore system require the Chrono collision system.");
+
+            // The triangle vertices are reset at each step (see UpdateProxies)
+            double len = 0.1;
+            for (auto& tri : cmesh->GetTriangleList()) {
+                FaceProxy proxy;
+                proxy.vertices[0] = AddVertex(tri->GetNode1().get());
+                proxy.vertices[1] = AddVertex(tri->GetNode2().get());
+                proxy.vertices[2] = AddVertex(tri->GetNode3().get());
+                proxy.body = CreateProxyBody(sys);
+                proxy.body->GetCollisionModel()->ClearModel();
+                utils::AddTriangleGeometry(proxy.body.get(), mat, ChVector<>(len, 0, 0), ChVector<>(0, len, 0),
+                                           ChVector<>(0, 0, len), "fea_tri", VNULL, QUNIT, false);
+                FinalizeProxyBody(sys, proxy.body);
+                m_face_proxies.push_back(proxy);
+            }
+            for (auto& tri : cmesh->GetTriangleListRot()) {
+                FaceProxy proxy;
+                proxy.vertices[0] = AddVertex(tri->GetNode1().get());
+                proxy.vertices[1] = AddVertex(tri->GetNode2().get());
+                proxy.vertices[2] = AddVertex(tri->GetNode3().get());
+                proxy.body = CreateProxyBody(sys);
+                proxy.body->GetCollisionModel()->ClearModel();
+                utils::AddTriangleGeometry(proxy.body.get(), mat, ChVector<>(len, 0, 0), ChVector<>(0, len, 0),
+                                           ChVector<>(0, 0, len), "fea_tri", VNULL, QUNIT, false);
+                FinalizeProxyBody(sys, proxy.body);
+                m_face_proxies.push_back(proxy);
+            }
+        }
+    }
+
+    m_contact_F.resize(m_vertices.size());
+}
+
+// Set the mesh state offsets (the mesh state is integrated separately from the Multicore system) and collect the
+// variables of the mesh nodes. Called at the first step, after the system initial setup (element initialization and
+// calculation of nodal masses).
+void ChMeshMulticore::Initialize() {
+    m_mesh->SetOffset_x(0);
+    m_mesh->SetOffset_w(0);
+    m_mesh->Setup();
+
+    m_descriptor.BeginInsertion();
+    m_mesh->InjectVariables(m_descriptor);
+    m_descriptor.EndInsertion();
+
+    m_x.setZero(m_mesh->GetDOF(), nullptr);
+    m_v.setZero(m_mesh->GetDOF_w(), nullptr);
+    m_F.setZero(m_mesh->GetDOF_w());
+
+    m_initialized = true;
+}
+
+// Place the proxy bodies at the current mesh configuration:
+// - a node proxy is located at the node, with the node velocity and mass
+// - a face proxy is located at the triangle centroid, with identity orientation, the average vertex velocity, and
+//   a third of the total vertex mass; its triangle shape is redefined to match the current vertex locations
+// Node masses are available only after the system initial setup, so the proxy inertia properties are also reset here.
+void ChMeshMulticore::UpdateProxies() {
+    for (auto& proxy : m_node_proxies) {
+        const auto& v = m_vertices[proxy.vertex];
+        double mass = v.mass();
+        proxy.body->SetMass(mass);
+        proxy.body->SetInertiaXX(ChVector<>(0.4 * mass * proxy.radius * proxy.radius));
+        proxy.body->SetPos(*v.pos);
+        proxy.body->SetRot(QUNIT);
+        proxy.body->SetPos_dt(*v.vel);
+        proxy.body->SetWvel_loc(VNULL);
+    }
+
+    auto& shape_data = m_system->data_manager->cd_data->shape_data.triangle_rigid;
+
+    for (size_t it = 0; it < m_face_proxies.size(); it++) {
+        const auto& proxy = m_face_proxies[it];
+        const auto& vA = m_vertices[proxy.vertices[0]];
+        const auto& vB = m_vertices[proxy.vertices[1]];
+        const auto& vC = m_vertices[proxy.vertices[2]];
+
+        ChVector<> pos = (*vA.pos + *vB.pos + *vC.pos) / 3;
+        ChVector<> pA = *vA.pos - pos;
+        ChVector<> pB = *vB.pos - pos;
+        ChVector<> pC = *vC.pos - pos;
+
+        double mass = (vA.mass() + vB.mass() + vC.mass()) / 3;
+        double r2 = (pA.Length2() + pB.Length2() + pC.Length2()) / 3;
+        proxy.body->SetMass(mass);
+        proxy.body->SetInertiaXX(ChVector<>(mass * r2));
+        proxy.body->SetPos(pos);
+        proxy.body->SetRot(QUNIT);
+        proxy.body->SetPos_dt((*vA.vel + *vB.vel + *vC.vel) / 3);
+        proxy.body->SetWvel_loc(VNULL);
+
+        shape_data[m_tri_start + 3 * it + 0] = real3(pA.x(), pA.y(), pA.z());
+        shape_data[m_tri_start + 3 * it + 1] = real3(pB.x(), pB.y(), pB.z());
+        shape_data[m_tri_start + 3 * it + 2] = real3(pC.x(), pC.y(), pC.z());
+    }
+}
+
+// Collect the contact forces on the proxy bodies and distribute them to the mesh nodes.
+// The force on a face proxy (at the triangle centroid) is distributed equally to the three vertices.
+void ChMeshMulticore::LoadContactForces() {
+    std::fill(m_contact_F.begin(), m_contact_F.end(), VNULL);
+
+    for (const auto& proxy : m_node_proxies) {
+        real3 f = m_system->GetBodyContactForce(proxy.body);
+        m_contact_F[proxy.vertex] += ChVector<>(f.x, f.y, f.z);
+    }
+
+    for (const auto& proxy : m_face_proxies) {
+        real3 f = m_system->GetBodyContactForce(proxy.body);
+        ChVector<> force(f.x / 3, f.y / 3, f.z / 3);
+        for (int i = 0; i < 3; i++)
+            m_contact_F[proxy.vertices[i]] += force;
+    }
+}
+
+// Semi-implicit Euler integration of the mesh:
+//    v_new = v + h * M^-1 * (F_int + F_ext + F_contact)
+//    x_new = x + h * v_new
+// The contact forces are kept constant over all substeps.
+void ChMeshMulticore::Advance(double time, double step, int num_substeps) {
+    if (!m_initialized)
+        Initialize();
+
+    LoadContactForces();
+
+    int nthreads = m_system->GetNumThreadsChrono();
+    double h = step / std::max(num_substeps, 1);
+    double T = time;
+
+    std::vector<ChVariables*>& vars = m_descriptor.GetVariablesList();
+    ChVectorDynamic<> L;
+    ChVectorDynamic<> Qc;
+    ChState x_new(m_x.size(), nullptr);
+    ChStateDelta Dv(m_v.size(), nullptr);
+
+    for (int is = 0; is < std::max(num_substeps, 1); is++) {
+        m_mesh->IntStateGather(0, m_x, 0, m_v, T);
+
+        // Nodal and element forces (internal forces evaluated in parallel over elements)
+        m_F.setZero();
+        m_mesh->IntLoadResidual_F(0, m_F, 1.0);
+
+        // Contact forces (translational DOFs of the nodes)
+        for (size_t iv = 0; iv < m_vertices.size(); iv++) {
+            auto node = m_vertices[iv].node;
+            if (!node->IsFixed())
+                m_F.segment(node->NodeGetOffsetW(), 3) += m_contact_F[iv].eigen();
+        }
+
+        // Velocity update, using the (block-diagonal) lumped mass of each node
+        m_mesh->IntToDescriptor(0, m_v, m_F, 0, L, Qc);
+#pragma omp parallel for num_threads(nthreads)
+        for (int i = 0; i < (signed)vars.size(); i++) {
+            if (!vars[i]->IsActive())
+                continue;
+            ChVectorDynamic<> a(vars[i]->Get_ndof());
+            vars[i]->Compute_invMb_v(a, vars[i]->Get_fb());
+            vars[i]->Get_qb() += h * a;
+        }
+        m_mesh->IntFromDescriptor(0, m_v, 0, L);
+
+        // Position update
+        Dv = h * m_v;
+        m_mesh->IntStateIncrement(0, x_new, m_x, 0, Dv);
+
+        T += h;
+        m_mesh->IntStateScatter(0, x_new, 0, m_v, T, true);
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,121 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Support for FEA meshes in a Chrono::Multicore system.
+//
+// =============================================================================
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "chrono_multicore/ChApiMulticore.h"
+
+#include "chrono/fea/ChMesh.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+class ChSystemMulticore;
+
+/// @addtogroup multicore_physics
+/// @{
+
+/// Wrapper of an FEA mesh in a Chrono::Multicore system.
+///
+/// The mesh is advanced with a semi-implicit (symplectic) Euler scheme, optionally in several substeps per system
+/// step (see settings_container::num_fea_substeps). Element internal forces are evaluated in parallel (see
+/// ChMesh::IntLoadResidual_F) and the nodal updates are done in parallel, using the lumped masses of the nodes.
+///
+/// Contact between the mesh and the other objects in the Multicore system (rigid bodies, granular material) is
+/// handled through proxy bodies: a sphere for each node of a ChContactSurfaceNodeCloud and a triangle for each face
+/// of a ChContactSurfaceMesh. The proxies are bodies in the Multicore system, reset to the current mesh configuration
+/// (positions, velocities, masses) at the beginning of each step. The contact forces they collect during the step are then applied to
+/// the corresponding mesh nodes (explicit coupling). Triangle proxies require the Chrono collision system.
+///
+/// Current limitations:
+/// - constraints between mesh nodes and other objects (e.g., ChLinkPointFrame) are not supported; nodes can be fixed;
+/// - loads from ChLoadContainer objects are not applied to the mesh;
+/// - there is no contact between proxies of the same mesh (no self-contact).
+class CH_MULTICORE_API ChMeshMulticore {
+  public:
+    /// Create the proxy bodies for the contact surfaces of the given mesh and add them to the system.
+    /// The mesh contact surfaces must be defined before calling this constructor.
+    ChMeshMulticore(std::shared_ptr<fea::ChMesh> mesh, ChSystemMulticore* sys, bool triangle_proxies);
+
+    ~ChMeshMulticore() {}
+
+    /// Get the associated FEA mesh.
+    std::shared_ptr<fea::ChMesh> GetMesh() const { return m_mesh; }
+
+    /// Get the number of proxy bodies (spheres and triangles).
+    size_t GetNumProxies() const { return m_node_proxies.size() + m_face_proxies.size(); }
+
+    /// Place the proxy bodies at the current mesh configuration.
+    /// Called at the beginning of a step, before collision detection.
+    void UpdateProxies();
+
+    /// Advance the mesh state from the specified time over the given step, using the current contact forces on the
+    /// proxy bodies.
+    void Advance(double time, double step, int num_substeps);
+
+  private:
+    /// Mesh node used by a contact proxy.
+    struct Vertex {
+        fea::ChNodeFEAbase* node;      ///< FEA node
+        const ChVector<>* pos;         ///< node position
+        const ChVector<>* vel;         ///< node velocity
+        std::function<double()> mass;  ///< node mass (available after system setup)
+    };
+
+    /// Proxy body for a node in a node cloud contact surface.
+    struct NodeProxy {
+        std::shared_ptr<ChBody> body;
+        int vertex;
+        double radius;
+    };
+
+    /// Proxy body for a face in a mesh contact surface.
+    struct FaceProxy {
+        std::shared_ptr<ChBody> body;
+        int vertices[3];
+    };
+
+    template <class NODE>
+    int AddVertex(NODE* node);
+
+    void Initialize();
+    void LoadContactForces();
+
+    std::shared_ptr<fea::ChMesh> m_mesh;  ///< associated FEA mesh
+    ChSystemMulticore* m_system;          ///< containing Multicore system
+
+    std::vector<Vertex> m_vertices;
+    std::vector<NodeProxy> m_node_proxies;
+    std::vector<FaceProxy> m_face_proxies;
+    int m_tri_start;  ///< index of first proxy triangle in the collision shape data
+
+    bool m_initialized;
+    ChSystemDescriptor m_descriptor;        ///< collects the variables of the mesh nodes
+    ChState m_x;                            ///< mesh position-level state
+    ChStateDelta m_v;                       ///< mesh velocity-level state
+    ChVectorDynamic<> m_F;                  ///< mesh generalized forces
+    std::vector<ChVector<>> m_contact_F;    ///< contact forces on vertices
+};
+
+/// @} multicore_physics
+
+}  // end namespace chrono
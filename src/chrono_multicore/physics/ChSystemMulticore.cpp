@@ -112,6 +112,11 @@ bool ChSystemMulticore::Integrate_Y() {
     data_manager->system_timer.Reset();
     data_manager->system_timer.start("step");
 
+    // Move the contact proxies of FEA meshes to the current mesh configurations
+    for (auto& mesh : mesh_list) {
+        mesh->UpdateProxies();
+    }
+
     Setup();
 
     data_manager->system_timer.start("update");
@@ -213,6 +218,14 @@ bool ChSystemMulticore::Integrate_Y() {
         assembly.otherphysicslist[i]->Update(ch_time);
     }
 
+    // Advance FEA meshes, using the contact forces collected by their proxy bodies
+    if (!mesh_list.empty()) {
+        CalculateContactForces();
+        for (auto& mesh : mesh_list) {
+            mesh->Advance(ch_time, GetStep(), data_manager->settings.num_fea_substeps);
+        }
+    }
+
     data_manager->node_container->UpdatePosition(ch_time);
     data_manager->system_timer.stop("update");
 
@@ -298,6 +311,15 @@ void ChSystemMulticore::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> newit
     }
 }
 
+// Add an FEA mesh to the system and create the proxy bodies for its contact surfaces.
+// Note that the mesh is not included in the Multicore data structures; its nodes and elements are processed by the
+// associated ChMeshMulticore object.
+void ChSystemMulticore::AddMesh(std::shared_ptr<fea::ChMesh> mesh) {
+    ChSystem::AddMesh(mesh);
+    bool triangle_proxies = (collision_system_type == ChCollisionSystemType::CHRONO);
+    mesh_list.push_back(chrono_types::make_shared<ChMeshMulticore>(mesh, this, triangle_proxies));
+}
+
 //
 // Reset forces for all variables
 //
@@ -35,6 +35,7 @@
 #include "chrono/multicore_math/ChMulticoreMath.h"
 
 #include "chrono_multicore/physics/Ch3DOFContainer.h"
+#include "chrono_multicore/physics/ChMeshMulticore.h"
 #include "chrono_multicore/ChDataManager.h"
 #include "chrono_multicore/ChMulticoreDefines.h"
 #include "chrono_multicore/ChSettings.h"
@@ -62,6 +63,15 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
     virtual void AddLink(std::shared_ptr<ChLinkBase> link) override;
     virtual void AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> newitem) override;
 
+    /// Add an FEA mesh to the system.
+    /// The mesh is advanced with an explicit scheme (see settings_container::num_fea_substeps) and interacts with
+    /// the other objects in the system through proxy bodies for its contact surfaces (see ChMeshMulticore).
+    /// The mesh contact surfaces must be defined before calling this function.
+    virtual void AddMesh(std::shared_ptr<fea::ChMesh> mesh) override;
+
+    /// Get the list of Multicore wrappers of the FEA meshes in the system.
+    const std::vector<std::shared_ptr<ChMeshMulticore>>& GetMeshes() const { return mesh_list; }
+
     void ClearForceVariables();
     virtual void Update();
     virtual void UpdateBilaterals();
@@ -196,6 +206,7 @@ class CH_MULTICORE_API ChSystemMulticore : public ChSystem {
   private:
     std::vector<ChLinkMotorLinearSpeed*> linmotorlist;
     std::vector<ChLinkMotorRotationSpeed*> rotmotorlist;
+    std::vector<std::shared_ptr<ChMeshMulticore>> mesh_list;
 };
 
 //====================================================================================================
@@ -253,6 +253,15 @@ void ChIterativeSolverMulticoreNSC::ComputeD() {
 
     data_manager->host_data.M_invD = M_inv * data_manager->host_data.D;
 
+    // Single-precision copies of the Jacobian blocks used in the Shur product
+    if (data_manager->settings.solver.use_mixed_precision) {
+        data_manager->host_data.D_T_sp = D_T;
+        data_manager->host_data.M_invD_sp = data_manager->host_data.M_invD;
+    } else {
+        data_manager->host_data.D_T_sp.clear();
+        data_manager->host_data.M_invD_sp.clear();
+    }
+
     data_manager->system_timer.stop("ChIterativeSolverMulticore_D");
 }
 
@@ -16,6 +16,19 @@
 
 using namespace chrono;
 
+// Sparse matrix-vector product y = A * x with a single-precision matrix.
+// Each entry of A is converted to real before the multiplication, and the row sums are accumulated in real precision.
+static void MixedPrecisionMult(const CompressedMatrix<float>& A, const DynamicVector<real>& x, DynamicVector<real>& y) {
+    y.resize(A.rows(), false);
+#pragma omp parallel for
+    for (int i = 0; i < (signed)A.rows(); i++) {
+        real sum = 0;
+        for (auto it = A.cbegin(i); it != A.cend(i); ++it)
+            sum += static_cast<real>(it->value()) * x[it->index()];
+        y[i] = sum;
+    }
+}
+
 ChShurProduct::ChShurProduct() {
     data_manager = 0;
 }
@@ -35,6 +48,11 @@ void ChShurProduct::operator()(const DynamicVector<real>& x, DynamicVector<real>
     if (data_manager->settings.solver.local_solver_mode == data_manager->settings.solver.solver_mode) {
         if (data_manager->settings.solver.compute_N) {
             output = Nshur * x + E * x;
+        } else if (data_manager->settings.solver.use_mixed_precision) {
+            DynamicVector<real> tmp;
+            MixedPrecisionMult(data_manager->host_data.M_invD_sp, x, tmp);
+            MixedPrecisionMult(data_manager->host_data.D_T_sp, tmp, output);
+            output += E * x;
         } else {
             output = D_T * data_manager->host_data.M_invD * x + E * x;
         }
@@ -28,6 +28,15 @@
 #include "chrono/physics/ChLinkMate.h"
 #include "chrono/physics/ChParticleCloud.h"
 
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
 #include "chrono_postprocess/ChBlender.h"
 
 #include "chrono_thirdparty/filesystem/path.h"
@@ -37,6 +46,96 @@ namespace postprocess {
 
 using namespace geometry;
 
+// -----------------------------------------------------------------------------
+// Writer of binary state files, optionally on a background thread.
+// Pending files are written in order; the number of pending files is bounded to limit memory use.
+// -----------------------------------------------------------------------------
+class ChBlenderBinaryWriter {
+  public:
+    ChBlenderBinaryWriter(bool background) : m_background(background), m_busy(false), m_stop(false) {
+        if (m_background)
+            m_thread = std::thread(&ChBlenderBinaryWriter::Run, this);
+    }
+
+    ~ChBlenderBinaryWriter() {
+        if (!m_background)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv_work.notify_all();
+        m_thread.join();
+    }
+
+    void Write(const std::string& filename, std::vector<char>&& buffer) {
+        if (!m_background) {
+            if (!WriteFile(filename, buffer))
+                throw ChException("Can't save data into file " + filename);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_done.wait(lock, [this]() { return m_queue.size() < max_pending; });
+        m_queue.emplace_back(filename, std::move(buffer));
+        lock.unlock();
+        m_cv_work.notify_one();
+    }
+
+    void Wait() {
+        if (!m_background)
+            return;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_done.wait(lock, [this]() { return m_queue.empty() && !m_busy; });
+    }
+
+  private:
+    static const size_t max_pending = 8;
+
+    static bool WriteFile(const std::string& filename, const std::vector<char>& buffer) {
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile.write(buffer.data(), buffer.size());
+        return ofile.good();
+    }
+
+    void Run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_cv_work.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            if (m_queue.empty())
+                return;
+            auto job = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_busy = true;
+            lock.unlock();
+            m_cv_done.notify_all();
+
+            if (!WriteFile(job.first, job.second))
+                std::cerr << "Can't save data into file " << job.first << std::endl;
+
+            lock.lock();
+            m_busy = false;
+            m_cv_done.notify_all();
+        }
+    }
+
+    bool m_background;
+    bool m_busy;
+    bool m_stop;
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cv_work;
+    std::condition_variable m_cv_done;
+    std::deque<std::pair<std::string, std::vector<char>>> m_queue;
+};
+
+template <typename T>
+static void AppendBinary(std::vector<char>& buffer, const T& val) {
+    const char* ptr = reinterpret_cast<const char*>(&val);
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+// -----------------------------------------------------------------------------
+
 ChBlender::ChBlender(ChSystem* system) : ChPostProcessBase(system) {
     base_path = "";
     pic_path = "anim";
@@ -85,11 +184,82 @@ ChBlender::ChBlender(ChSystem* system) : ChPostProcessBase(system) {
     contacts_vector_tip = true;
     wireframe_thickness = 0.001;
     single_asset_file = true;
+    binary_state = false;
     
     SetBlenderUp_is_ChronoY();
 
 }
 
+ChBlender::~ChBlender() {}
+
+void ChBlender::SetBinaryStateOutput(bool val, bool background_writing) {
+    // Destroying the current writer completes any pending output
+    binary_writer.reset();
+    binary_state = val;
+    if (val)
+        binary_writer = std::unique_ptr<ChBlenderBinaryWriter>(new ChBlenderBinaryWriter(background_writing));
+}
+
+void ChBlender::WaitForBinaryStateOutput() {
+    if (binary_writer)
+        binary_writer->Wait();
+}
+
+template <typename T>
+static bool ReadBinary(std::ifstream& ifile, T& val) {
+    return (bool)ifile.read(reinterpret_cast<char*>(&val), sizeof(T));
+}
+
+bool ChBlender::ReadBinaryState(const std::string& filename, BinaryState& state) {
+    std::ifstream ifile(filename, std::ios::binary);
+    if (!ifile)
+        return false;
+
+    char magic[4];
+    uint32_t version, frame, flags;
+    double time;
+    uint64_t num_records;
+    if (!ifile.read(magic, 4) || std::memcmp(magic, "CHBF", 4) != 0)
+        return false;
+    if (!ReadBinary(ifile, version) || version != 2)
+        return false;
+    if (!ReadBinary(ifile, frame) || !ReadBinary(ifile, flags) || !ReadBinary(ifile, time) ||
+        !ReadBinary(ifile, num_records))
+        return false;
+
+    state.frame = frame;
+    state.time = time;
+    state.has_color = (flags & 1) != 0;
+    state.has_scalar = (flags & 2) != 0;
+    state.records.clear();
+    state.records.reserve(num_records);
+
+    for (uint64_t i = 0; i < num_records; i++) {
+        BinaryStateRecord record;
+        uint32_t item, instance;
+        double pos[3];
+        float rot[4];
+        float color[3] = {0, 0, 0};
+        float scalar = 0;
+        if (!ReadBinary(ifile, item) || !ReadBinary(ifile, instance) || !ReadBinary(ifile, pos) ||
+            !ReadBinary(ifile, rot))
+            return false;
+        if (state.has_color && !ReadBinary(ifile, color))
+            return false;
+        if (state.has_scalar && !ReadBinary(ifile, scalar))
+            return false;
+        record.item = item;
+        record.instance = instance;
+        record.pos = ChVector<>(pos[0], pos[1], pos[2]);
+        record.rot = ChQuaternion<>(rot[0], rot[1], rot[2], rot[3]);
+        record.color = ChColor(color[0], color[1], color[2]);
+        record.scalar = scalar;
+        state.records.push_back(record);
+    }
+
+    return true;
+}
+
 void ChBlender::Add(std::shared_ptr<ChPhysicsItem> item) {
     m_items.insert(item);
 }
@@ -260,6 +430,11 @@ void ChBlender::ExportScript(const std::string& filename) {
     m_blender_frame_shapes.clear();
     m_blender_frame_materials.clear();
     m_blender_cameras.clear();
+    m_binary_instances.clear();
+    m_binary_items.clear();
+
+    if (binary_state && !single_asset_file)
+        throw ChException("ChBlender: binary state output requires a single asset file (see SetUseSingleAssetFile)");
 
     // Create directories
     if (base_path != "") {
@@ -342,6 +517,14 @@ void ChBlender::ExportScript(const std::string& filename) {
 
     }
 
+    // Generate the xxx.instances.py script (it will be populated by appending the lists of shapes
+    // used by the bodies saved in binary state files, only once per visual model)
+    if (binary_state) {
+        ChStreamOutAsciiFile instances_file((base_path + out_script_filename + ".instances.py").c_str());
+        instances_file << "# File containing the shape instances and item names used by binary state files.\n";
+        instances_file << "# This file is loaded automatically by the chrono_import.py add-on.\n\n";
+    }
+
     // This forces saving the non-mutable assets in the assets_file, at initial state. 
     ExportData();
 
@@ -899,6 +1082,152 @@ void ChBlender::ExportMaterials(ChStreamOutAsciiFile& mfile, std::unordered_map<
     }
 }
 
+// List the visual shapes of a visual model, as children of a Blender object.
+void ChBlender::ExportShapeList(ChStreamOutAsciiFile& mfile, std::shared_ptr<ChVisualModel> vis_model) {
+    mfile << "[\n";
+    for (const auto& shape_instance : vis_model->GetShapes()) {
+        const auto& shape = shape_instance.first;
+
+        // Process only "known" shapes (i.e., shapes that were included in the assets file)
+        if ((m_blender_shapes.find((size_t)shape.get()) != m_blender_shapes.end()) || 
+            (m_blender_frame_shapes.find((size_t)shape.get()) != m_blender_frame_shapes.end())) {
+
+            ChVector<> aux_scale(0,0,0);
+
+            std::string shapename("shape_" + std::to_string((size_t)shape.get()));
+            auto shape_frame = shape_instance.second;
+
+            // corner cases for performance reason (in case of multipe sphere asset with different radii, one blender mesh asset is used anyway, then use scale here)
+            if (auto mshpere = std::dynamic_pointer_cast<ChSphereShape>(shape))
+                aux_scale = ChVector<>(mshpere->GetSphereGeometry().rad, mshpere->GetSphereGeometry().rad, mshpere->GetSphereGeometry().rad);
+            if (auto mellipsoid = std::dynamic_pointer_cast<ChEllipsoidShape>(shape))
+                aux_scale = ChVector<>(mellipsoid->GetEllipsoidGeometry().rad.x(), mellipsoid->GetEllipsoidGeometry().rad.y(), mellipsoid->GetEllipsoidGeometry().rad.z());
+            if (auto mbox = std::dynamic_pointer_cast<ChBoxShape>(shape))
+                aux_scale = ChVector<>(mbox->GetBoxGeometry().GetLengths().x(), mbox->GetBoxGeometry().GetLengths().y(), mbox->GetBoxGeometry().GetLengths().z());
+            if (auto mcone = std::dynamic_pointer_cast<ChConeShape>(shape)) {
+                aux_scale = ChVector<>(mcone->GetConeGeometry().rad.x(), mcone->GetConeGeometry().rad.y(), mcone->GetConeGeometry().rad.z());
+            }
+            if (auto mcyl = std::dynamic_pointer_cast<ChCylinderShape>(shape)) {
+                aux_scale = ChVector<>(mcyl->GetCylinderGeometry().rad, mcyl->GetCylinderGeometry().rad, (mcyl->GetCylinderGeometry().p2 - mcyl->GetCylinderGeometry().p1).Length());
+                ChVector<> mdir = mcyl->GetCylinderGeometry().p2 - mcyl->GetCylinderGeometry().p1;
+                ChMatrix33<> mmatr; mmatr.Set_A_Xdir(mdir);
+                ChMatrix33<> mmatr2(Q_ROTATE_X_TO_Z);
+                ChFrame<> shape_frame_pre(0.5 * (mcyl->GetCylinderGeometry().p2 + mcyl->GetCylinderGeometry().p1), mmatr * mmatr2);
+                shape_frame *= shape_frame_pre;
+            }
+
+            mfile << " [";
+            mfile << "'" << shapename << "',(" << shape_frame.GetPos().x() << "," << shape_frame.GetPos().y() << "," << shape_frame.GetPos().z() << "),";
+            mfile << "(" << shape_frame.GetRot().e0() << "," << shape_frame.GetRot().e1() << "," << shape_frame.GetRot().e2() << "," << shape_frame.GetRot().e3() << "),";
+            mfile << "[";
+            if (shape->GetNumMaterials() && (!std::dynamic_pointer_cast<ChLineShape>(shape)) && (!std::dynamic_pointer_cast<ChPathShape>(shape)) ) {
+                for (int im = 0; im < shape->GetNumMaterials(); ++im) {
+                    mfile << "'";
+                    auto mat = shape->GetMaterial(im); 
+                    std::string matname("material_" + std::to_string((size_t)mat.get()));
+                    mfile << matname;
+                    mfile << "',";
+                }
+            }
+            mfile << "],";
+            if (aux_scale != VNULL) {
+                mfile << "(" << aux_scale.x() << "," << aux_scale.y() << "," << aux_scale.z() << ")";
+            }
+            mfile << "],\n";
+        }
+
+    } // end loop on shape instances
+
+    mfile << "]";
+}
+
+// Save the poses of bodies with only non-mutable visual shapes in a binary state file.
+// The list of shapes of each visual model (instance) and the name of each body are written only once, in the
+// instances file. The binary file has a 32-byte header (magic "CHBF", version, frame number, flags, time, number of
+// records) followed by one record per body: item ID, instance ID, position (3 doubles), rotation quaternion (4 floats),
+// and optionally a color (3 floats, if flags & 1) and a scalar (1 float, if flags & 2).
+// Positions are stored in double precision, so that bodies far from the origin are not jittering in the rendering.
+void ChBlender::ExportBinaryState(ChStreamOutAsciiFile& instances_file,
+                                  const std::string& filename,
+                                  std::unordered_set<ChPhysicsItem*>& exported) {
+    bool has_color = binary_fields && binary_fields->HasColor();
+    bool has_scalar = binary_fields && binary_fields->HasScalar();
+    uint32_t flags = (has_color ? 1 : 0) | (has_scalar ? 2 : 0);
+    size_t record_size = 2 * sizeof(uint32_t) + 3 * sizeof(double) + 4 * sizeof(float) + (has_color ? 3 * sizeof(float) : 0) +
+                         (has_scalar ? sizeof(float) : 0);
+
+    std::vector<char> buffer;
+    buffer.reserve(32 + m_items.size() * record_size);
+    buffer.insert(buffer.end(), {'C', 'H', 'B', 'F'});
+    AppendBinary(buffer, (uint32_t)2);
+    AppendBinary(buffer, (uint32_t)framenumber);
+    AppendBinary(buffer, flags);
+    AppendBinary(buffer, mSystem->GetChTime());
+    AppendBinary(buffer, (uint64_t)0);  // number of records, set below
+
+    for (const auto& item : m_items) {
+        auto body = std::dynamic_pointer_cast<ChBody>(item);
+        if (!body || !body->GetVisualModel() || !body->GetCameras().empty())
+            continue;
+        if (m_custom_commands.find((size_t)item.get()) != m_custom_commands.end())
+            continue;
+
+        // Consider only bodies with shapes already saved in the assets file and no per-frame shapes
+        auto vis_model = body->GetVisualModel();
+        bool has_stored_assets = false;
+        bool has_frame_assets = false;
+        for (const auto& shape_instance : vis_model->GetShapes()) {
+            size_t shape_id = (size_t)shape_instance.first.get();
+            has_stored_assets |= m_blender_shapes.find(shape_id) != m_blender_shapes.end();
+            has_frame_assets |= m_blender_frame_shapes.find(shape_id) != m_blender_frame_shapes.end();
+        }
+        if (!has_stored_assets || has_frame_assets)
+            continue;
+
+        // Write the list of shapes the first time a visual model is encountered
+        auto instance = m_binary_instances.find((size_t)vis_model.get());
+        if (instance == m_binary_instances.end()) {
+            instance = m_binary_instances.insert({(size_t)vis_model.get(), (unsigned int)m_binary_instances.size()}).first;
+            instances_file << "chrono_instances[" << instance->second << "] = ";
+            ExportShapeList(instances_file, vis_model);
+            instances_file << "\n";
+        }
+
+        // Write the item name the first time an item is encountered
+        auto item_id = m_binary_items.find((size_t)item.get());
+        if (item_id == m_binary_items.end()) {
+            item_id = m_binary_items.insert({(size_t)item.get(), (unsigned int)m_binary_items.size()}).first;
+            instances_file << "chrono_item_names[" << item_id->second << "] = '" << item->GetName() << "'\n";
+        }
+
+        ChFrame<> frame = body->GetFrame_REF_to_abs() >> blender_frame;
+        AppendBinary(buffer, (uint32_t)item_id->second);
+        AppendBinary(buffer, (uint32_t)instance->second);
+        AppendBinary(buffer, frame.GetPos().x());
+        AppendBinary(buffer, frame.GetPos().y());
+        AppendBinary(buffer, frame.GetPos().z());
+        AppendBinary(buffer, (float)frame.GetRot().e0());
+        AppendBinary(buffer, (float)frame.GetRot().e1());
+        AppendBinary(buffer, (float)frame.GetRot().e2());
+        AppendBinary(buffer, (float)frame.GetRot().e3());
+        if (has_color) {
+            ChColor color = binary_fields->GetColor(*body);
+            AppendBinary(buffer, color.R);
+            AppendBinary(buffer, color.G);
+            AppendBinary(buffer, color.B);
+        }
+        if (has_scalar)
+            AppendBinary(buffer, (float)binary_fields->GetScalar(*body));
+
+        exported.insert(item.get());
+    }
+
+    uint64_t num_records = exported.size();
+    std::memcpy(buffer.data() + 24, &num_records, sizeof(uint64_t));
+
+    binary_writer->Write(base_path + filename + ".bin", std::move(buffer));
+}
+
 void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
                              std::shared_ptr<ChPhysicsItem> item,
                              const ChFrame<>& parentframe) {
@@ -941,62 +1270,8 @@ void ChBlender::ExportItemState(ChStreamOutAsciiFile& state_file,
         }
         
         // List visual shapes to use as children of the Blender object (parent)
-
-        state_file << "[\n";
-        for (const auto& shape_instance : vis_model->GetShapes()) {
-            const auto& shape = shape_instance.first;
-
-            // Process only "known" shapes (i.e., shapes that were included in the assets file)
-            if ((m_blender_shapes.find((size_t)shape.get()) != m_blender_shapes.end()) || 
-                (m_blender_frame_shapes.find((size_t)shape.get()) != m_blender_frame_shapes.end())) {
-
-                ChVector<> aux_scale(0,0,0);
-
-                std::string shapename("shape_" + std::to_string((size_t)shape.get()));
-                auto shape_frame = shape_instance.second;
-
-                // corner cases for performance reason (in case of multipe sphere asset with different radii, one blender mesh asset is used anyway, then use scale here)
-                if (auto mshpere = std::dynamic_pointer_cast<ChSphereShape>(shape))
-                    aux_scale = ChVector<>(mshpere->GetSphereGeometry().rad, mshpere->GetSphereGeometry().rad, mshpere->GetSphereGeometry().rad);
-                if (auto mellipsoid = std::dynamic_pointer_cast<ChEllipsoidShape>(shape))
-                    aux_scale = ChVector<>(mellipsoid->GetEllipsoidGeometry().rad.x(), mellipsoid->GetEllipsoidGeometry().rad.y(), mellipsoid->GetEllipsoidGeometry().rad.z());
-                if (auto mbox = std::dynamic_pointer_cast<ChBoxShape>(shape))
-                    aux_scale = ChVector<>(mbox->GetBoxGeometry().GetLengths().x(), mbox->GetBoxGeometry().GetLengths().y(), mbox->GetBoxGeometry().GetLengths().z());
-                if (auto mcone = std::dynamic_pointer_cast<ChConeShape>(shape)) {
-                    aux_scale = ChVector<>(mcone->GetConeGeometry().rad.x(), mcone->GetConeGeometry().rad.y(), mcone->GetConeGeometry().rad.z());
-                }
-                if (auto mcyl = std::dynamic_pointer_cast<ChCylinderShape>(shape)) {
-                    aux_scale = ChVector<>(mcyl->GetCylinderGeometry().rad, mcyl->GetCylinderGeometry().rad, (mcyl->GetCylinderGeometry().p2 - mcyl->GetCylinderGeometry().p1).Length());
-                    ChVector<> mdir = mcyl->GetCylinderGeometry().p2 - mcyl->GetCylinderGeometry().p1;
-                    ChMatrix33<> mmatr; mmatr.Set_A_Xdir(mdir);
-                    ChMatrix33<> mmatr2(Q_ROTATE_X_TO_Z);
-                    ChFrame<> shape_frame_pre(0.5 * (mcyl->GetCylinderGeometry().p2 + mcyl->GetCylinderGeometry().p1), mmatr * mmatr2);
-                    shape_frame *= shape_frame_pre;
-                }
-
-                state_file << " [";
-                state_file << "'" << shapename << "',(" << shape_frame.GetPos().x() << "," << shape_frame.GetPos().y() << "," << shape_frame.GetPos().z() << "),";
-                state_file << "(" << shape_frame.GetRot().e0() << "," << shape_frame.GetRot().e1() << "," << shape_frame.GetRot().e2() << "," << shape_frame.GetRot().e3() << "),";
-                state_file << "[";
-                if (shape->GetNumMaterials() && (!std::dynamic_pointer_cast<ChLineShape>(shape)) && (!std::dynamic_pointer_cast<ChPathShape>(shape)) ) {
-                    for (int im = 0; im < shape->GetNumMaterials(); ++im) {
-                        state_file << "'";
-                        auto mat = shape->GetMaterial(im); 
-                        std::string matname("material_" + std::to_string((size_t)mat.get()));
-                        state_file << matname;
-                        state_file << "',";
-                    }
-                }
-                state_file << "],";
-                if (aux_scale != VNULL) {
-                    state_file << "(" << aux_scale.x() << "," << aux_scale.y() << "," << aux_scale.z() << ")";
-                }
-                state_file << "],\n";
-            }
-
-        } // end loop on shape instances
-
-        state_file << "],\n";
+        ExportShapeList(state_file, vis_model);
+        state_file << ",\n";
 
         // in case of particle clones, add array of positions&rotations of particles
 
@@ -1084,12 +1359,27 @@ void ChBlender::ExportData(const std::string& filename) {
             state_file << "\n\n";
         }
 
+        // Save the poses of bodies with non-mutable shapes in the binary state file, if enabled
+        std::unordered_set<ChPhysicsItem*> binary_items;
+        if (binary_state) {
+            if (!single_asset_file)
+                throw ChException("ChBlender: binary state output requires a single asset file (see SetUseSingleAssetFile)");
+            ChStreamOutAsciiFile instances_file((base_path + out_script_filename + ".instances.py").c_str(),
+                                                std::ios::app);
+            ExportBinaryState(instances_file, filename, binary_items);
+            state_file << "make_chrono_objects_binary('" << filename << ".bin')\n\n";
+        }
+
         // Save time-dependent data for the geometry of objects in ...nnnn.POV and in ...nnnn.DAT file
         for (const auto& item : m_items) {
             // Nothing to do if no visual model attached to this physics item
             if (!item->GetVisualModel())
                 continue;
 
+            // Nothing to do if already saved in the binary state file
+            if (binary_items.find(item.get()) != binary_items.end())
+                continue;
+
             // saving a body?
             if (const auto& body = std::dynamic_pointer_cast<ChBody>(item)) {
                 // Get the current coordinate frame of the i-th object
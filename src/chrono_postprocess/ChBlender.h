@@ -16,6 +16,7 @@
 #define CHBLENDER_H
 
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <unordered_set>
@@ -28,13 +29,15 @@
 namespace chrono {
 namespace postprocess {
 
+class ChBlenderBinaryWriter;
+
 /// Class for post processing implementation that generates scripts for Blender.
 /// The script can be used in Blender to render photo-realistic animations, if the chrono_import.py add-on is 
 /// installed in Blender. 
 class ChApiPostProcess ChBlender : public ChPostProcessBase {
   public:
     ChBlender(ChSystem* system);
-    ~ChBlender() {}
+    ~ChBlender();
 
     /// Modes for type of vector arrow length 
     enum class ContactSymbolType {
@@ -235,12 +238,73 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     /// would allow assets whose settings change during time (ex time-changing colors)
     void SetUseSingleAssetFile(bool use) { single_asset_file = use; }
 
+    /// Class to be used as a callback interface for adding per-body fields to the binary state files.
+    class ChApiPostProcess BinaryFieldCallback {
+      public:
+        virtual ~BinaryFieldCallback() {}
+
+        /// Return true if a color is provided for each body.
+        virtual bool HasColor() const { return false; }
+
+        /// Return true if a scalar value is provided for each body.
+        virtual bool HasScalar() const { return false; }
+
+        /// Return the color associated with the given body.
+        virtual ChColor GetColor(const ChBody& body) { return ChColor(); }
+
+        /// Return the scalar value associated with the given body.
+        virtual double GetScalar(const ChBody& body) { return 0; }
+    };
+
+    /// Enable/disable binary output of body states (default: false).
+    /// If enabled, ExportData() saves the poses of all bodies with only non-mutable visual shapes in a compact binary
+    /// file (e.g., state00001.bin). Each body references the list of its visual shapes through an instance ID; instances
+    /// are shared by all bodies using the same visual model and are written only once, in the xxx.instances.py file.
+    /// All other items (particle clouds, FEA meshes, bodies with mutable shapes or cameras, etc.) are still exported in
+    /// the state00001.py file. Binary state files are loaded by the chrono_import.py Blender add-on.
+    /// Binary output requires a single asset file (see SetUseSingleAssetFile); otherwise an exception is thrown on export.
+    /// If background_writing is true, binary files are written by a separate thread, overlapping with the simulation.
+    void SetBinaryStateOutput(bool val, bool background_writing = false);
+
+    /// Set a callback for adding optional per-body fields (color and/or scalar value) to the binary state files.
+    void SetBinaryFieldCallback(std::shared_ptr<BinaryFieldCallback> callback) { binary_fields = callback; }
+
+    /// Block until all pending binary state files were written.
+    void WaitForBinaryStateOutput();
+
+    /// Body record in a binary state file.
+    struct BinaryStateRecord {
+        unsigned int item;      ///< item ID (name in the xxx.instances.py file)
+        unsigned int instance;  ///< instance ID (list of shapes in the xxx.instances.py file)
+        ChVector<> pos;         ///< position, in Blender frame
+        ChQuaternion<> rot;     ///< rotation, in Blender frame
+        ChColor color;          ///< optional color
+        double scalar;          ///< optional scalar value
+    };
+
+    /// Contents of a binary state file.
+    struct BinaryState {
+        unsigned int frame;                      ///< frame number
+        double time;                             ///< simulation time
+        bool has_color;                          ///< records include a color?
+        bool has_scalar;                         ///< records include a scalar value?
+        std::vector<BinaryStateRecord> records;  ///< one record per body
+    };
+
+    /// Read a binary state file written with SetBinaryStateOutput.
+    /// Return false if the file cannot be opened, or is not a valid binary state file.
+    static bool ReadBinaryState(const std::string& filename, BinaryState& state);
+
   private:
     void UpdateRenderList();
     void ExportAssets(ChStreamOutAsciiFile& assets_file, ChStreamOutAsciiFile& state_file);
     void ExportShapes(ChStreamOutAsciiFile& assets_file, ChStreamOutAsciiFile& state_file, std::shared_ptr<ChPhysicsItem> item);
     void ExportMaterials(ChStreamOutAsciiFile& mfile,std::unordered_map<size_t, std::shared_ptr<ChVisualMaterial>>& m_materials, 
         const std::vector<std::shared_ptr<ChVisualMaterial>>& materials, bool per_frame, std::shared_ptr<ChVisualShape> mshape);
+    void ExportShapeList(ChStreamOutAsciiFile& mfile, std::shared_ptr<ChVisualModel> vis_model);
+    void ExportBinaryState(ChStreamOutAsciiFile& instances_file,
+                           const std::string& filename,
+                           std::unordered_set<ChPhysicsItem*>& exported);
     void ExportItemState(ChStreamOutAsciiFile& state_file,
                        std::shared_ptr<ChPhysicsItem> item,
                        const ChFrame<>& parentframe);
@@ -320,6 +384,12 @@ class ChApiPostProcess ChBlender : public ChPostProcessBase {
     std::string custom_data;
 
     bool single_asset_file;
+
+    bool binary_state;                                            ///< binary output of body states?
+    std::shared_ptr<BinaryFieldCallback> binary_fields;           ///< optional per-body fields in binary output
+    std::unique_ptr<ChBlenderBinaryWriter> binary_writer;         ///< writer of binary state files
+    std::unordered_map<size_t, unsigned int> m_binary_instances;  ///< instance IDs, per visual model
+    std::unordered_map<size_t, unsigned int> m_binary_items;      ///< item IDs, per physics item
 };
 
 }  // end namespace postprocess
@@ -19,13 +19,20 @@
 #include "chrono_sensor/ChSensorManager.h"
 
 #include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/sensors/ChDepthCamera.h"
 #include <iomanip>
 #include <iostream>
 
 namespace chrono {
 namespace sensor {
 
-CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system) : m_verbose(false), m_optix_reflections(9) {
+CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system)
+    : m_verbose(false), m_optix_reflections(9), m_cpu_threads(0) {
+#ifdef CHRONO_HAS_CUDA
+    m_backend = RenderBackend::OPTIX;
+#else
+    m_backend = RenderBackend::CPU;
+#endif
     // save the chrono system handle
     m_system = chrono_system;
     scene = chrono_types::make_shared<ChScene>();
@@ -34,21 +41,27 @@ CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system) : m_verb
 
 CH_SENSOR_API ChSensorManager::~ChSensorManager() {}
 
+#ifdef CHRONO_HAS_CUDA
 CH_SENSOR_API std::shared_ptr<ChOptixEngine> ChSensorManager::GetEngine(int context_id) {
     if (context_id < m_engines.size())
         return m_engines[context_id];
     std::cerr << "ERROR: index out of render group vector bounds\n";
     return NULL;
 }
+#endif
 
 CH_SENSOR_API void ChSensorManager::Update() {
     // update the scene
     // scene->PackFrame(m_system);
     //
     // have all the optix engines update their sensor
+#ifdef CHRONO_HAS_CUDA
     for (auto pEngine : m_engines) {
         pEngine->UpdateSensors(scene);
     }
+#endif
+    if (m_cpu_engine)
+        m_cpu_engine->UpdateSensors();
 
     // have the sensormanager update all of the non-optix sensor (IMU and GPS).
     // TODO: perhaps create a thread that takes care of this? Tradeoff since IMU should require some data from EVERY
@@ -67,9 +80,28 @@ CH_SENSOR_API std::vector<unsigned int> ChSensorManager::GetDeviceList() {
 }
 
 CH_SENSOR_API void ChSensorManager::ReconstructScenes() {
+#ifdef CHRONO_HAS_CUDA
     for (auto eng : m_engines) {
         eng->ConstructScene();
     }
+#endif
+    if (m_cpu_engine)
+        m_cpu_engine->ConstructScene();
+}
+
+CH_SENSOR_API void ChSensorManager::SetRenderBackend(RenderBackend backend, int num_threads) {
+    if (!m_render_sensor.empty()) {
+        std::cerr << "WARNING: render backend must be set before adding sensors. Ignoring...\n";
+        return;
+    }
+#ifndef CHRONO_HAS_CUDA
+    if (backend == RenderBackend::OPTIX) {
+        std::cerr << "WARNING: OptiX render backend not available (Chrono built without CUDA). Using CPU backend.\n";
+        backend = RenderBackend::CPU;
+    }
+#endif
+    m_backend = backend;
+    m_cpu_threads = num_threads;
 }
 
 CH_SENSOR_API void ChSensorManager::SetMaxEngines(int num_groups) {
@@ -93,6 +125,24 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
 
     if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
         m_render_sensor.push_back(sensor);
+
+        if (m_backend == RenderBackend::CPU) {
+            if (!m_cpu_engine) {
+                m_cpu_engine = chrono_types::make_shared<ChCPURayEngine>(m_system, m_cpu_threads);
+                if (m_verbose)
+                    std::cout << "Created CPU ray casting engine with " << m_cpu_engine->GetNumThreads()
+                              << " threads\n";
+            }
+            m_cpu_engine->AssignSensor(pOptixSensor);
+            return;
+        }
+
+        if (std::dynamic_pointer_cast<ChDepthCamera>(sensor)) {
+            throw std::runtime_error("Depth cameras are only supported by the CPU render backend");
+        }
+
+#ifdef CHRONO_HAS_CUDA
+
         //******** give each render group all sensor with same update rate *************//
         bool found_group = false;
 
@@ -135,6 +185,7 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
             std::cerr << "Failed to create a ChOptixEngine, with error:\n" << e.what() << "\n";
             exit(1);
         }
+#endif
     } else {
         if (!m_dynamics_manager) {
             m_dynamics_manager = chrono_types::make_shared<ChDynamicsManager>(m_system);
@@ -22,10 +22,14 @@
 // API include
 #include "chrono_sensor/ChApiSensor.h"
 
+#include "chrono/ChConfig.h"
 #include "chrono/physics/ChSystem.h"
 
 #include "chrono_sensor/sensors/ChSensor.h"
-#include "chrono_sensor/optix/ChOptixEngine.h"
+#ifdef CHRONO_HAS_CUDA
+    #include "chrono_sensor/optix/ChOptixEngine.h"
+#endif
+#include "chrono_sensor/cpu/ChCPURayEngine.h"
 #include "chrono_sensor/ChDynamicsManager.h"
 #include "chrono_sensor/optix/scene/ChScene.h"
 
@@ -42,6 +46,12 @@ namespace sensor {
 
 class CH_SENSOR_API ChSensorManager {
   public:
+    /// Backend used for rendering sensors derived from ChOptixSensor.
+    enum class RenderBackend {
+        OPTIX,  ///< GPU ray tracing with OptiX (default)
+        CPU     ///< multi-threaded CPU ray casting (lidar, segmentation cameras, and depth cameras only)
+    };
+
     /// Class constructor
     /// @param chrono_system The chrono system with which the sensor manager is associated. Used for time management.
     /// created.
@@ -70,6 +80,7 @@ class CH_SENSOR_API ChSensorManager {
     /// @return List of device IDs that the manager will try to use when rendering.
     std::vector<unsigned int> GetDeviceList();
 
+#ifdef CHRONO_HAS_CUDA
     /// Get the number of engines the manager is currently using
     /// @return An integer number of OptiX engines
     int GetNumEngines() { return (int)m_engines.size(); }
@@ -78,6 +89,22 @@ class CH_SENSOR_API ChSensorManager {
     /// @param context_id The ID of the engine to be returned
     /// @return A shared pointer to an OptiX engine the manager is using
     std::shared_ptr<ChOptixEngine> GetEngine(int context_id);
+#endif
+
+    /// Set the backend used for rendering sensors derived from ChOptixSensor. Must be called before adding sensors.
+    /// The CPU backend casts rays against the box, sphere, cylinder, and rigid mesh visual shapes in the system. It
+    /// writes host buffers and does not use a CUDA device, so its sensors can only use ChFilterCPUAccess filters.
+    /// Depth cameras (ChDepthCamera) are only supported by the CPU backend, which is also the only backend available
+    /// when Chrono is built without CUDA.
+    /// @param backend The render backend.
+    /// @param num_threads Number of ray casting threads for the CPU backend (if <= 0, use all hardware threads).
+    void SetRenderBackend(RenderBackend backend, int num_threads = 0);
+
+    /// Get the backend used for rendering sensors derived from ChOptixSensor.
+    RenderBackend GetRenderBackend() const { return m_backend; }
+
+    /// Get the CPU ray casting engine (nullptr if no sensor uses the CPU backend).
+    std::shared_ptr<ChCPURayEngine> GetCPUEngine() const { return m_cpu_engine; }
 
     /// Calls on the sensor manager to rebuild the scene, translating all objects from the Chrono system into their
     /// appropriate optix objects.
@@ -121,8 +148,13 @@ class CH_SENSOR_API ChSensorManager {
 
     // class variables
     ChSystem* m_system;                                     ///< Chrono system the manager is attached to
+#ifdef CHRONO_HAS_CUDA
     std::vector<std::shared_ptr<ChOptixEngine>> m_engines;  ///< The optix engine(s) used for rendered sensors
+#endif
     std::shared_ptr<ChDynamicsManager> m_dynamics_manager;  ///< Container for updating dynamic sensors
+    RenderBackend m_backend;                                ///< Backend for rendered sensors
+    int m_cpu_threads;                                      ///< Number of ray casting threads for the CPU backend
+    std::shared_ptr<ChCPURayEngine> m_cpu_engine;           ///< CPU engine used for rendered sensors
 
     int m_allowable_groups = 1;  ///< Default maximum number of allowable engines
 
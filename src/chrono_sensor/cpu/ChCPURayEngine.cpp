@@ -0,0 +1,99 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// CPU ray-casting engine for lidar, segmentation camera, and depth camera sensors.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <iostream>
+
+#include "chrono_sensor/cpu/ChCPURayEngine.h"
+#include "chrono_sensor/cpu/ChFilterCPUAccess.h"
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChCPURayEngine::ChCPURayEngine(ChSystem* sys, int num_threads)
+    : m_system(sys), m_scene_constructed(false) {
+    m_pool = chrono_types::make_shared<ChCPUWorkerPool>(num_threads);
+    m_scene = chrono_types::make_shared<ChCPURayScene>(sys);
+}
+
+CH_SENSOR_API ChCPURayEngine::~ChCPURayEngine() {}
+
+CH_SENSOR_API void ChCPURayEngine::AssignSensor(std::shared_ptr<ChOptixSensor> sensor) {
+    if (std::find(m_assignedSensor.begin(), m_assignedSensor.end(), sensor) != m_assignedSensor.end()) {
+        std::cerr << "WARNING: This sensor already exists in manager. Ignoring this addition\n";
+        return;
+    }
+
+    // the render filter produces host buffers, which only host filters can process
+    for (auto f : sensor->GetFilterList()) {
+        if (!std::dynamic_pointer_cast<ChFilterCPUHost>(f)) {
+            throw std::runtime_error("Filter '" + f->Name() +
+                                     "' not supported by the CPU render backend. Use ChFilterCPUAccess filters.");
+        }
+    }
+
+    // create a ChFilterCPURender and push to front of filter list
+    auto cpu_filter = chrono_types::make_shared<ChFilterCPURender>(m_scene, m_pool);
+    sensor->PushFilterFront(cpu_filter);
+    sensor->LockFilterList();
+
+    std::shared_ptr<SensorBuffer> buffer;
+    for (auto f : sensor->GetFilterList()) {
+        f->Initialize(sensor, buffer);
+    }
+
+    m_assignedSensor.push_back(sensor);
+    m_assignedRenderers.push_back(cpu_filter);
+}
+
+CH_SENSOR_API void ChCPURayEngine::ConstructScene() {
+    m_scene->Construct();
+    m_scene_constructed = true;
+}
+
+CH_SENSOR_API void ChCPURayEngine::UpdateSensors() {
+    if (!m_scene_constructed) {
+        ConstructScene();
+    }
+
+    bool scene_updated = false;
+    float t = (float)m_system->GetChTime();
+
+    for (int i = 0; i < m_assignedSensor.size(); i++) {
+        auto sensor = m_assignedSensor[i];
+        if (m_system->GetChTime() >
+            sensor->GetNumLaunches() / sensor->GetUpdateRate() + sensor->GetCollectionWindow() - 1e-7) {
+            // update the scene once for all sensors rendered at this time
+            if (!scene_updated) {
+                m_scene->Update();
+                scene_updated = true;
+            }
+
+            sensor->IncrementNumLaunches();
+            m_assignedRenderers[i]->m_time_stamp = t;
+
+            // step through the filter list, applying each filter
+            for (auto filter : sensor->GetFilterList()) {
+                filter->Apply();
+            }
+        }
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
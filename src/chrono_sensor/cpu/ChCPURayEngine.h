@@ -0,0 +1,89 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// CPU ray-casting engine for lidar, segmentation camera, and depth camera
+// sensors. Used in place of ChOptixEngine when OptiX ray tracing is not available.
+//
+// =============================================================================
+
+#ifndef CHCPURAYENGINE_H
+#define CHCPURAYENGINE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/cpu/ChCPURayScene.h"
+#include "chrono_sensor/cpu/ChCPUWorkerPool.h"
+#include "chrono_sensor/cpu/ChFilterCPURender.h"
+
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor
+/// @{
+
+/// CPU ray-casting engine.
+/// Each assigned sensor gets a ChFilterCPURender at the front of its filter list. Sensors are rendered synchronously,
+/// from within UpdateSensors, with the rays of each sensor distributed over a persistent pool of worker threads owned
+/// by the engine. Sensor data is produced in host buffers and can only be consumed by host filters (ChFilterCPUAccess);
+/// no CUDA device is used. The visual
+/// shapes of the Chrono system are collected once (see ConstructScene) and their positions are updated whenever a
+/// sensor is rendered. The sensor collection window is ignored (no motion blur).
+class CH_SENSOR_API ChCPURayEngine {
+  public:
+    /// Class constructor
+    /// @param sys Pointer to the ChSystem that defines the simulation
+    /// @param num_threads Number of ray casting threads (if <= 0, the number of hardware threads is used)
+    ChCPURayEngine(ChSystem* sys, int num_threads = 0);
+
+    ~ChCPURayEngine();
+
+    /// Add a sensor for this engine to manage and update
+    /// @param sensor A shared pointer to a lidar, segmentation camera, or depth camera sensor
+    void AssignSensor(std::shared_ptr<ChOptixSensor> sensor);
+
+    /// Render and process all sensors that are due at the current simulation time.
+    void UpdateSensors();
+
+    /// Collect the visual shapes from the Chrono system into the ray casting scene.
+    void ConstructScene();
+
+    /// Get the number of ray casting threads.
+    int GetNumThreads() const { return m_pool->GetNumThreads(); }
+
+    /// Gives the user the scene used for ray casting.
+    std::shared_ptr<ChCPURayScene> GetScene() const { return m_scene; }
+
+    /// Gives the user the sensors assigned to this engine.
+    std::vector<std::shared_ptr<ChOptixSensor>> GetSensor() { return m_assignedSensor; }
+
+  private:
+    ChSystem* m_system;                                  ///< the chrono system that defines the scene
+    bool m_scene_constructed;                            ///< true once ConstructScene has been called
+    std::shared_ptr<ChCPURayScene> m_scene;              ///< scene against which rays are cast
+    std::shared_ptr<ChCPUWorkerPool> m_pool;             ///< ray casting threads, shared by all sensors
+    std::vector<std::shared_ptr<ChOptixSensor>> m_assignedSensor;         ///< list of sensors this engine manages
+    std::vector<std::shared_ptr<ChFilterCPURender>> m_assignedRenderers;  ///< render filter of each sensor
+};
+
+/// @} sensor
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,535 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// CPU ray-casting scene built from the visual shapes of a Chrono system.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "chrono_sensor/cpu/ChCPURayScene.h"
+
+#include "chrono/assets/ChBoxShape.h"
+#include "chrono/assets/ChCylinderShape.h"
+#include "chrono/assets/ChSphereShape.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/assets/ChVisualModel.h"
+
+namespace chrono {
+namespace sensor {
+
+typedef ChCPURayScene::AABB AABB;
+typedef ChCPURayScene::Node Node;
+
+static const int kMeshLeafSize = 4;
+static const int kSceneLeafSize = 2;
+static const int kStackSize = 64;
+
+// -----------------------------------------------------------------------------
+// BVH utilities
+// -----------------------------------------------------------------------------
+
+static AABB EmptyBox() {
+    const double inf = std::numeric_limits<double>::max();
+    return AABB{ChVector<>(+inf), ChVector<>(-inf)};
+}
+
+static void Grow(AABB& box, const ChVector<>& p) {
+    box.min = Vmin(box.min, p);
+    box.max = Vmax(box.max, p);
+}
+
+static void Grow(AABB& box, const AABB& b) {
+    box.min = Vmin(box.min, b.min);
+    box.max = Vmax(box.max, b.max);
+}
+
+// Recursively build a BVH over the primitives order[start, end), splitting at the median of the primitive centers
+// along the longest axis. Returns the index of the created node.
+static int BuildNode(std::vector<Node>& nodes,
+                     std::vector<int>& order,
+                     const std::vector<AABB>& boxes,
+                     const std::vector<ChVector<>>& centers,
+                     int start,
+                     int end,
+                     int leaf_size) {
+    int index = (int)nodes.size();
+    nodes.push_back(Node());
+
+    AABB box = EmptyBox();
+    AABB cbox = EmptyBox();
+    for (int i = start; i < end; i++) {
+        Grow(box, boxes[order[i]]);
+        Grow(cbox, centers[order[i]]);
+    }
+    nodes[index].box = box;
+
+    ChVector<> extent = cbox.max - cbox.min;
+    int axis = 0;
+    if (extent.y() > extent[axis])
+        axis = 1;
+    if (extent.z() > extent[axis])
+        axis = 2;
+
+    if (end - start <= leaf_size || extent[axis] <= 0) {
+        nodes[index].offset = start;
+        nodes[index].count = end - start;
+        return index;
+    }
+
+    int mid = (start + end) / 2;
+    std::nth_element(order.begin() + start, order.begin() + mid, order.begin() + end,
+                     [&centers, axis](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+
+    BuildNode(nodes, order, boxes, centers, start, mid, leaf_size);
+    int right = BuildNode(nodes, order, boxes, centers, mid, end, leaf_size);
+    nodes[index].offset = right;
+    nodes[index].count = 0;
+    return index;
+}
+
+// Slab test of a ray, given by its origin and inverse direction, against an AABB.
+static bool IntersectBox(const AABB& box, const ChVector<>& origin, const ChVector<>& inv_dir, double tmin, double tmax) {
+    for (int i = 0; i < 3; i++) {
+        double t0 = (box.min[i] - origin[i]) * inv_dir[i];
+        double t1 = (box.max[i] - origin[i]) * inv_dir[i];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        tmin = t0 > tmin ? t0 : tmin;
+        tmax = t1 < tmax ? t1 : tmax;
+        if (tmin > tmax)
+            return false;
+    }
+    return true;
+}
+
+static ChVector<> InverseDirection(const ChVector<>& dir) {
+    const double inf = std::numeric_limits<double>::max();
+    return ChVector<>(dir.x() != 0 ? 1 / dir.x() : inf,  //
+                      dir.y() != 0 ? 1 / dir.y() : inf,  //
+                      dir.z() != 0 ? 1 / dir.z() : inf);
+}
+
+// -----------------------------------------------------------------------------
+// Shape intersection (in the shape local frame)
+// -----------------------------------------------------------------------------
+
+static bool IntersectLocalBox(const ChVector<>& hlen,
+                              const ChVector<>& o,
+                              const ChVector<>& d,
+                              double tmin,
+                              double tmax,
+                              double& t,
+                              ChVector<>& n) {
+    double tnear = -std::numeric_limits<double>::max();
+    double tfar = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; i++) {
+        if (d[i] == 0) {
+            if (o[i] < -hlen[i] || o[i] > hlen[i])
+                return false;
+            continue;
+        }
+        double t0 = (-hlen[i] - o[i]) / d[i];
+        double t1 = (+hlen[i] - o[i]) / d[i];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        tnear = std::max(tnear, t0);
+        tfar = std::min(tfar, t1);
+        if (tnear > tfar)
+            return false;
+    }
+    t = tnear >= tmin ? tnear : tfar;
+    if (t < tmin || t > tmax)
+        return false;
+
+    // normal along the axis of the face closest to the hit point
+    ChVector<> p = o + t * d;
+    int axis = 0;
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < 3; i++) {
+        double dist = std::abs(std::abs(p[i]) - hlen[i]);
+        if (dist < best) {
+            best = dist;
+            axis = i;
+        }
+    }
+    n = VNULL;
+    n[axis] = p[axis] > 0 ? 1 : -1;
+    return true;
+}
+
+static bool IntersectLocalSphere(double radius,
+                                 const ChVector<>& o,
+                                 const ChVector<>& d,
+                                 double tmin,
+                                 double tmax,
+                                 double& t,
+                                 ChVector<>& n) {
+    double b = Vdot(o, d);
+    double c = Vdot(o, o) - radius * radius;
+    double disc = b * b - c;
+    if (disc < 0)
+        return false;
+    double sq = std::sqrt(disc);
+    t = -b - sq;
+    if (t < tmin)
+        t = -b + sq;
+    if (t < tmin || t > tmax)
+        return false;
+    n = (o + t * d) / radius;
+    return true;
+}
+
+static bool IntersectLocalCylinder(const ChVector<>& p1,
+                                   const ChVector<>& p2,
+                                   double radius,
+                                   const ChVector<>& o,
+                                   const ChVector<>& d,
+                                   double tmin,
+                                   double tmax,
+                                   double& t,
+                                   ChVector<>& n) {
+    ChVector<> ba = p2 - p1;
+    ChVector<> oc = o - p1;
+    double baba = Vdot(ba, ba);
+    double bard = Vdot(ba, d);
+    double baoc = Vdot(ba, oc);
+
+    bool found = false;
+    t = tmax;
+
+    // lateral surface
+    double k2 = baba - bard * bard;
+    double k1 = baba * Vdot(oc, d) - baoc * bard;
+    double k0 = baba * Vdot(oc, oc) - baoc * baoc - radius * radius * baba;
+    if (std::abs(k2) > 1e-12) {
+        double h = k1 * k1 - k2 * k0;
+        if (h >= 0) {
+            h = std::sqrt(h);
+            for (double tc : {(-k1 - h) / k2, (-k1 + h) / k2}) {
+                double y = baoc + tc * bard;
+                if (tc >= tmin && tc <= t && y > 0 && y < baba) {
+                    t = tc;
+                    n = (oc + tc * d - ba * (y / baba)) / radius;
+                    found = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // end caps
+    if (bard != 0) {
+        ChVector<> axis = ba / std::sqrt(baba);
+        for (int i = 0; i < 2; i++) {
+            const ChVector<>& c = (i == 0) ? p1 : p2;
+            double tc = Vdot(c - o, ba) / bard;
+            if (tc < tmin || tc > t)
+                continue;
+            if ((o + tc * d - c).Length2() <= radius * radius) {
+                t = tc;
+                n = (i == 0) ? -axis : axis;
+                found = true;
+            }
+        }
+    }
+
+    return found;
+}
+
+static bool IntersectLocalMesh(const ChCPURayScene::MeshBVH& mesh,
+                               const ChVector<>& o,
+                               const ChVector<>& d,
+                               double tmin,
+                               double tmax,
+                               double& t,
+                               ChVector<>& n) {
+    if (mesh.nodes.empty())
+        return false;
+
+    ChVector<> inv_dir = InverseDirection(d);
+    int stack[kStackSize];
+    int top = 0;
+    stack[top++] = 0;
+    int hit_tri = -1;
+    t = tmax;
+
+    while (top > 0) {
+        const Node& node = mesh.nodes[stack[--top]];
+        if (!IntersectBox(node.box, o, inv_dir, tmin, t))
+            continue;
+        if (node.count == 0) {
+            int left = (int)(&node - mesh.nodes.data()) + 1;
+            stack[top++] = node.offset;
+            stack[top++] = left;
+            continue;
+        }
+        // Moller-Trumbore ray-triangle intersection
+        for (int i = node.offset; i < node.offset + node.count; i++) {
+            ChVector<> pvec = Vcross(d, mesh.e2[i]);
+            double det = Vdot(mesh.e1[i], pvec);
+            if (std::abs(det) < 1e-14)
+                continue;
+            double inv_det = 1 / det;
+            ChVector<> tvec = o - mesh.v0[i];
+            double u = Vdot(tvec, pvec) * inv_det;
+            if (u < 0 || u > 1)
+                continue;
+            ChVector<> qvec = Vcross(tvec, mesh.e1[i]);
+            double v = Vdot(d, qvec) * inv_det;
+            if (v < 0 || u + v > 1)
+                continue;
+            double tt = Vdot(mesh.e2[i], qvec) * inv_det;
+            if (tt >= tmin && tt < t) {
+                t = tt;
+                hit_tri = i;
+            }
+        }
+    }
+
+    if (hit_tri < 0)
+        return false;
+    n = Vcross(mesh.e1[hit_tri], mesh.e2[hit_tri]).GetNormalized();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+ChCPURayScene::ChCPURayScene(ChSystem* system) : m_system(system) {}
+
+ChCPURayScene::~ChCPURayScene() {}
+
+void ChCPURayScene::Construct() {
+    m_instances.clear();
+    for (auto& body : m_system->Get_bodylist())
+        AddShapes(body.get());
+    for (auto& item : m_system->Get_otherphysicslist())
+        AddShapes(item.get());
+
+    // release BVHs of meshes no longer in the scene
+    for (auto it = m_meshes.begin(); it != m_meshes.end();) {
+        if (it->second.use_count() == 1)
+            it = m_meshes.erase(it);
+        else
+            ++it;
+    }
+
+    Update();
+}
+
+void ChCPURayScene::AddShapes(ChPhysicsItem* item) {
+    auto vis_model = item->GetVisualModel();
+    if (!vis_model)
+        return;
+
+    for (const auto& shape_instance : vis_model->GetShapes()) {
+        const auto& shape = shape_instance.first;
+        if (!shape->IsVisible())
+            continue;
+
+        Instance inst;
+        inst.item = item;
+        inst.shape_frame = shape_instance.second;
+        inst.radius = 0;
+        inst.class_id = 0;
+        inst.instance_id = 0;
+        if (shape->GetNumMaterials() > 0) {
+            inst.class_id = shape->GetMaterial(0)->GetClassID();
+            inst.instance_id = shape->GetMaterial(0)->GetInstanceID();
+        }
+
+        if (auto box = std::dynamic_pointer_cast<ChBoxShape>(shape)) {
+            inst.type = ShapeType::BOX;
+            inst.p1 = box->GetBoxGeometry().GetSize();
+            inst.local_box = AABB{-inst.p1, inst.p1};
+        } else if (auto sphere = std::dynamic_pointer_cast<ChSphereShape>(shape)) {
+            inst.type = ShapeType::SPHERE;
+            inst.radius = sphere->GetSphereGeometry().rad;
+            inst.local_box = AABB{ChVector<>(-inst.radius), ChVector<>(inst.radius)};
+        } else if (auto cyl = std::dynamic_pointer_cast<ChCylinderShape>(shape)) {
+            inst.type = ShapeType::CYLINDER;
+            inst.p1 = cyl->GetCylinderGeometry().p1;
+            inst.p2 = cyl->GetCylinderGeometry().p2;
+            inst.radius = cyl->GetCylinderGeometry().rad;
+            inst.local_box = AABB{Vmin(inst.p1, inst.p2) - ChVector<>(inst.radius), Vmax(inst.p1, inst.p2) + ChVector<>(inst.radius)};
+        } else if (auto trimesh = std::dynamic_pointer_cast<ChTriangleMeshShape>(shape)) {
+            if (trimesh->IsMutable() || !trimesh->GetMesh())
+                continue;
+            inst.type = ShapeType::MESH;
+            inst.mesh = GetMeshBVH(trimesh->GetMesh(), trimesh->GetScale());
+            if (inst.mesh->nodes.empty())
+                continue;
+            inst.local_box = inst.mesh->nodes[0].box;
+        } else {
+            continue;
+        }
+
+        m_instances.push_back(inst);
+    }
+}
+
+std::shared_ptr<ChCPURayScene::MeshBVH> ChCPURayScene::GetMeshBVH(
+    std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh,
+    const ChVector<>& scale) {
+    auto key = std::make_tuple((const void*)trimesh.get(), scale.x(), scale.y(), scale.z());
+    auto it = m_meshes.find(key);
+    if (it != m_meshes.end())
+        return it->second;
+
+    const auto& vertices = trimesh->getCoordsVertices();
+    const auto& faces = trimesh->getIndicesVertexes();
+    int num_tris = (int)faces.size();
+
+    std::vector<AABB> boxes(num_tris);
+    std::vector<ChVector<>> centers(num_tris);
+    std::vector<int> order(num_tris);
+    for (int i = 0; i < num_tris; i++) {
+        AABB box = EmptyBox();
+        for (int j = 0; j < 3; j++)
+            Grow(box, vertices[faces[i][j]] * scale);
+        boxes[i] = box;
+        centers[i] = 0.5 * (box.min + box.max);
+        order[i] = i;
+    }
+
+    auto bvh = chrono_types::make_shared<MeshBVH>();
+    if (num_tris > 0)
+        BuildNode(bvh->nodes, order, boxes, centers, 0, num_tris, kMeshLeafSize);
+
+    // store triangles in BVH order, so that leaves reference contiguous ranges
+    bvh->v0.resize(num_tris);
+    bvh->e1.resize(num_tris);
+    bvh->e2.resize(num_tris);
+    for (int i = 0; i < num_tris; i++) {
+        const auto& face = faces[order[i]];
+        ChVector<> v0 = vertices[face[0]] * scale;
+        bvh->v0[i] = v0;
+        bvh->e1[i] = vertices[face[1]] * scale - v0;
+        bvh->e2[i] = vertices[face[2]] * scale - v0;
+    }
+
+    m_meshes[key] = bvh;
+    return bvh;
+}
+
+void ChCPURayScene::Update() {
+    int num_instances = (int)m_instances.size();
+    std::vector<AABB> boxes(num_instances);
+    std::vector<ChVector<>> centers(num_instances);
+    m_order.resize(num_instances);
+
+    for (int i = 0; i < num_instances; i++) {
+        auto& inst = m_instances[i];
+        inst.frame = inst.item->GetVisualModelFrame() * inst.shape_frame;
+
+        // transform the local bounding box to the absolute frame
+        ChVector<> center = 0.5 * (inst.local_box.min + inst.local_box.max);
+        ChVector<> hlen = 0.5 * (inst.local_box.max - inst.local_box.min);
+        const ChMatrix33<>& R = inst.frame.GetA();
+        ChVector<> whlen(std::abs(R(0, 0)) * hlen.x() + std::abs(R(0, 1)) * hlen.y() + std::abs(R(0, 2)) * hlen.z(),
+                         std::abs(R(1, 0)) * hlen.x() + std::abs(R(1, 1)) * hlen.y() + std::abs(R(1, 2)) * hlen.z(),
+                         std::abs(R(2, 0)) * hlen.x() + std::abs(R(2, 1)) * hlen.y() + std::abs(R(2, 2)) * hlen.z());
+        centers[i] = inst.frame.TransformPointLocalToParent(center);
+        boxes[i] = AABB{centers[i] - whlen, centers[i] + whlen};
+        m_order[i] = i;
+    }
+
+    m_nodes.clear();
+    if (num_instances > 0)
+        BuildNode(m_nodes, m_order, boxes, centers, 0, num_instances, kSceneLeafSize);
+}
+
+bool ChCPURayScene::IntersectInstance(const Instance& inst,
+                                      const ChVector<>& origin,
+                                      const ChVector<>& dir,
+                                      double tmin,
+                                      double tmax,
+                                      double& t,
+                                      ChVector<>& normal) const {
+    // rigid transform, so distances along the ray are preserved
+    ChVector<> o = inst.frame.TransformPointParentToLocal(origin);
+    ChVector<> d = inst.frame.TransformDirectionParentToLocal(dir);
+    ChVector<> n;
+
+    bool found = false;
+    switch (inst.type) {
+        case ShapeType::BOX:
+            found = IntersectLocalBox(inst.p1, o, d, tmin, tmax, t, n);
+            break;
+        case ShapeType::SPHERE:
+            found = IntersectLocalSphere(inst.radius, o, d, tmin, tmax, t, n);
+            break;
+        case ShapeType::CYLINDER:
+            found = IntersectLocalCylinder(inst.p1, inst.p2, inst.radius, o, d, tmin, tmax, t, n);
+            break;
+        case ShapeType::MESH:
+            found = IntersectLocalMesh(*inst.mesh, o, d, tmin, tmax, t, n);
+            break;
+    }
+
+    if (found)
+        normal = inst.frame.TransformDirectionLocalToParent(n);
+    return found;
+}
+
+bool ChCPURayScene::Intersect(const ChVector<>& origin,
+                              const ChVector<>& dir,
+                              double tmin,
+                              double tmax,
+                              Hit& hit) const {
+    if (m_nodes.empty())
+        return false;
+
+    ChVector<> inv_dir = InverseDirection(dir);
+    int stack[kStackSize];
+    int top = 0;
+    stack[top++] = 0;
+    int hit_inst = -1;
+    double t_best = tmax;
+
+    while (top > 0) {
+        int index = stack[--top];
+        const Node& node = m_nodes[index];
+        if (!IntersectBox(node.box, origin, inv_dir, tmin, t_best))
+            continue;
+        if (node.count == 0) {
+            stack[top++] = node.offset;
+            stack[top++] = index + 1;
+            continue;
+        }
+        for (int i = node.offset; i < node.offset + node.count; i++) {
+            const auto& inst = m_instances[m_order[i]];
+            double t;
+            ChVector<> normal;
+            if (IntersectInstance(inst, origin, dir, tmin, t_best, t, normal)) {
+                t_best = t;
+                hit_inst = m_order[i];
+                hit.normal = normal;
+            }
+        }
+    }
+
+    if (hit_inst < 0)
+        return false;
+
+    hit.distance = t_best;
+    hit.class_id = m_instances[hit_inst].class_id;
+    hit.instance_id = m_instances[hit_inst].instance_id;
+    return true;
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// CPU ray-casting scene built from the visual shapes of a Chrono system.
+// Rigid meshes are stored in a local-frame BVH, built once and shared by all
+// instances of the same mesh. Shape instances are organized in a top-level BVH
+// rebuilt at each update from the current body positions.
+//
+// =============================================================================
+
+#ifndef CHCPURAYSCENE_H
+#define CHCPURAYSCENE_H
+
+#include <map>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_scene
+/// @{
+
+/// Scene used by the CPU ray-casting backend.
+/// Supports box, sphere, cylinder, and non-deformable triangle mesh visual shapes attached to bodies and to other
+/// physics items. All query functions are const and can be called concurrently from multiple threads.
+class CH_SENSOR_API ChCPURayScene {
+  public:
+    /// Information about the closest intersection along a ray.
+    struct Hit {
+        double distance;                 ///< distance from the ray origin to the hit point
+        ChVector<> normal;               ///< world-frame unit normal at the hit point
+        unsigned short int class_id;     ///< class ID of the visual material (0 if no material)
+        unsigned short int instance_id;  ///< instance ID of the visual material (0 if no material)
+    };
+
+    ChCPURayScene(ChSystem* system);
+    ~ChCPURayScene();
+
+    /// Collect all visual shapes from the associated Chrono system.
+    /// Must be called again if visual models are added or removed.
+    void Construct();
+
+    /// Update the world transforms of all shape instances and rebuild the top-level BVH.
+    void Update();
+
+    /// Find the closest intersection of the ray (origin, dir) with the scene, in the interval [tmin, tmax].
+    /// The ray direction must be a unit vector.
+    bool Intersect(const ChVector<>& origin, const ChVector<>& dir, double tmin, double tmax, Hit& hit) const;
+
+    /// Get the number of shape instances in the scene.
+    size_t GetNumInstances() const { return m_instances.size(); }
+
+    /// Axis-aligned bounding box.
+    struct AABB {
+        ChVector<> min;
+        ChVector<> max;
+    };
+
+    /// BVH node. Interior nodes have count = 0 and store the index of their second child in 'offset' (the first
+    /// child immediately follows the node). Leaves store the range [offset, offset+count) in the primitive list.
+    struct Node {
+        AABB box;
+        int offset;
+        int count;
+    };
+
+    /// Local-frame BVH over the triangles of a mesh.
+    struct MeshBVH {
+        std::vector<ChVector<>> v0;  ///< first vertex of each triangle (scaled, in BVH order)
+        std::vector<ChVector<>> e1;  ///< first edge of each triangle
+        std::vector<ChVector<>> e2;  ///< second edge of each triangle
+        std::vector<Node> nodes;
+    };
+
+  private:
+    enum class ShapeType { BOX, SPHERE, CYLINDER, MESH };
+
+    struct Instance {
+        ShapeType type;
+        ChPhysicsItem* item;            ///< owner physics item
+        ChFrame<> shape_frame;          ///< shape frame relative to the owner visual model frame
+        ChFrame<> frame;                ///< current shape frame in the absolute frame
+        ChVector<> p1;                  ///< box half-lengths, or cylinder base center
+        ChVector<> p2;                  ///< cylinder second base center
+        double radius;                  ///< sphere or cylinder radius
+        std::shared_ptr<MeshBVH> mesh;  ///< mesh BVH
+        AABB local_box;                 ///< bounding box in the shape frame
+        unsigned short int class_id;
+        unsigned short int instance_id;
+    };
+
+    void AddShapes(ChPhysicsItem* item);
+    std::shared_ptr<MeshBVH> GetMeshBVH(std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh,
+                                        const ChVector<>& scale);
+
+    bool IntersectInstance(const Instance& inst,
+                           const ChVector<>& origin,
+                           const ChVector<>& dir,
+                           double tmin,
+                           double tmax,
+                           double& t,
+                           ChVector<>& normal) const;
+
+    ChSystem* m_system;
+    std::vector<Instance> m_instances;
+    std::vector<int> m_order;  ///< instance indices in top-level BVH order
+    std::vector<Node> m_nodes;  ///< top-level BVH
+    std::map<std::tuple<const void*, double, double, double>, std::shared_ptr<MeshBVH>>
+        m_meshes;  ///< cache of mesh BVHs, by mesh and scale
+};
+
+/// @} sensor_scene
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Persistent pool of worker threads used by the CPU ray-casting backend.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_sensor/cpu/ChCPUWorkerPool.h"
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChCPUWorkerPool::ChCPUWorkerPool(int num_threads)
+    : m_func(nullptr), m_count(0), m_next(0), m_generation(0), m_active(0), m_stop(false) {
+    if (num_threads <= 0)
+        num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+    for (int i = 1; i < num_threads; i++)
+        m_workers.push_back(std::thread(&ChCPUWorkerPool::Run, this));
+}
+
+CH_SENSOR_API ChCPUWorkerPool::~ChCPUWorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_work.notify_all();
+    for (auto& t : m_workers)
+        t.join();
+}
+
+CH_SENSOR_API void ChCPUWorkerPool::ParallelFor(unsigned int n, const std::function<void(unsigned int)>& func) {
+    if (m_workers.empty() || n <= 1) {
+        for (unsigned int i = 0; i < n; i++)
+            func(i);
+        return;
+    }
+
+    std::lock_guard<std::mutex> call_lock(m_call_mutex);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_func = &func;
+        m_count = n;
+        m_next = 0;
+        m_active = (int)m_workers.size();
+        m_generation++;
+    }
+    m_cv_work.notify_all();
+
+    Work();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv_done.wait(lock, [this]() { return m_active == 0; });
+    m_func = nullptr;
+}
+
+void ChCPUWorkerPool::Work() {
+    unsigned int i;
+    while ((i = m_next++) < m_count)
+        (*m_func)(i);
+}
+
+void ChCPUWorkerPool::Run() {
+    unsigned int generation = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_cv_work.wait(lock, [&]() { return m_stop || m_generation != generation; });
+        if (m_stop)
+            return;
+        generation = m_generation;
+
+        lock.unlock();
+        Work();
+        lock.lock();
+
+        if (--m_active == 0)
+            m_cv_done.notify_one();
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Persistent pool of worker threads used by the CPU ray-casting backend.
+//
+// =============================================================================
+
+#ifndef CHCPUWORKERPOOL_H
+#define CHCPUWORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor
+/// @{
+
+/// Pool of worker threads, created once and reused for all parallel loops.
+/// The calling thread participates in the work, so a pool with N threads spawns N-1 workers.
+class CH_SENSOR_API ChCPUWorkerPool {
+  public:
+    /// Create a pool with the given total number of threads (if <= 0, the number of hardware threads is used).
+    ChCPUWorkerPool(int num_threads = 0);
+
+    /// Stop and join all worker threads.
+    ~ChCPUWorkerPool();
+
+    /// Get the total number of threads (workers plus the calling thread).
+    int GetNumThreads() const { return (int)m_workers.size() + 1; }
+
+    /// Execute func(i) for all i in [0, n), distributing the indices over the pool. Blocks until all calls completed.
+    /// Calls from different threads are serialized.
+    void ParallelFor(unsigned int n, const std::function<void(unsigned int)>& func);
+
+  private:
+    void Run();
+    void Work();
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_call_mutex;  ///< serializes ParallelFor calls
+    std::mutex m_mutex;       ///< protects the job state below
+    std::condition_variable m_cv_work;
+    std::condition_variable m_cv_done;
+
+    const std::function<void(unsigned int)>* m_func;  ///< current job
+    unsigned int m_count;                             ///< number of indices in the current job
+    std::atomic<unsigned int> m_next;                 ///< next index to be processed
+    unsigned int m_generation;                        ///< incremented for each new job
+    int m_active;                                     ///< number of workers still running the current job
+    bool m_stop;
+};
+
+/// @} sensor
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
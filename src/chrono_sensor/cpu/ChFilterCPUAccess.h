@@ -0,0 +1,155 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Filters giving the user access to host buffers produced by the CPU
+// ray-casting backend.
+//
+// =============================================================================
+
+#ifndef CHFILTERCPUACCESS_H
+#define CHFILTERCPUACCESS_H
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stack>
+#include <type_traits>
+
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/sensors/ChSensor.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// Base class for filters that can follow ChFilterCPURender in the filter list of a sensor.
+/// These filters operate on host buffers only.
+class CH_SENSOR_API ChFilterCPUHost : public ChFilter {
+  public:
+    virtual ~ChFilterCPUHost() {}
+
+  protected:
+    ChFilterCPUHost(std::string name) : ChFilter(name) {}
+};
+
+/// Filter for accessing the host buffers produced by the CPU render backend.
+/// Same behavior as ChFilterAccess (buffers are held until past the sensor lag and then handed over to the user), but
+/// with host-to-host copies, so that no CUDA device is needed.
+template <class BufferType, class UserBufferType>
+class ChFilterCPUAccess : public ChFilterCPUHost {
+  public:
+    /// Class constructor
+    /// @param name String name of the filter. Defaults to empty.
+    ChFilterCPUAccess(std::string name = {}) : ChFilterCPUHost(name.length() > 0 ? name : "CPUCopyToFilter") {}
+
+    virtual ~ChFilterCPUAccess() {}
+
+    /// Apply function. Copies the incoming buffer into the lag buffer.
+    virtual void Apply() override {
+        std::shared_ptr<BufferType> tmp_buffer;
+        if (m_empty_lag_buffers.size() > 0) {
+            tmp_buffer = m_empty_lag_buffers.top();
+            m_empty_lag_buffers.pop();
+        } else {
+            tmp_buffer = chrono_types::make_shared<BufferType>();
+            tmp_buffer->Buffer =
+                PixelArray(new Pixel[m_bufferIn->Width * m_bufferIn->Height], std::default_delete<Pixel[]>());
+        }
+
+        tmp_buffer->Width = m_bufferIn->Width;
+        tmp_buffer->Height = m_bufferIn->Height;
+        tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
+        tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
+        std::copy(m_bufferIn->Buffer.get(), m_bufferIn->Buffer.get() + m_bufferIn->Width * m_bufferIn->Height,
+                  tmp_buffer->Buffer.get());
+
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+        m_lag_buffers.push(tmp_buffer);
+        while (m_lag_buffers.size() > m_max_lag_buffers) {
+            m_empty_lag_buffers.push(m_lag_buffers.front());
+            m_lag_buffers.pop();
+        }
+    }
+
+    /// Initializes all data needed by the filter apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut the incoming process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut) override {
+        if (!bufferInOut) {
+            InvalidFilterGraphNullBuffer(pSensor);
+        }
+        m_bufferIn = std::dynamic_pointer_cast<BufferType>(bufferInOut);
+        if (!m_bufferIn) {
+            InvalidFilterGraphBufferTypeMismatch(pSensor);
+        }
+
+        m_sensor = pSensor;
+        m_max_lag_buffers = 1 + (unsigned int)std::ceil((pSensor->GetLag() + pSensor->GetCollectionWindow()) *
+                                                        pSensor->GetUpdateRate());
+        m_user_buffer = chrono_types::make_shared<BufferType>();
+    }
+
+    /// Return the most recent buffer that is past the sensor lag. The user takes ownership of the buffer memory.
+    UserBufferType GetBuffer() {
+        std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
+
+        auto pSensor = m_sensor.lock();
+        float ch_time = (float)pSensor->GetParent()->GetSystem()->GetChTime();
+
+        while (m_lag_buffers.size() > 0 && ch_time > m_lag_buffers.front()->TimeStamp + pSensor->GetLag() - 1e-7) {
+            auto buf = m_lag_buffers.front();
+            m_lag_buffers.pop();
+
+            m_user_buffer->Buffer = std::move(buf->Buffer);
+            m_user_buffer->Width = buf->Width;
+            m_user_buffer->Height = buf->Height;
+            m_user_buffer->TimeStamp = buf->TimeStamp;
+            m_user_buffer->LaunchedCount = buf->LaunchedCount;
+        }
+
+        return m_user_buffer;
+    }
+
+  private:
+    typedef decltype(std::declval<BufferType>().Buffer) PixelArray;
+    typedef typename std::remove_extent<typename PixelArray::element_type>::type Pixel;
+
+    std::mutex m_mutexBufferAccess;          ///< mutex that is locked when the lag buffer is touched
+    UserBufferType m_user_buffer;            ///< buffer that can be returned
+    std::weak_ptr<ChSensor> m_sensor;        ///< pointer to the sensor to which this filter is attached
+    std::shared_ptr<BufferType> m_bufferIn;  ///< shared pointer to the buffer coming in
+
+    std::queue<std::shared_ptr<BufferType>> m_lag_buffers;        ///< buffers held until past their lag time
+    std::stack<std::shared_ptr<BufferType>> m_empty_lag_buffers;  ///< buffers that can be reused
+    unsigned int m_max_lag_buffers;                               ///< maximum number of buffers that could be needed
+};
+
+/// Access to lidar depth+intensity data produced by the CPU backend
+using ChFilterDICPUAccess = ChFilterCPUAccess<SensorHostDIBuffer, UserDIBufferPtr>;
+/// Access to segmentation camera data produced by the CPU backend
+using ChFilterSemanticCPUAccess = ChFilterCPUAccess<SensorHostSemanticBuffer, UserSemanticBufferPtr>;
+/// Access to depth camera data produced by the CPU backend
+using ChFilterDepthCPUAccess = ChFilterCPUAccess<SensorHostDepthBuffer, UserDepthBufferPtr>;
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,265 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Filter that generates lidar and segmentation camera data by ray casting on
+// the CPU. Ray generation follows the OptiX ray generation programs.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "chrono_sensor/cpu/ChFilterCPURender.h"
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/sensors/ChSegmentationCamera.h"
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChFilterCPURender::ChFilterCPURender(std::shared_ptr<ChCPURayScene> scene,
+                                                   std::shared_ptr<ChCPUWorkerPool> pool)
+    : m_scene(scene), m_pool(pool), m_time_stamp(0), ChFilter("CPURenderer") {}
+
+CH_SENSOR_API ChFilterCPURender::~ChFilterCPURender() {}
+
+CH_SENSOR_API void ChFilterCPURender::Apply() {
+    auto pSensor = m_sensor.lock();
+
+    ChFrame<> frame = pSensor->GetParent()->GetVisualModelFrame() * pSensor->GetOffsetPose();
+    if (m_buffer_di)
+        RenderLidar(frame);
+    else if (m_buffer_semantic)
+        RenderSegmentation(frame);
+    else
+        RenderDepth(frame);
+
+    m_bufferOut->LaunchedCount = pSensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = m_time_stamp;
+}
+
+// Allocate a host array of n elements
+template <typename T>
+static std::shared_ptr<T[]> HostArray(unsigned int n) {
+    return std::shared_ptr<T[]>(new T[n], std::default_delete<T[]>());
+}
+
+CH_SENSOR_API void ChFilterCPURender::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                 std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (bufferInOut) {
+        throw std::runtime_error("The CPU render filter must be the first filter in the list");
+    }
+    auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(pSensor);
+    if (!pOptixSensor) {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+    m_sensor = pOptixSensor;
+
+    unsigned int num_pixels = pOptixSensor->GetWidth() * pOptixSensor->GetHeight();
+
+    if (auto segmenter = std::dynamic_pointer_cast<ChSegmentationCamera>(pSensor)) {
+        if (segmenter->GetLensModelType() == CameraLensModelType::RADIAL) {
+            std::cerr << "WARNING: radial lens model not supported by the CPU renderer. Using pinhole model.\n";
+        }
+        m_buffer_semantic = chrono_types::make_shared<SensorHostSemanticBuffer>();
+        m_buffer_semantic->Buffer = HostArray<PixelSemantic>(num_pixels);
+        m_bufferOut = m_buffer_semantic;
+    } else if (auto depth_camera = std::dynamic_pointer_cast<ChDepthCamera>(pSensor)) {
+        if (depth_camera->GetLensModelType() == CameraLensModelType::RADIAL) {
+            std::cerr << "WARNING: radial lens model not supported by the CPU renderer. Using pinhole model.\n";
+        }
+        m_buffer_depth = chrono_types::make_shared<SensorHostDepthBuffer>();
+        m_buffer_depth->Buffer = HostArray<PixelDepth>(num_pixels);
+        m_bufferOut = m_buffer_depth;
+    } else if (auto lidar = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
+        m_buffer_di = chrono_types::make_shared<SensorHostDIBuffer>();
+        m_buffer_di->Buffer = HostArray<PixelDI>(num_pixels);
+        m_bufferOut = m_buffer_di;
+    } else {
+        throw std::runtime_error("This type of sensor not supported yet by CPU render filter");
+    }
+    m_bufferOut->Width = pOptixSensor->GetWidth();
+    m_bufferOut->Height = pOptixSensor->GetHeight();
+    m_bufferOut->LaunchedCount = pOptixSensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = m_time_stamp;
+
+    // gives our output buffer to the next filter in the graph
+    bufferInOut = m_bufferOut;
+}
+
+// Direction of the ray through pixel (x,y) of a camera, following the OptiX camera ray generation programs.
+static ChVector<> CameraRayDirection(int x,
+                                     int y,
+                                     int width,
+                                     int height,
+                                     float hFOV,
+                                     bool fov_lens,
+                                     const ChVector<>& forward,
+                                     const ChVector<>& left,
+                                     const ChVector<>& up) {
+    const float h_factor = hFOV / (float)CH_C_PI * 2;
+    float dx = (x + 0.5f) / width * 2 - 1;
+    float dy = ((y + 0.5f) / height * 2 - 1) * height / (float)width;
+
+    if (fov_lens && (std::abs(dx) > 1e-5 || std::abs(dy) > 1e-5)) {
+        float focal = 1 / std::tan(hFOV / 2);
+        float nx = dx / focal;
+        float ny = dy / focal;
+        float rd = std::sqrt(nx * nx + ny * ny);
+        float ru = std::tan(rd * hFOV) / (2 * std::tan(hFOV / 2));
+        dx = nx * (ru / rd) * focal;
+        dy = ny * (ru / rd) * focal;
+    }
+
+    ChVector<> dir = forward - left * (dx * h_factor) + up * (dy * h_factor);
+    return dir.GetNormalized();
+}
+
+void ChFilterCPURender::RenderLidar(const ChFrame<>& frame) {
+    auto lidar = std::static_pointer_cast<ChLidarSensor>(m_sensor.lock());
+    const int width = (int)lidar->GetWidth();
+    const int height = (int)lidar->GetHeight();
+    const float hFOV = lidar->GetHFOV();
+    const float max_vert_angle = lidar->GetMaxVertAngle();
+    const float min_vert_angle = lidar->GetMinVertAngle();
+    const double clip_near = lidar->GetClipNear();
+    const double max_distance = 1.5 * lidar->GetMaxDistance();
+    const int sample_radius = (int)lidar->GetSampleRadius();
+    const float horiz_div_angle = lidar->GetHorizDivAngle();
+    const float vert_div_angle = lidar->GetVertDivAngle();
+    const bool elliptical = lidar->GetBeamShape() == LidarBeamShape::ELLIPTICAL;
+
+    const ChVector<> origin = frame.GetPos();
+    const ChVector<> forward = frame.GetA().Get_A_Xaxis();
+    const ChVector<> left = frame.GetA().Get_A_Yaxis();
+    const ChVector<> up = frame.GetA().Get_A_Zaxis();
+
+    // number of rays per beam in each direction and number of beams
+    const int local_dim = sample_radius > 1 ? 2 * sample_radius - 1 : 1;
+    const int beams_x = width / local_dim;
+    const int beams_y = height / local_dim;
+
+    PixelDI* buffer = m_buffer_di->Buffer.get();
+
+    m_pool->ParallelFor(height, [&](unsigned int y) {
+        for (int x = 0; x < width; x++) {
+            int beam_x = x / local_dim;
+            int beam_y = (int)y / local_dim;
+            float phi = (beam_y / (float)std::max(1, beams_y - 1)) * (max_vert_angle - min_vert_angle) + min_vert_angle;
+            float theta = (beam_x / (float)std::max(1, beams_x - 1)) * hFOV - hFOV / 2;
+
+            if (local_dim > 1) {
+                // offset of the ray within the beam, in [-1,1]
+                float fx = ((x % local_dim) + 0.5f) / local_dim * 2 - 1;
+                float fy = ((y % local_dim) + 0.5f) / local_dim * 2 - 1;
+                if (elliptical) {
+                    theta += fx * horiz_div_angle / 2;
+                    phi += fy * vert_div_angle / 2;
+                } else {
+                    float angle = std::atan2(fy, fx);
+                    float ring = std::max(std::abs(fx), std::abs(fy));
+                    float ax = vert_div_angle / 2 * ring;
+                    float ay = horiz_div_angle / 2 * ring;
+                    float radius = 0;
+                    if (ax != 0 || ay != 0) {
+                        radius = (ax * ay) / std::sqrt(ax * ax * std::sin(angle) * std::sin(angle) +
+                                                       ay * ay * std::cos(angle) * std::cos(angle));
+                    }
+                    theta += radius * std::sin(angle);
+                    phi += radius * std::cos(angle);
+                }
+            }
+
+            double xy_proj = std::cos(phi);
+            ChVector<> dir = forward * (xy_proj * std::cos(theta)) + left * (xy_proj * std::sin(theta)) +
+                             up * std::sin(phi);
+            dir.Normalize();
+
+            ChCPURayScene::Hit hit;
+            PixelDI& pixel = buffer[y * width + x];
+            if (m_scene->Intersect(origin, dir, clip_near, max_distance, hit)) {
+                pixel.range = (float)hit.distance;
+                pixel.intensity = (float)std::abs(Vdot(hit.normal, dir));
+            } else {
+                pixel.range = 0;
+                pixel.intensity = 0;
+            }
+        }
+    });
+}
+
+void ChFilterCPURender::RenderSegmentation(const ChFrame<>& frame) {
+    auto camera = std::static_pointer_cast<ChSegmentationCamera>(m_sensor.lock());
+    const int width = (int)camera->GetWidth();
+    const int height = (int)camera->GetHeight();
+    const float hFOV = camera->GetHFOV();
+    const bool fov_lens = camera->GetLensModelType() == CameraLensModelType::FOV_LENS;
+
+    const ChVector<> origin = frame.GetPos();
+    const ChVector<> forward = frame.GetA().Get_A_Xaxis();
+    const ChVector<> left = frame.GetA().Get_A_Yaxis();
+    const ChVector<> up = frame.GetA().Get_A_Zaxis();
+
+    PixelSemantic* buffer = m_buffer_semantic->Buffer.get();
+
+    m_pool->ParallelFor(height, [&](unsigned int y) {
+        for (int x = 0; x < width; x++) {
+            ChVector<> dir = CameraRayDirection(x, (int)y, width, height, hFOV, fov_lens, forward, left, up);
+
+            ChCPURayScene::Hit hit;
+            PixelSemantic& pixel = buffer[y * width + x];
+            if (m_scene->Intersect(origin, dir, 0, 1e16, hit)) {
+                pixel.class_id = hit.class_id;
+                pixel.instance_id = hit.instance_id;
+            } else {
+                pixel.class_id = 0;
+                pixel.instance_id = 0;
+            }
+        }
+    });
+}
+
+void ChFilterCPURender::RenderDepth(const ChFrame<>& frame) {
+    auto camera = std::static_pointer_cast<ChDepthCamera>(m_sensor.lock());
+    const int width = (int)camera->GetWidth();
+    const int height = (int)camera->GetHeight();
+    const float hFOV = camera->GetHFOV();
+    const bool fov_lens = camera->GetLensModelType() == CameraLensModelType::FOV_LENS;
+    const double max_depth = camera->GetMaxDepth();
+
+    const ChVector<> origin = frame.GetPos();
+    const ChVector<> forward = frame.GetA().Get_A_Xaxis();
+    const ChVector<> left = frame.GetA().Get_A_Yaxis();
+    const ChVector<> up = frame.GetA().Get_A_Zaxis();
+
+    PixelDepth* buffer = m_buffer_depth->Buffer.get();
+
+    m_pool->ParallelFor(height, [&](unsigned int y) {
+        for (int x = 0; x < width; x++) {
+            ChVector<> dir = CameraRayDirection(x, (int)y, width, height, hFOV, fov_lens, forward, left, up);
+
+            // the ray reaches depth d along the optical axis at distance d / cos(angle to the axis)
+            double cos_axis = Vdot(dir, forward);
+            ChCPURayScene::Hit hit;
+            float depth = 0;
+            if (m_scene->Intersect(origin, dir, 0, max_depth / cos_axis, hit))
+                depth = (float)(hit.distance * cos_axis);
+            buffer[y * width + x].depth = depth;
+        }
+    });
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,84 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Filter that generates lidar, segmentation camera, and depth camera data by
+// ray casting on the CPU.
+//
+// =============================================================================
+
+#ifndef CHFILTERCPURENDER_H
+#define CHFILTERCPURENDER_H
+
+#include <memory>
+
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/cpu/ChCPURayScene.h"
+#include "chrono_sensor/cpu/ChCPUWorkerPool.h"
+
+namespace chrono {
+namespace sensor {
+
+// forward declaration
+class ChSensor;
+
+/// @addtogroup sensor_filters
+/// @{
+
+/// A filter that generates data for a ChOptixSensor by casting rays against a ChCPURayScene on multiple CPU threads.
+/// Supports lidar sensors (single and multi-sample beams), segmentation cameras, and depth cameras. The rendered data is
+/// written into a host buffer (SensorHostDIBuffer, SensorHostSemanticBuffer, or SensorHostDepthBuffer); it can only be
+/// consumed by host filters (see ChFilterCPUAccess).
+class CH_SENSOR_API ChFilterCPURender : public ChFilter {
+  public:
+    /// Class constructor
+    /// @param scene The scene against which rays are cast.
+    /// @param pool The pool of threads used for casting rays.
+    ChFilterCPURender(std::shared_ptr<ChCPURayScene> scene, std::shared_ptr<ChCPUWorkerPool> pool);
+
+    virtual ~ChFilterCPURender();
+
+    /// Apply function. Generates data for the sensor.
+    virtual void Apply();
+
+    /// Initializes all data needed by the filter apply function.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut A pointer to the process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+  private:
+    void RenderLidar(const ChFrame<>& frame);
+    void RenderSegmentation(const ChFrame<>& frame);
+    void RenderDepth(const ChFrame<>& frame);
+
+    std::weak_ptr<ChOptixSensor> m_sensor;     ///< for holding a weak reference to parent sensor
+    std::shared_ptr<ChCPURayScene> m_scene;    ///< scene against which rays are cast
+    std::shared_ptr<ChCPUWorkerPool> m_pool;   ///< ray casting threads (owned by the engine)
+    std::shared_ptr<SensorBuffer> m_bufferOut;
+
+    std::shared_ptr<SensorHostDIBuffer> m_buffer_di;              ///< output buffer for lidar sensors
+    std::shared_ptr<SensorHostSemanticBuffer> m_buffer_semantic;  ///< output buffer for segmentation cameras
+    std::shared_ptr<SensorHostDepthBuffer> m_buffer_depth;        ///< output buffer for depth cameras
+
+    float m_time_stamp;  ///< time stamp for when the data (render) was launched
+
+    friend class ChCPURayEngine;  ///< ChCPURayEngine is allowed to set the time stamp
+};
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -53,7 +53,8 @@ enum class PipelineType {
     // SEGMENTATION_FOV_LENS,  ///< FOV lens segmentation camera
     LIDAR_SINGLE,  ///< single sample lidar
     LIDAR_MULTI,   ///< multi sample lidar
-    RADAR          ///< radar model
+    RADAR,         ///< radar model
+    DEPTH_CAMERA   ///< depth camera (CPU render backend only)
 };
 // TODO: how do we allow custom ray gen programs? (Is that ever going to be a thing?)
 
@@ -0,0 +1,45 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Depth camera, rendered by the CPU ray-casting backend.
+//
+// =============================================================================
+
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+
+namespace chrono {
+namespace sensor {
+
+CH_SENSOR_API ChDepthCamera::ChDepthCamera(std::shared_ptr<chrono::ChBody> parent,
+                                           float updateRate,
+                                           chrono::ChFrame<double> offsetPose,
+                                           unsigned int w,
+                                           unsigned int h,
+                                           float hFOV,
+                                           float max_depth,
+                                           CameraLensModelType lens_model)
+    : m_hFOV(hFOV),
+      m_max_depth(max_depth),
+      m_lens_model_type(lens_model),
+      ChOptixSensor(parent, updateRate, offsetPose, w, h) {
+    m_pipeline_type = PipelineType::DEPTH_CAMERA;
+
+    SetCollectionWindow(0.f);
+    SetLag(1.f / updateRate);
+}
+
+CH_SENSOR_API ChDepthCamera::~ChDepthCamera() {}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Depth camera, rendered by the CPU ray-casting backend.
+//
+// =============================================================================
+
+#ifndef CHDEPTHCAMERA_H
+#define CHDEPTHCAMERA_H
+
+// will use same parameters as camera
+#include "chrono_sensor/sensors/ChCameraSensor.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_sensors
+/// @{
+
+/// Depth camera class.
+/// Each pixel holds the distance from the camera to the closest surface, measured along the camera optical axis (the
+/// x axis of the sensor frame), or 0 if the ray does not hit anything within the maximum depth.
+/// Depth cameras are rendered by the CPU backend only (see ChSensorManager::SetRenderBackend).
+class CH_SENSOR_API ChDepthCamera : public ChOptixSensor {
+  public:
+    /// @brief Constructor for a depth camera
+    /// @param parent A shared pointer to a body on which the sensor should be attached.
+    /// @param updateRate The desired update rate of the sensor in Hz.
+    /// @param offsetPose The desired relative position and orientation of the sensor on the body.
+    /// @param w The width of the image the camera should generate.
+    /// @param h The height of the image the camera should generate.
+    /// @param hFOV The horizontal field of view of the camera lens.
+    /// @param max_depth Maximum depth reported by the camera.
+    /// @param lens_model A enum specifying the desired lens model (PINHOLE or FOV_LENS).
+    ChDepthCamera(std::shared_ptr<chrono::ChBody> parent,
+                  float updateRate,
+                  chrono::ChFrame<double> offsetPose,
+                  unsigned int w,
+                  unsigned int h,
+                  float hFOV,
+                  float max_depth = 1000.f,
+                  CameraLensModelType lens_model = CameraLensModelType::PINHOLE);
+
+    ~ChDepthCamera();
+
+    /// Get the horizontal field of view of the camera lens.
+    float GetHFOV() const { return m_hFOV; }
+
+    /// Get the maximum depth reported by the camera.
+    float GetMaxDepth() const { return m_max_depth; }
+
+    /// Get the lens model type used for rendering.
+    CameraLensModelType GetLensModelType() const { return m_lens_model_type; }
+
+  private:
+    float m_hFOV;                           ///< the horizontal field of view of the sensor
+    float m_max_depth;                      ///< maximum depth
+    CameraLensModelType m_lens_model_type;  ///< lens model used by the camera
+};
+
+/// @} sensor_sensors
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -29,10 +29,8 @@ CH_SENSOR_API ChOptixSensor::ChOptixSensor(std::shared_ptr<chrono::ChBody> paren
                                            chrono::ChFrame<double> offsetPose,
                                            unsigned int w,
                                            unsigned int h)
-    : m_width(w), m_height(h), ChSensor(parent, updateRate, offsetPose) {
+    : m_width(w), m_height(h), m_cuda_stream(nullptr), ChSensor(parent, updateRate, offsetPose) {
     // Camera sensor get rendered by Optix, so they must has as their first filter an optix renderer.
-    cudaStreamCreate(&m_cuda_stream);  // all gpu operations will happen on this stream
-
     // delayed creation of the optix render filter -> ChOptixEngine must do this to properly initialize the optix
     // parameters
 }
@@ -41,7 +39,14 @@ CH_SENSOR_API ChOptixSensor::ChOptixSensor(std::shared_ptr<chrono::ChBody> paren
 // Destructor
 // -----------------------------------------------------------------------------
 CH_SENSOR_API ChOptixSensor::~ChOptixSensor() {
-    cudaStreamDestroy(m_cuda_stream);
+    if (m_cuda_stream)
+        cudaStreamDestroy(m_cuda_stream);
+}
+
+CH_SENSOR_API CUstream ChOptixSensor::GetCudaStream() {
+    if (!m_cuda_stream)
+        cudaStreamCreate(&m_cuda_stream);  // all gpu operations will happen on this stream
+    return m_cuda_stream;
 }
 
 }  // namespace sensor
@@ -54,7 +54,10 @@ class CH_SENSOR_API ChOptixSensor : public ChSensor {
 
     unsigned int GetWidth() { return m_width; }
     unsigned int GetHeight() { return m_height; }
-    CUstream GetCudaStream() { return m_cuda_stream; }
+
+    /// Get the CUDA stream on which all GPU operations of this sensor happen.
+    /// The stream is created on first use, so that sensors rendered by the CPU backend never touch a CUDA device.
+    CUstream GetCudaStream();
 
   protected:
     PipelineType m_pipeline_type;  ///< the type of pipeline for rendering
@@ -23,11 +23,16 @@
     #endif
 #endif
 
-#include <cuda_fp16.h>
 #include <functional>
 #include <memory>
 #include <vector>
 
+#include "chrono/ChConfig.h"
+
+#ifdef CHRONO_HAS_CUDA
+    #include <cuda_fp16.h>
+#endif
+
 namespace chrono {
 namespace sensor {
 
@@ -97,6 +102,7 @@ using SensorDeviceFloat4Buffer = SensorBufferT<DeviceFloat4BufferPtr>;
 /// pointer to an RGBA image on the host that has been moved for safety and can be given to the user
 using UserFloat4BufferPtr = std::shared_ptr<SensorHostFloat4Buffer>;
 
+#ifdef CHRONO_HAS_CUDA
 /// A pixel as defined by RGBA float4 format
 struct PixelHalf4 {
     __half R;  ///< Red value
@@ -112,6 +118,7 @@ using DeviceHalf4BufferPtr = std::shared_ptr<PixelHalf4[]>;
 using SensorDeviceHalf4Buffer = SensorBufferT<DeviceHalf4BufferPtr>;
 /// pointer to an RGBA image on the host that has been moved for safety and can be given to the user
 using UserHalf4BufferPtr = std::shared_ptr<SensorHostHalf4Buffer>;
+#endif
 
 //================================
 // RGBA8 Camera Format and Buffers
@@ -160,6 +167,15 @@ using SensorDeviceSemanticBuffer = SensorBufferT<DeviceSemanticBufferPtr>;
 /// pointer to an semantic image on the host that has been moved for safety and can be given to the user
 using UserSemanticBufferPtr = std::shared_ptr<SensorHostSemanticBuffer>;
 
+/// A pixel of a depth image
+struct PixelDepth {
+    float depth;  ///< distance along the camera optical axis (0 if no hit)
+};
+/// Depth host buffer to be used by depth cameras
+using SensorHostDepthBuffer = SensorBufferT<std::shared_ptr<PixelDepth[]>>;
+/// pointer to a depth image on the host that has been moved for safety and can be given to the user
+using UserDepthBufferPtr = std::shared_ptr<SensorHostDepthBuffer>;
+
 //=====================================
 // Range Radar Data Formats and Buffers
 //=====================================
@@ -27,7 +27,8 @@ namespace vehicle {
 
 ChassisConnectorArticulated::ChassisConnectorArticulated(const std::string& filename)
     : ChChassisConnectorArticulated("") {
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
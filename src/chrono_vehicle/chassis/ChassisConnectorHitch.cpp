@@ -26,7 +26,8 @@ namespace chrono {
 namespace vehicle {
 
 ChassisConnectorHitch::ChassisConnectorHitch(const std::string& filename) : ChChassisConnectorHitch("") {
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
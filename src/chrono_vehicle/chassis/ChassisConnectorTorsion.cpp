@@ -26,7 +26,8 @@ namespace chrono {
 namespace vehicle {
 
 ChassisConnectorTorsion::ChassisConnectorTorsion(const std::string& filename) : ChChassisConnectorTorsion("") {
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -26,8 +26,8 @@ namespace vehicle {
 
 // Construct using data from the specified JSON file.
 AIDriver::AIDriver(ChVehicle& vehicle, const std::string& filename) : ChAIDriver(vehicle) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -117,8 +117,8 @@ ChHumanDriver::ChHumanDriver(const std::string& filename,
       m_speed_min(1.0e99),
       m_left_acc(0),
       m_right_acc(0) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
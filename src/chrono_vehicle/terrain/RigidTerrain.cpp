@@ -62,8 +62,8 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
       m_contact_callback(nullptr),
       m_collision_family(14) {
     // Open and parse the input file
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
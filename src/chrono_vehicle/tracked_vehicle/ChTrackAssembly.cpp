@@ -35,7 +35,16 @@ ChTrackAssembly::ChTrackAssembly(const std::string& name, VehicleSide side)
       m_side(side),
       m_idler_as_cylinder(true),
       m_roller_as_cylinder(true),
-      m_roadwheel_as_cylinder(true) {}
+      m_roadwheel_as_cylinder(true),
+      m_analytic_wheel_contact(false) {}
+
+ChTrackAssembly::~ChTrackAssembly() {
+    if (!m_wheel_contact_callback)
+        return;
+    auto sys = m_idler->GetIdlerWheel()->GetBody()->GetSystem();
+    if (sys)
+        sys->UnregisterCustomCollisionCallback(m_wheel_contact_callback);
+}
 
 // -----------------------------------------------------------------------------
 // Get the complete state for the specified track shoe.
@@ -102,6 +111,24 @@ void ChTrackAssembly::Initialize(std::shared_ptr<ChChassis> chassis, const ChVec
         next = (i == num_shoes - 1) ? GetTrackShoe(0) : GetTrackShoe(i + 1);
         GetTrackShoe(i)->Connect(next, this, chassis.get(), ccw);
     }
+
+    // If requested and supported, generate track shoe - track wheel contacts analytically
+    // and disable generic collision detection between track wheels and track shoes.
+    if (m_analytic_wheel_contact) {
+        m_wheel_contact_callback = CreateWheelContactCallback();
+        if (!m_wheel_contact_callback) {
+            GetLog() << "WARNING: analytic wheel contact not supported by track assembly " << GetName() << "\n";
+            return;
+        }
+        chassis->GetSystem()->RegisterCustomCollisionCallback(m_wheel_contact_callback);
+
+        std::vector<std::shared_ptr<ChTrackWheel>> wheels = m_rollers;
+        wheels.push_back(GetIdlerWheel());
+        for (auto& suspension : m_suspensions)
+            wheels.push_back(suspension->GetRoadWheel());
+        for (auto& wheel : wheels)
+            wheel->GetBody()->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(TrackedCollisionFamily::SHOES);
+    }
 }
 
 // -----------------------------------------------------------------------------
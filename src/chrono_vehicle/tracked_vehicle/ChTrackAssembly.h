@@ -44,7 +44,7 @@ namespace vehicle {
 /// rollers, a set of suspensions (road-wheel assemblies), and a collection of track shoes.
 class CH_VEHICLE_API ChTrackAssembly : public ChPart {
   public:
-    virtual ~ChTrackAssembly() {}
+    virtual ~ChTrackAssembly();
 
     /// Return the vehicle side for this track assembly.
     VehicleSide GetVehicleSide() const { return m_side; }
@@ -177,6 +177,18 @@ class CH_VEHICLE_API ChTrackAssembly : public ChPart {
     /// Set collision shape type for wheels.
     void SetWheelCollisionType(bool roadwheel_as_cylinder, bool idler_as_cylinder, bool roller_as_cylinder);
 
+    /// Enable/disable analytic contact between track shoes and track wheels (default: false).
+    /// If enabled, contacts between the track shoes and the road wheels, idler wheel, and rollers are generated by a
+    /// specialized collision callback which only tests the shoes in the neighborhood of each wheel, using closed-form
+    /// cylinder-box tests. Generic collision detection is then disabled for these pairs. This option is supported only
+    /// by segmented track assemblies with shoe collision geometry consisting of axis-aligned boxes and is otherwise
+    /// ignored. Must be called before Initialize. Since no generic collisions between shoes and wheels are reported,
+    /// this option is incompatible with custom idler and wheel contact (see ChTrackedVehicle::EnableCustomContact).
+    void EnableAnalyticWheelContact(bool val) { m_analytic_wheel_contact = val; }
+
+    /// Return true if track shoe - track wheel contacts are generated analytically.
+    bool IsAnalyticWheelContact() const { return m_wheel_contact_callback != nullptr; }
+
     /// Update the state of this track assembly at the current time.
     void Synchronize(double time,                      ///< [in] current time
                      double braking,                   ///< [in] braking driver input
@@ -210,6 +222,10 @@ class CH_VEHICLE_API ChTrackAssembly : public ChPart {
     /// Remove all track shoes from assembly.
     virtual void RemoveTrackShoes() = 0;
 
+    /// Create the callback for analytic contact between track shoes and track wheels.
+    /// The default implementation returns an empty pointer (analytic contact not supported).
+    virtual std::shared_ptr<ChSystem::CustomCollisionCallback> CreateWheelContactCallback() { return nullptr; }
+
     virtual void ExportComponentList(rapidjson::Document& jsonDocument) const override;
 
     virtual void Output(ChVehicleOutput& database) const override;
@@ -225,6 +241,9 @@ class CH_VEHICLE_API ChTrackAssembly : public ChPart {
     bool m_idler_as_cylinder;
     bool m_roller_as_cylinder;
 
+    bool m_analytic_wheel_contact;                                                ///< analytic shoe-wheel contact?
+    std::shared_ptr<ChSystem::CustomCollisionCallback> m_wheel_contact_callback;  ///< shoe-wheel contact callback
+
     friend class ChTrackedVehicle;
     friend class ChTrackTestRig;
 };
@@ -64,6 +64,9 @@ class CH_VEHICLE_API ChTrackWheel : public ChPart {
     /// Return the total width of the track wheel.
     virtual double GetWidth() const = 0;
 
+    /// Get the contact material for the track wheel.
+    std::shared_ptr<ChMaterialSurface> GetContactMaterial() const { return m_material; }
+
     /// Turn on/off collision flag for the track wheel (default: true).
     void SetCollide(bool val) { m_wheel->SetCollide(val); }
 
@@ -27,8 +27,8 @@ namespace chrono {
 namespace vehicle {
 
 DistanceIdler::DistanceIdler(const std::string& filename) : ChDistanceIdler("") {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -27,7 +27,8 @@ namespace chrono {
 namespace vehicle {
 
 TranslationalIdler::TranslationalIdler(const std::string& filename) : ChTranslationalIdler("") {
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
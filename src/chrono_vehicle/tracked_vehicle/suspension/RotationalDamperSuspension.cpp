@@ -29,8 +29,8 @@ namespace vehicle {
 
 RotationalDamperSuspension::RotationalDamperSuspension(const std::string& filename, bool has_shock, bool lock_arm)
     : ChRotationalDamperSuspension("", has_shock, lock_arm), m_spring_torqueCB(nullptr), m_shock_torqueCB(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
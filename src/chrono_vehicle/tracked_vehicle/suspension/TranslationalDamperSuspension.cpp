@@ -29,8 +29,8 @@ namespace vehicle {
 
 TranslationalDamperSuspension::TranslationalDamperSuspension(const std::string& filename, bool has_shock, bool lock_arm)
     : ChTranslationalDamperSuspension("", has_shock, lock_arm), m_spring_torqueCB(nullptr), m_shock_forceCB(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -19,12 +19,329 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "chrono_vehicle/tracked_vehicle/track_assembly/ChTrackAssemblySegmented.h"
 #include "chrono_vehicle/tracked_vehicle/track_shoe/ChTrackShoeSegmented.h"
+#include "chrono_vehicle/tracked_vehicle/track_wheel/ChDoubleTrackWheel.h"
 
 namespace chrono {
 namespace vehicle {
 
+// -----------------------------------------------------------------------------
+// Custom collision callback for analytic contact between track shoes and track wheels.
+// Each track wheel is represented by one or two coaxial cylinders and each track shoe by a set of boxes aligned with
+// the shoe reference frame. A cylinder-box test is split in a radial test and a lateral test:
+// - radial: the box is cut with planes perpendicular to the wheel axis (through the cylinder center and its two end
+//   faces) and each resulting convex polygon is tested against the cylinder circle in that plane;
+// - lateral: the cylinder extent along the shoe Y axis is tested against the box extent along that axis.
+// The contact normal is the one corresponding to the smallest penetration (radial or lateral). If the wheel axis is
+// aligned with the shoe Y axis, the radial test reduces to a circle-rectangle test in the (x-z) plane of the shoe.
+// -----------------------------------------------------------------------------
+class SegmentedTrackWheelContactCB : public ChSystem::CustomCollisionCallback {
+  public:
+    // Contact box on a track shoe (in the shoe reference frame).
+    struct Pad {
+        ChVector<> center;  // box center
+        ChVector<> hdims;   // box half-dimensions
+        int shape;          // index of the box in the shoe collision model (for the contact material)
+    };
+
+    // Contact cylinders of a track wheel.
+    struct Wheel {
+        std::shared_ptr<ChBody> body;                 // wheel body
+        std::shared_ptr<ChMaterialSurface> material;  // wheel contact material
+        double radius;                                // cylinder radius
+        double hwidth;                                // cylinder half-width
+        std::vector<double> offsets;                  // cylinder center offsets along the wheel axis
+        double bound;                                 // radius of wheel bounding sphere
+        double envelope;                              // collision envelope of the wheel collision model
+    };
+
+    SegmentedTrackWheelContactCB(ChTrackAssembly* track,           ///< containing track assembly
+                                 double envelope,                  ///< collision envelope of the shoe models
+                                 const std::vector<Pad>& pads,     ///< track shoe contact boxes
+                                 const std::vector<Wheel>& wheels  ///< track wheels
+                                 )
+        : m_track(track), m_envelope(envelope), m_pads(pads), m_wheels(wheels) {
+        m_shoe_bound = 0;
+        for (const auto& pad : m_pads)
+            m_shoe_bound = std::max(m_shoe_bound, pad.center.Length() + pad.hdims.Length());
+    }
+
+    virtual void OnCustomCollision(ChSystem* system) override;
+
+  private:
+    // Test collision of a wheel contact cylinder with a shoe contact box.
+    // This may introduce one contact.
+    void CheckCylinderPad(const Wheel& wheel,     // track wheel
+                          ChBody* shoe,           // track shoe body
+                          const ChVector<>& loc,  // center of wheel contact cylinder (shoe frame)
+                          const ChVector<>& dir,  // wheel axis (shoe frame)
+                          const Pad& pad          // shoe contact box
+    );
+
+    // Radial test of a cylinder cross-section (circle of given center and radius, in the plane normal to 'dir')
+    // against the polygon obtained by cutting the box with that plane. Returns false if the plane misses the box.
+    // Otherwise, return the signed distance, the contact normal (from wheel to shoe), and the point on the box
+    // (all relative to the box center).
+    static bool CheckCirclePad(const ChVector<>& center,
+                               const ChVector<>& dir,
+                               double radius,
+                               const ChVector<>& hdims,
+                               double& distance,
+                               ChVector<>& normal,
+                               ChVector<>& pt_pad);
+
+    ChTrackAssembly* m_track;     // pointer to containing track assembly
+    double m_envelope;            // collision envelope of the track shoe models
+    std::vector<Pad> m_pads;      // track shoe contact boxes
+    std::vector<Wheel> m_wheels;  // track wheels
+    double m_shoe_bound;          // radius of track shoe bounding sphere
+
+    std::vector<ChBody*> m_shoes;  // track shoe bodies
+    std::vector<double> m_x;       // track shoe locations (x coordinates)
+    std::vector<double> m_y;       // track shoe locations (y coordinates)
+    std::vector<double> m_z;       // track shoe locations (z coordinates)
+    std::vector<double> m_dist2;   // squared distances between current wheel and track shoes
+};
+
+void SegmentedTrackWheelContactCB::OnCustomCollision(ChSystem* system) {
+    // Return now if collision disabled on track shoes.
+    size_t num_shoes = m_track->GetNumTrackShoes();
+    if (num_shoes == 0)
+        return;
+    if (!m_track->GetTrackShoe(0)->GetShoeBody()->GetCollide())
+        return;
+
+    // Gather track shoe locations (in separate arrays, for vectorizable distance calculations)
+    m_shoes.resize(num_shoes);
+    m_x.resize(num_shoes);
+    m_y.resize(num_shoes);
+    m_z.resize(num_shoes);
+    m_dist2.resize(num_shoes);
+    for (size_t is = 0; is < num_shoes; ++is) {
+        m_shoes[is] = m_track->GetTrackShoe(is)->GetShoeBody().get();
+        const auto& pos = m_shoes[is]->GetPos();
+        m_x[is] = pos.x();
+        m_y[is] = pos.y();
+        m_z[is] = pos.z();
+    }
+
+    for (const auto& wheel : m_wheels) {
+        if (!wheel.body->GetCollide())
+            continue;
+
+        // Broadphase: distances between the wheel center and all track shoe centers
+        const ChVector<>& locW_abs = wheel.body->GetPos();
+        const double xw = locW_abs.x();
+        const double yw = locW_abs.y();
+        const double zw = locW_abs.z();
+        const double* x = m_x.data();
+        const double* y = m_y.data();
+        const double* z = m_z.data();
+        double* dist2 = m_dist2.data();
+        for (size_t is = 0; is < num_shoes; ++is) {
+            double dx = x[is] - xw;
+            double dy = y[is] - yw;
+            double dz = z[is] - zw;
+            dist2[is] = dx * dx + dy * dy + dz * dz;
+        }
+
+        double R_sum = wheel.bound + m_shoe_bound + wheel.envelope + m_envelope;
+
+        // Wheel axis (Y axis), expressed in global frame
+        ChVector<> dirW_abs = wheel.body->GetA().Get_A_Yaxis();
+
+        // Narrowphase: test the wheel cylinders against the contact boxes of all candidate shoes
+        for (size_t is = 0; is < num_shoes; ++is) {
+            if (dist2[is] > R_sum * R_sum)
+                continue;
+
+            // Express the wheel center and axis in the shoe frame.
+            ChVector<> locW = m_shoes[is]->TransformPointParentToLocal(locW_abs);
+            ChVector<> dirW = m_shoes[is]->TransformDirectionParentToLocal(dirW_abs);
+
+            for (auto offset : wheel.offsets) {
+                ChVector<> locC = locW + offset * dirW;
+                for (const auto& pad : m_pads)
+                    CheckCylinderPad(wheel, m_shoes[is], locC, dirW, pad);
+            }
+        }
+    }
+}
+
+bool SegmentedTrackWheelContactCB::CheckCirclePad(const ChVector<>& center,
+                                                  const ChVector<>& dir,
+                                                  double radius,
+                                                  const ChVector<>& hdims,
+                                                  double& distance,
+                                                  ChVector<>& normal,
+                                                  ChVector<>& pt_pad) {
+    // Box vertices relative to the circle center and their signed distances to the circle plane
+    ChVector<> v[8];
+    double s[8];
+    for (int k = 0; k < 8; k++) {
+        v[k] = ChVector<>((k & 1) ? hdims.x() : -hdims.x(), (k & 2) ? hdims.y() : -hdims.y(),
+                          (k & 4) ? hdims.z() : -hdims.z()) -
+               center;
+        s[k] = Vdot(v[k], dir);
+    }
+
+    // In-plane basis (u, w) and 2D coordinates of the intersections of the plane with the box edges
+    ChVector<> u = Vcross(dir, VECT_Z);
+    if (u.Length2() < 1e-8)
+        u = Vcross(dir, VECT_X);
+    u.Normalize();
+    ChVector<> w = Vcross(dir, u);
+
+    double px[12];
+    double pz[12];
+    int np = 0;
+    for (int k = 0; k < 8; k++) {
+        for (int bit = 1; bit < 8; bit <<= 1) {
+            int l = k | bit;
+            if (l == k || (s[k] > 0) == (s[l] > 0))
+                continue;
+            ChVector<> p = v[k] + (s[k] / (s[k] - s[l])) * (v[l] - v[k]);
+            px[np] = Vdot(p, u);
+            pz[np] = Vdot(p, w);
+            np++;
+        }
+    }
+    if (np < 3)
+        return false;
+
+    // Order the polygon vertices counter-clockwise around their centroid
+    double cx = 0;
+    double cz = 0;
+    for (int k = 0; k < np; k++) {
+        cx += px[k] / np;
+        cz += pz[k] / np;
+    }
+    int order[12];
+    double angle[12];
+    for (int k = 0; k < np; k++) {
+        order[k] = k;
+        angle[k] = std::atan2(pz[k] - cz, px[k] - cx);
+    }
+    std::sort(order, order + np, [&angle](int a, int b) { return angle[a] < angle[b]; });
+
+    // Closest point on the polygon boundary to the circle center (the origin), and whether the center is inside
+    bool inside = true;
+    double d2_min = std::numeric_limits<double>::max();
+    double qx = 0;
+    double qz = 0;
+    double nx = 0;
+    double nz = 0;
+    for (int k = 0; k < np; k++) {
+        int a = order[k];
+        int b = order[(k + 1) % np];
+        double ex = px[b] - px[a];
+        double ez = pz[b] - pz[a];
+        double len2 = ex * ex + ez * ez;
+        if (len2 < 1e-20)
+            continue;
+        if (ex * (-pz[a]) - ez * (-px[a]) < 0)
+            inside = false;
+        double t = ChClamp(-(px[a] * ex + pz[a] * ez) / len2, 0.0, 1.0);
+        double x = px[a] + t * ex;
+        double z = pz[a] + t * ez;
+        if (x * x + z * z < d2_min) {
+            d2_min = x * x + z * z;
+            qx = x;
+            qz = z;
+            double len = std::sqrt(len2);
+            nx = ez / len;  // outward edge normal
+            nz = -ex / len;
+        }
+    }
+
+    double dist = std::sqrt(d2_min);
+    if (inside || dist < 1e-12) {
+        // Circle center inside the polygon: push out through the closest polygon edge
+        distance = -dist - radius;
+        normal = -nx * u - nz * w;
+    } else {
+        distance = dist - radius;
+        normal = (qx * u + qz * w) / dist;
+    }
+    pt_pad = center + qx * u + qz * w;
+
+    return true;
+}
+
+void SegmentedTrackWheelContactCB::CheckCylinderPad(const Wheel& wheel,
+                                                    ChBody* shoe,
+                                                    const ChVector<>& loc,
+                                                    const ChVector<>& dir,
+                                                    const Pad& pad) {
+    double envelope = wheel.envelope + m_envelope;
+
+    // Cylinder center relative to the box center
+    ChVector<> delta = loc - pad.center;
+
+    // Lateral penetrations, for pushing the shoe in the positive and negative Y directions, respectively.
+    // The cylinder extent along the shoe Y axis accounts for the tilt of the wheel axis.
+    double ay = std::abs(dir.y());
+    double ey = wheel.hwidth * ay + wheel.radius * std::sqrt(std::max(0.0, 1 - ay * ay));
+    double penP = (delta.y() + ey) + pad.hdims.y();
+    double penN = pad.hdims.y() - (delta.y() - ey);
+    double pen_lat = std::min(penP, penN);
+    if (pen_lat < -envelope)
+        return;
+
+    // Radial test: deepest of the cylinder cross-sections at the center and at the two end faces
+    ChVector<> normal;  // contact normal, from wheel to shoe (box frame)
+    ChVector<> pt_pad;  // contact point on shoe box (relative to box center)
+    double distance = std::numeric_limits<double>::max();  // signed contact distance (negative for penetration)
+    for (double offset : {0.0, -wheel.hwidth, +wheel.hwidth}) {
+        double d;
+        ChVector<> n;
+        ChVector<> p;
+        if (CheckCirclePad(delta + offset * dir, dir, wheel.radius, pad.hdims, d, n, p) && d < distance) {
+            distance = d;
+            normal = n;
+            pt_pad = p;
+        }
+    }
+    if (distance > envelope)
+        return;
+
+    collision::ChCollisionInfo contact;
+
+    if (pen_lat < -distance) {
+        // Lateral contact (smallest penetration along the shoe Y axis), between the wheel side and a box side
+        distance = -pen_lat;
+        normal = ChVector<>(0, penP < penN ? +1 : -1, 0);
+        pt_pad = ChVector<>(ChClamp(delta.x(), -pad.hdims.x(), pad.hdims.x()), -normal.y() * pad.hdims.y(),
+                            ChClamp(delta.z(), -pad.hdims.z(), pad.hdims.z()));
+        contact.eff_radius = collision::ChCollisionInfo::GetDefaultEffectiveCurvatureRadius();
+    } else {
+        // Radial contact (wheel tread)
+        contact.eff_radius = wheel.radius;
+    }
+    ChVector<> pt_wheel = pt_pad - distance * normal;
+
+    // Fill in contact information and add the contact to the system.
+    // Express all vectors in the global frame
+    contact.modelA = wheel.body->GetCollisionModel().get();
+    contact.modelB = shoe->GetCollisionModel().get();
+    contact.shapeA = nullptr;
+    contact.shapeB = nullptr;
+    contact.vN = shoe->TransformDirectionLocalToParent(normal);
+    contact.vpA = shoe->TransformPointLocalToParent(pad.center + pt_wheel);
+    contact.vpB = shoe->TransformPointLocalToParent(pad.center + pt_pad);
+    contact.distance = distance;
+
+    const auto& pad_material = shoe->GetCollisionModel()->GetShape(pad.shape)->GetMaterial();
+    shoe->GetSystem()->GetContactContainer()->AddContact(contact, wheel.material, pad_material);
+}
+
+// -----------------------------------------------------------------------------
+
 ChTrackAssemblySegmented::ChTrackAssemblySegmented(const std::string& name, VehicleSide side)
     : ChTrackAssembly(name, side), m_torque_funct(nullptr), m_bushing_data(nullptr) {}
 
@@ -38,6 +355,65 @@ void ChTrackAssemblySegmented::EnableTrackBendingStiffness(bool val) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Create the callback for analytic contact between track shoes and track wheels.
+// This is possible only if the shoe collision geometry consists of boxes aligned with the shoe reference frame.
+// -----------------------------------------------------------------------------
+std::shared_ptr<ChSystem::CustomCollisionCallback> ChTrackAssemblySegmented::CreateWheelContactCallback() {
+    if (GetNumTrackShoes() == 0)
+        return nullptr;
+
+    auto shoe = std::static_pointer_cast<ChTrackShoeSegmented>(GetTrackShoe(0));
+    const auto& geometry = shoe->m_geometry;
+    if (!geometry.m_has_collision || geometry.m_coll_boxes.empty())
+        return nullptr;
+    if (!geometry.m_coll_spheres.empty() || !geometry.m_coll_cylinders.empty() || !geometry.m_coll_hulls.empty() ||
+        !geometry.m_coll_meshes.empty())
+        return nullptr;
+
+    // Contact materials are those of the individual shoe collision boxes (boxes are the only collision shapes)
+    std::vector<SegmentedTrackWheelContactCB::Pad> pads;
+    for (int ib = 0; ib < (int)geometry.m_coll_boxes.size(); ib++) {
+        const auto& box = geometry.m_coll_boxes[ib];
+        if (std::abs(std::abs(box.m_rot.e0()) - 1) > 1e-6)
+            return nullptr;
+        pads.push_back({box.m_pos, box.m_dims / 2, ib});
+    }
+
+    std::vector<std::shared_ptr<ChTrackWheel>> track_wheels = m_rollers;
+    track_wheels.push_back(GetIdlerWheel());
+    for (auto& suspension : m_suspensions)
+        track_wheels.push_back(suspension->GetRoadWheel());
+
+    std::vector<SegmentedTrackWheelContactCB::Wheel> wheels;
+    for (const auto& track_wheel : track_wheels) {
+        SegmentedTrackWheelContactCB::Wheel wheel;
+        wheel.body = track_wheel->GetBody();
+        wheel.material = track_wheel->GetContactMaterial();
+        wheel.radius = track_wheel->GetRadius();
+        if (auto double_wheel = std::dynamic_pointer_cast<ChDoubleTrackWheel>(track_wheel)) {
+            double width = double_wheel->GetWidth();
+            double gap = double_wheel->GetGap();
+            wheel.hwidth = 0.25 * (width - gap);
+            wheel.offsets = {+0.25 * (width + gap), -0.25 * (width + gap)};
+        } else {
+            wheel.hwidth = 0.5 * track_wheel->GetWidth();
+            wheel.offsets = {0};
+        }
+        double hlength = std::abs(wheel.offsets[0]) + wheel.hwidth;
+        wheel.bound = std::sqrt(wheel.radius * wheel.radius + hlength * hlength);
+        wheel.envelope = wheel.body->GetCollisionModel()->GetEnvelope();
+        wheels.push_back(wheel);
+    }
+
+    // Use the same envelopes as generic collision detection between the shoe and wheel collision models
+    double envelope = shoe->GetShoeBody()->GetCollisionModel()->GetEnvelope();
+
+    return chrono_types::make_shared<SegmentedTrackWheelContactCB>(this, envelope, pads, wheels);
+}
+
+// -----------------------------------------------------------------------------
+
 double ChTrackAssemblySegmented::TrackBendingFunctor::evaluate(double time,
                                                                double rest_angle,
                                                                double angle,
@@ -73,6 +73,10 @@ class CH_VEHICLE_API ChTrackAssemblySegmented : public ChTrackAssembly {
                              VehicleSide side          ///< [in] assembly on left/right vehicle side
     );
 
+    /// Create the callback for analytic contact between track shoes and track wheels.
+    /// Analytic contact is supported only if the shoe collision geometry consists of axis-aligned boxes.
+    virtual std::shared_ptr<ChSystem::CustomCollisionCallback> CreateWheelContactCallback() override;
+
     std::shared_ptr<ChLinkRSDA::TorqueFunctor> m_torque_funct;  ///< torque for track bending stiffness
     std::shared_ptr<ChVehicleBushingData> m_bushing_data;       ///< track pin bushings
 };
@@ -30,8 +30,8 @@ namespace vehicle {
 
 TrackShoeDoublePin::TrackShoeDoublePin(const std::string& filename)
     : ChTrackShoeDoublePin("", DoublePinTrackShoeType::TWO_CONNECTORS) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -61,6 +61,8 @@ class CH_VEHICLE_API ChDoubleTrackWheel : public ChTrackWheel {
   protected:
     /// Return the gap width.
     virtual double GetGap() const = 0;
+
+    friend class ChTrackAssemblySegmented;
 };
 
 /// @} vehicle_tracked_suspension
@@ -49,7 +49,8 @@ ChAdaptiveSpeedController::ChAdaptiveSpeedController()
 
 ChAdaptiveSpeedController::ChAdaptiveSpeedController(const std::string& filename)
     : m_speed(0), m_err(0), m_errd(0), m_erri(0), m_csv(nullptr), m_collect(false) {
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
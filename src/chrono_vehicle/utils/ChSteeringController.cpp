@@ -106,8 +106,8 @@ ChPathSteeringController::ChPathSteeringController(const std::string& filename,
     // Create a tracker object associated with the given path.
     m_tracker = std::unique_ptr<ChBezierCurveTracker>(new ChBezierCurveTracker(path));
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -230,8 +230,8 @@ ChPathSteeringControllerXT::ChPathSteeringControllerXT(const std::string& filena
         m_max_wheel_turn_angle = max_wheel_turn_angle;
     }
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -475,8 +475,8 @@ ChPathSteeringControllerSR::ChPathSteeringControllerSR(const std::string& filena
     // retireve points
     CalcPathPoints();
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -666,8 +666,8 @@ ChPathSteeringControllerStanley::ChPathSteeringControllerStanley(const std::stri
       m_Tdelay(0.4) {
     SetGains(0.0, 0.0, 0.0);
     m_tracker = std::unique_ptr<ChBezierCurveTracker>(new ChBezierCurveTracker(path));
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -16,6 +16,7 @@
 //
 // =============================================================================
 
+#include <atomic>
 #include <fstream>
 
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
@@ -107,6 +108,39 @@ void ReadFileJSON(const std::string& filename, Document& d) {
     }
 }
 
+std::shared_ptr<const Document> ReadFileJSON(const std::string& filename, utils::ChAssetCache& cache) {
+    auto doc = cache.GetFromFile<const Document>(filename, "json", [&filename](const std::string& contents) {
+        auto doc = chrono_types::make_shared<Document>();
+        doc->Parse<ParseFlag::kParseCommentsFlag>(contents.c_str());
+        if (doc->IsNull()) {
+            GetLog() << "ERROR: Invalid JSON file: " << filename << "\n";
+        }
+        return std::shared_ptr<const Document>(doc);
+    });
+
+    if (!doc) {
+        GetLog() << "ERROR: Could not open JSON file: " << filename << "\n";
+        return chrono_types::make_shared<Document>();
+    }
+
+    return doc;
+}
+
+static std::shared_ptr<utils::ChAssetCache> json_cache;
+
+void SetCacheJSON(std::shared_ptr<utils::ChAssetCache> cache) {
+    std::atomic_store(&json_cache, cache);
+}
+
+std::shared_ptr<const Document> ReadFileJSON(const std::string& filename) {
+    if (auto cache = std::atomic_load(&json_cache))
+        return ReadFileJSON(filename, *cache);
+
+    auto doc = chrono_types::make_shared<Document>();
+    ReadFileJSON(filename, *doc);
+    return doc;
+}
+
 // -----------------------------------------------------------------------------
 
 ChVector<> ReadVectorJSON(const Value& a) {
@@ -626,8 +660,8 @@ std::shared_ptr<ChLinkRSDA::TorqueFunctor> ReadRSDAFunctorJSON(const rapidjson::
 std::shared_ptr<ChChassis> ReadChassisJSON(const std::string& filename) {
     std::shared_ptr<ChChassis> chassis;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -653,8 +687,8 @@ std::shared_ptr<ChChassis> ReadChassisJSON(const std::string& filename) {
 std::shared_ptr<ChChassisRear> ReadChassisRearJSON(const std::string& filename) {
     std::shared_ptr<ChChassisRear> chassis;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -680,8 +714,8 @@ std::shared_ptr<ChChassisRear> ReadChassisRearJSON(const std::string& filename)
 std::shared_ptr<ChChassisConnector> ReadChassisConnectorJSON(const std::string& filename) {
     std::shared_ptr<ChChassisConnector> connector;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -711,8 +745,8 @@ std::shared_ptr<ChChassisConnector> ReadChassisConnectorJSON(const std::string&
 std::shared_ptr<ChPowertrain> ReadPowertrainJSON(const std::string& filename) {
     std::shared_ptr<ChPowertrain> powertrain;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -746,8 +780,8 @@ std::shared_ptr<ChPowertrain> ReadPowertrainJSON(const std::string& filename) {
 std::shared_ptr<ChSuspension> ReadSuspensionJSON(const std::string& filename) {
     std::shared_ptr<ChSuspension> suspension;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -805,8 +839,8 @@ std::shared_ptr<ChSuspension> ReadSuspensionJSON(const std::string& filename) {
 std::shared_ptr<ChSteering> ReadSteeringJSON(const std::string& filename) {
     std::shared_ptr<ChSteering> steering;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -836,8 +870,8 @@ std::shared_ptr<ChSteering> ReadSteeringJSON(const std::string& filename) {
 std::shared_ptr<ChDrivelineWV> ReadDrivelineWVJSON(const std::string& filename) {
     std::shared_ptr<ChDrivelineWV> driveline;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -869,8 +903,8 @@ std::shared_ptr<ChDrivelineWV> ReadDrivelineWVJSON(const std::string& filename)
 std::shared_ptr<ChAntirollBar> ReadAntirollbarJSON(const std::string& filename) {
     std::shared_ptr<ChAntirollBar> antirollbar;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -896,8 +930,8 @@ std::shared_ptr<ChAntirollBar> ReadAntirollbarJSON(const std::string& filename)
 std::shared_ptr<ChWheel> ReadWheelJSON(const std::string& filename) {
     std::shared_ptr<ChWheel> wheel;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -923,8 +957,8 @@ std::shared_ptr<ChWheel> ReadWheelJSON(const std::string& filename) {
 std::shared_ptr<ChSubchassis> ReadSubchassisJSON(const std::string& filename) {
     std::shared_ptr<ChSubchassis> chassis;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -950,8 +984,8 @@ std::shared_ptr<ChSubchassis> ReadSubchassisJSON(const std::string& filename) {
 std::shared_ptr<ChBrake> ReadBrakeJSON(const std::string& filename) {
     std::shared_ptr<ChBrake> brake;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -979,8 +1013,8 @@ std::shared_ptr<ChBrake> ReadBrakeJSON(const std::string& filename) {
 std::shared_ptr<ChTire> ReadTireJSON(const std::string& filename) {
     std::shared_ptr<ChTire> tire;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -1024,8 +1058,8 @@ std::shared_ptr<ChTire> ReadTireJSON(const std::string& filename) {
 std::shared_ptr<ChTrackAssembly> ReadTrackAssemblyJSON(const std::string& filename) {
     std::shared_ptr<ChTrackAssembly> track;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -1057,8 +1091,8 @@ std::shared_ptr<ChTrackAssembly> ReadTrackAssemblyJSON(const std::string& filena
 std::shared_ptr<ChDrivelineTV> ReadDrivelineTVJSON(const std::string& filename) {
     std::shared_ptr<ChDrivelineTV> driveline;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -1086,8 +1120,8 @@ std::shared_ptr<ChDrivelineTV> ReadDrivelineTVJSON(const std::string& filename)
 std::shared_ptr<ChTrackBrake> ReadTrackBrakeJSON(const std::string& filename) {
     std::shared_ptr<ChTrackBrake> brake;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -1115,8 +1149,8 @@ std::shared_ptr<ChTrackBrake> ReadTrackBrakeJSON(const std::string& filename) {
 std::shared_ptr<ChIdler> ReadIdlerJSON(const std::string& filename) {
     std::shared_ptr<ChIdler> idler;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -1144,8 +1178,8 @@ std::shared_ptr<ChIdler> ReadIdlerJSON(const std::string& filename) {
 std::shared_ptr<ChTrackSuspension> ReadTrackSuspensionJSON(const std::string& filename, bool has_shock, bool lock_arm) {
     std::shared_ptr<ChTrackSuspension> suspension;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -1173,8 +1207,8 @@ std::shared_ptr<ChTrackSuspension> ReadTrackSuspensionJSON(const std::string& fi
 std::shared_ptr<ChTrackWheel> ReadTrackWheelJSON(const std::string& filename) {
     std::shared_ptr<ChTrackWheel> wheel;
 
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return nullptr;
 
@@ -22,6 +22,7 @@
 #include "chrono/assets/ChColor.h"
 #include "chrono/core/ChQuaternion.h"
 #include "chrono/core/ChVector.h"
+#include "chrono/utils/ChAssetCache.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChChassis.h"
@@ -50,6 +51,23 @@ namespace vehicle {
 /// A Null document is returned if the file cannot be opened.
 CH_VEHICLE_API void ReadFileJSON(const std::string& filename, rapidjson::Document& d);
 
+/// Load and return a RapidJSON document from the specified file, using the given asset cache.
+/// The file is parsed only once per cache (e.g., across all runs of an ensemble) and all callers share the returned
+/// read-only document. A Null document is returned if the file cannot be opened.
+CH_VEHICLE_API std::shared_ptr<const rapidjson::Document> ReadFileJSON(const std::string& filename,
+                                                                       utils::ChAssetCache& cache);
+
+/// Load and return a read-only RapidJSON document from the specified file.
+/// If a JSON cache was set (see SetCacheJSON), the document is obtained from that cache; otherwise, the file is parsed.
+/// All Chrono::Vehicle JSON-based subsystem and vehicle templates load their specification files through this function.
+/// A Null document is returned if the file cannot be opened.
+CH_VEHICLE_API std::shared_ptr<const rapidjson::Document> ReadFileJSON(const std::string& filename);
+
+/// Set the asset cache used for all JSON specification files loaded with ReadFileJSON(filename).
+/// Typically, this is the asset cache of an ensemble (utils::ChEnsembleRunner), so that each specification file is
+/// parsed only once for all runs. Pass an empty pointer to disable caching (default).
+CH_VEHICLE_API void SetCacheJSON(std::shared_ptr<utils::ChAssetCache> cache);
+
 // -----------------------------------------------------------------------------
 
 /// Load and return a ChVector from the specified JSON array
@@ -25,8 +25,8 @@ namespace chrono {
 namespace vehicle {
 
 Balancer::Balancer(const std::string& filename) : ChBalancer(""), m_bushingData(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -37,8 +37,8 @@ DoubleWishbone::DoubleWishbone(const std::string& filename)
       m_UCABushingData(nullptr),
       m_LCABushingData(nullptr),
       m_tierodBushingData(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -28,8 +28,8 @@ namespace vehicle {
 // Construct a suspension using data from the specified JSON file.
 // -----------------------------------------------------------------------------
 GenericWheeledSuspension::GenericWheeledSuspension(const std::string& filename) : ChGenericWheeledSuspension("") {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -32,8 +32,8 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 MacPhersonStrut::MacPhersonStrut(const std::string& filename)
     : ChMacPhersonStrut(""), m_springForceCB(nullptr), m_shockForceCB(nullptr), m_LCABushingData(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -30,8 +30,8 @@ namespace vehicle {
 // Construct a rigid suspension using data from the specified JSON file.
 // -----------------------------------------------------------------------------
 RigidPinnedAxle::RigidPinnedAxle(const std::string& filename) : ChRigidPinnedAxle("") {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -30,7 +30,8 @@ namespace vehicle {
 // Construct a Rigid suspension using data from the specified JSON file.
 // -----------------------------------------------------------------------------
 RigidSuspension::RigidSuspension(const std::string& filename) : ChRigidSuspension("") {
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
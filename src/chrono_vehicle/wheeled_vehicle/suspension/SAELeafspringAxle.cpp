@@ -37,8 +37,8 @@ SAELeafspringAxle::SAELeafspringAxle(const std::string& filename)
       m_shackleBushingData(nullptr),
       m_clampBushingData(nullptr),
       m_leafspringBushingData(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
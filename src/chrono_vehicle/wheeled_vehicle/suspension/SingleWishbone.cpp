@@ -29,8 +29,8 @@ namespace vehicle {
 // Construct a single wishbone suspension using data from the specified JSON file.
 SingleWishbone::SingleWishbone(const std::string& filename)
     : ChSingleWishbone(""), m_shockForceCB(nullptr), m_CABushingData(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
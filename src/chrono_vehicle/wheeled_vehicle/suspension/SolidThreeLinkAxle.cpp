@@ -32,8 +32,8 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 SolidThreeLinkAxle::SolidThreeLinkAxle(const std::string& filename)
     : ChSolidThreeLinkAxle(""), m_springForceCB(NULL), m_shockForceCB(NULL) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
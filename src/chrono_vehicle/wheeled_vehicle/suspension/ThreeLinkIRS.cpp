@@ -39,8 +39,8 @@ ThreeLinkIRS::ThreeLinkIRS(const std::string& filename)
       m_armLowerBushingData(nullptr),
       m_chassisUpperBushingData(nullptr),
       m_chassisLowerBushingData(nullptr) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -28,8 +28,8 @@ namespace vehicle {
 
 // Constructors for ANCFTire
 ANCFTire::ANCFTire(const std::string& filename) : ChANCFTire(""), m_ANCF8(false) {
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -33,7 +33,8 @@ WheeledTrailer::WheeledTrailer(ChSystem* system, const std::string& filename, bo
 
 void WheeledTrailer::Create(const std::string& filename, bool create_tires) {
     // Open and parse the input file
-    Document d; ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -45,8 +45,8 @@ WheeledVehicle::WheeledVehicle(ChSystem* system, const std::string& filename, bo
 // -----------------------------------------------------------------------------
 void WheeledVehicle::Create(const std::string& filename, bool create_powertrain, bool create_tires) {
     // Open and parse the input file
-    Document d;
-    ReadFileJSON(filename, d);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
     if (d.IsNull())
         return;
 
@@ -927,7 +927,16 @@ void ChVisualSystemVSG::Render() {
     m_timer_render.reset();
     m_timer_render.start();
 
-    UpdateFromMBS();
+    // In snapshot mode, all dynamic data is taken from the most recent snapshot (the Chrono system is not accessed)
+    bool snapshot_mode = SnapshotsEnabled();
+    const ChVisualSnapshot* snapshot = nullptr;
+    if (snapshot_mode) {
+        snapshot = AcquireSnapshot();
+        if (snapshot)
+            UpdateFromSnapshot(*snapshot);
+    } else {
+        UpdateFromMBS();
+    }
 
     if (!m_viewer->advanceToNextFrame()) {
         return;
@@ -940,7 +949,10 @@ void ChVisualSystemVSG::Render() {
 
     // Dynamic data transfer CPU -> GPU
 
-    if (m_allowPositionTransfer) {
+    if (snapshot)
+        TransferFromSnapshot(*snapshot);
+
+    if (m_allowPositionTransfer && !snapshot_mode) {
         // Point clouds
         for (const auto& pc : m_clouds) {
             if (!pc.dyn_pos)
@@ -955,7 +967,7 @@ void ChVisualSystemVSG::Render() {
         }
     }
 
-    if (m_allowVertexTransfer) {
+    if (m_allowVertexTransfer && !snapshot_mode) {
         for (auto& vertices : m_vsgVerticesList) {
             size_t k = 0;
             for (auto& v : *vertices) {
@@ -966,7 +978,7 @@ void ChVisualSystemVSG::Render() {
         }
     }
 
-    if (m_allowNormalsTransfer) {
+    if (m_allowNormalsTransfer && !snapshot_mode) {
         for (auto& normals : m_vsgNormalsList) {
             size_t k = 0;
             for (auto& n : *normals) {
@@ -977,7 +989,7 @@ void ChVisualSystemVSG::Render() {
         }
     }
 
-    if (m_allowColorsTransfer) {
+    if (m_allowColorsTransfer && !snapshot_mode) {
         // Point clouds
         for (const auto& pc : m_clouds) {
             if (!pc.dyn_col)
@@ -1550,6 +1562,96 @@ void ChVisualSystemVSG::UpdateFromMBS() {
     }
 }
 
+// Update body transforms from a snapshot.
+// Note that link visualization shapes (springs, segments) are not updated in snapshot mode.
+void ChVisualSystemVSG::UpdateFromSnapshot(const ChVisualSnapshot& snapshot) {
+    if (m_show_cog) {
+        for (auto& child : m_cogScene->children) {
+            std::shared_ptr<ChBody> body;
+            vsg::ref_ptr<vsg::MatrixTransform> transform;
+            if (!child.node->getValue("Body", body))
+                continue;
+            if (!child.node->getValue("Transform", transform))
+                continue;
+            if (auto frame = snapshot.GetBodyCOGFrame(body.get()))
+                transform->matrix = vsg::dmat4CH(*frame, m_cog_scale);
+        }
+    }
+
+    for (const auto& child : m_bodyScene->children) {
+        std::shared_ptr<ChBody> body;
+        vsg::ref_ptr<vsg::MatrixTransform> transform;
+        if (!child->getValue("Body", body))
+            continue;
+        if (!child->getValue("Transform", transform))
+            continue;
+        if (auto frame = snapshot.GetBodyFrame(body.get()))
+            transform->matrix = vsg::dmat4CH(*frame, 1.0);
+    }
+}
+
+// Transfer particle positions and colors, and deformable mesh buffers from a snapshot.
+void ChVisualSystemVSG::TransferFromSnapshot(const ChVisualSnapshot& snapshot) {
+    for (const auto& pc : m_clouds) {
+        auto data = snapshot.GetParticleCloud(pc.pcloud.get());
+        if (!data)
+            continue;
+        if (pc.dyn_pos) {
+            auto& positions = m_cloud_positions[pc.start_pos];
+            if (positions->size() == data->positions.size()) {
+                for (size_t k = 0; k < data->positions.size(); k++)
+                    positions->set(k, vsg::vec3CH(data->positions[k]));
+                positions->dirty();
+            }
+        }
+        if (pc.dyn_col) {
+            auto& colors = m_cloud_colors[pc.start_col];
+            if (colors->size() == data->colors.size()) {
+                for (size_t k = 0; k < data->colors.size(); k++) {
+                    const auto& color = data->colors[k];
+                    colors->set(k, vsg::vec4(color.R, color.G, color.B, 1));
+                }
+                colors->dirty();
+            }
+        }
+    }
+
+    if (!m_mbsMesh)
+        return;
+    auto mesh = snapshot.GetTriangleMesh(m_mbsMesh.get());
+    if (!mesh)
+        return;
+
+    if (m_allowVertexTransfer && mesh->vertices.size() == m_num_vsgVertexList) {
+        size_t k = 0;
+        for (auto& vertices : m_vsgVerticesList) {
+            for (auto& v : *vertices)
+                v = vsg::vec3CH(mesh->vertices[k++]);
+            vertices->dirty();
+        }
+    }
+
+    if (m_allowNormalsTransfer && mesh->normals.size() == m_num_vsgVertexList) {
+        size_t k = 0;
+        for (auto& normals : m_vsgNormalsList) {
+            for (auto& n : *normals)
+                n = vsg::vec3CH(mesh->normals[k++]);
+            normals->dirty();
+        }
+    }
+
+    if (m_allowColorsTransfer && mesh->colors.size() == m_num_vsgVertexList) {
+        size_t k = 0;
+        for (auto& colors : m_vsgColorsList) {
+            for (auto& c : *colors) {
+                const auto& color = mesh->colors[k++];
+                c.set(color.R, color.G, color.B, 1.0f);
+            }
+            colors->dirty();
+        }
+    }
+}
+
 void ChVisualSystemVSG::OnSetup(ChSystem* sys) {
     //// RADU TODO
     ////    delete VSG elements associated with physics items no longer present in the system
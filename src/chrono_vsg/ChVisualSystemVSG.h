@@ -189,6 +189,10 @@ class CH_VSG_API ChVisualSystemVSG : virtual public ChVisualSystem {
 
     void UpdateFromMBS();
 
+    /// Update the scene from a snapshot recorded by the associated system (see ChVisualSystem::EnableSnapshots).
+    void UpdateFromSnapshot(const ChVisualSnapshot& snapshot);
+    void TransferFromSnapshot(const ChVisualSnapshot& snapshot);
+
     bool m_initialized = false;
     int m_screen_num = -1;
     bool m_use_fullscreen = false;
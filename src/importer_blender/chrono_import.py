@@ -37,6 +37,10 @@
 #   if a material is added to a visual shape in Chrono, it overrides the material you add to
 #   the asset object available in "chrono_assets" collection (unless you disable "Chrono materials" in
 #   the Chrono sidebar panel).
+# - for large scenes, use my_blender_exporter.SetBinaryStateOutput(True) in Chrono: the poses of
+#   bodies are then saved in compact binary files state00001.bin, ..., referencing the lists of
+#   shapes in the xxx.instances.py file; this add-on loads both automatically, and creates
+#   bodies with the same list of shapes as instances of a single object.
 
 
 
@@ -96,6 +100,9 @@ chrono_view_link_csys_size = 0.25
 chrono_view_materials = True
 chrono_view_contacts = False
 chrono_gui_doupdate = True
+chrono_instances = {}
+chrono_item_names = {}
+chrono_instances_file_size = -1
 
 #
 # utility functions to be used in assets.py  or   output/statexxxyy.py files
@@ -620,6 +627,71 @@ def make_chrono_object_assetlist(mname,mpos,mrot, masset_list):
                 chrono_frame_objects.objects.link(mcsys) 
         else:
             print("not found asset: ",masset_list[m][0])
+    return chobject
+
+
+#
+# Load the shape lists (instances) and item names used by binary state files, 
+# if the xxx.instances.py file changed since last time.
+#
+
+def load_chrono_instances():
+    global chrono_instances_file_size
+    instances_filename = chrono_filename.replace('.assets.py', '.instances.py')
+    if not os.path.exists(instances_filename):
+        return
+    size = os.path.getsize(instances_filename)
+    if size != chrono_instances_file_size:
+        f = open(instances_filename, "rb")
+        exec(compile(f.read(), instances_filename, 'exec'))
+        f.close()
+        chrono_instances_file_size = size
+
+
+#
+# Create the objects saved in a binary state file by ChBlender::SetBinaryStateOutput().
+# The file has a 32-byte header (magic 'CHBF', version, frame, flags, time, number of records) 
+# followed by one record per body: item ID, instance ID, position (doubles), rotation quaternion,
+# and optionally a color (if flags & 1) and a scalar (if flags & 2).
+# Bodies sharing the same instance (list of shapes) are not created as separate objects: one
+# instancer object per instance is made with make_chrono_object_clones(), and the optional
+# color and scalar are stored as per-face attributes 'chrono_color' and 'chrono_scalar'
+# of the instancer mesh (use materials with per_instance=True to show them).
+#
+
+def make_chrono_objects_binary(filename):
+    load_chrono_instances()
+    proj_dir = os.path.dirname(os.path.abspath(chrono_filename))
+    f = open(os.path.join(proj_dir, filename), "rb")
+    raw = f.read()
+    f.close()
+    if len(raw) < 32 or raw[0:4] != b'CHBF':
+        print("not a Chrono binary state file: ", filename)
+        return
+    version, frame, flags = np.frombuffer(raw, dtype='<u4', count=3, offset=4)
+    if version != 2:
+        print("unsupported Chrono binary state file version: ", version)
+        return
+    num_records = int(np.frombuffer(raw, dtype='<u8', count=1, offset=24)[0])
+    fields = [('item','<u4'), ('instance','<u4'), ('pos','<f8',(3,)), ('rot','<f4',(4,))]
+    if flags & 1:
+        fields.append(('color','<f4',(3,)))
+    if flags & 2:
+        fields.append(('scalar','<f4'))
+    records = np.frombuffer(raw, dtype=np.dtype(fields), count=num_records, offset=32)
+    for instance in np.unique(records['instance']):
+        masset_list = chrono_instances.get(int(instance))
+        if masset_list is None:
+            print("not found instance: ", int(instance))
+            continue
+        irecords = records[records['instance'] == instance]
+        list_clones_posrot = [(tuple(r['pos']), tuple(float(q) for q in r['rot'])) for r in irecords]
+        chobject = make_chrono_object_clones('chrono_instance_'+str(int(instance)), (0,0,0), (1,0,0,0), masset_list, list_clones_posrot)
+        chobject['chrono_items'] = [chrono_item_names.get(int(r['item']), '') for r in irecords]
+        if flags & 1:
+            add_mesh_data_vectors(chobject, [tuple(float(c) for c in r['color']) for r in irecords], 'chrono_color', 'FACE')
+        if flags & 2:
+            add_mesh_data_floats(chobject, [float(r['scalar']) for r in irecords], 'chrono_scalar', 'FACE')
     
     
 def make_chrono_object_clones(mname,mpos,mrot, 
@@ -687,7 +759,7 @@ def make_chrono_object_clones(mname,mpos,mrot,
     chobject.instance_type = 'FACES'
     chobject.show_instancer_for_render = False
     chobject.show_instancer_for_viewport = False
-    
+    return chobject
     
    
 def make_chrono_glyphs_objects(mname,mpos,mrot, 
@@ -1346,6 +1418,7 @@ def read_chrono_simulation(context, filepath, setting_materials):
     global chrono_csys
     global empty_mesh
     global chrono_filename
+    global chrono_instances_file_size
     global chrono_view_asset_csys
     global chrono_view_asset_csys_size
     global chrono_view_item_csys
@@ -1522,6 +1595,11 @@ def read_chrono_simulation(context, filepath, setting_materials):
     
     chrono_filename = filepath
     
+    # forget instances of binary state files of previous imports
+    chrono_instances.clear()
+    chrono_item_names.clear()
+    chrono_instances_file_size = -1
+    
     # store filename as custom properties of collection, so that one can save the Blender project,
     # reopen, and scrub the timeline without the need of doing File/Import/Chrono Import
     chrono_assets['chrono_filename'] = chrono_filename
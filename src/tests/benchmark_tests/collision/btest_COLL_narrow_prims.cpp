@@ -0,0 +1,155 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2021 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Microbenchmarks for the analytic narrowphase between a sphere and a sphere,
+// box, capsule, or triangle: batched structure-of-arrays kernels
+// (ChNarrowphase::ProcessBatch) versus per-pair dispatch
+// (ChNarrowphase::PRIMSCollision) on the same randomly generated pairs.
+//
+// =============================================================================
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/collision/chrono/ChNarrowphase.h"
+#include "chrono/collision/chrono/ChConvexShape.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+using BatchType = ChNarrowphase::BatchType;
+
+const int num_pairs = 4096;
+const real separation = 0.02;
+
+// Random candidate pairs of the given type, both as shapes and as a batch
+struct PairSet {
+    PairSet(BatchType type);
+
+    BatchType type;
+    std::vector<std::unique_ptr<ConvexBase>> shapes1;
+    std::vector<std::unique_ptr<ConvexBase>> shapes2;
+    ChNarrowphase::PairBatch batch;
+};
+
+PairSet::PairSet(BatchType type) : type(type) {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<real> unif(-1, 1);
+    auto rand3 = [&](real scale) { return real3(scale * unif(gen), scale * unif(gen), scale * unif(gen)); };
+
+    batch.Resize(type, num_pairs);
+    for (int i = 0; i < num_pairs; i++) {
+        real3 pos = rand3(1);
+        quaternion rot = Normalize(quaternion(unif(gen), unif(gen), unif(gen), unif(gen)));
+        real3 dims(0.4, 0.5, 0.6);
+        batch.px[i] = pos.x;
+        batch.py[i] = pos.y;
+        batch.pz[i] = pos.z;
+        batch.dx[i] = dims.x;
+        switch (type) {
+            case BatchType::SPHERE_SPHERE:
+                shapes1.emplace_back(new ConvexShapeCustom(ChCollisionShape::Type::SPHERE, pos, rot, dims));
+                break;
+            case BatchType::BOX_SPHERE:
+            case BatchType::CAPSULE_SPHERE:
+                shapes1.emplace_back(new ConvexShapeCustom(
+                    type == BatchType::BOX_SPHERE ? ChCollisionShape::Type::BOX : ChCollisionShape::Type::CAPSULE, pos,
+                    rot, dims));
+                batch.qw[i] = rot.w;
+                batch.qx[i] = rot.x;
+                batch.qy[i] = rot.y;
+                batch.qz[i] = rot.z;
+                batch.dy[i] = dims.y;
+                if (type == BatchType::BOX_SPHERE)
+                    batch.dz[i] = dims.z;
+                break;
+            case BatchType::TRIANGLE_SPHERE: {
+                real3 B = pos + rand3(1);
+                real3 C = pos + rand3(1);
+                shapes1.emplace_back(new ConvexShapeTriangle(pos, B, C));
+                batch.bx[i] = B.x;
+                batch.by[i] = B.y;
+                batch.bz[i] = B.z;
+                batch.cx[i] = C.x;
+                batch.cy[i] = C.y;
+                batch.cz[i] = C.z;
+                break;
+            }
+            default:
+                break;
+        }
+
+        real3 center = pos + rand3(1);
+        real radius = 0.5;
+        shapes2.emplace_back(new ConvexShapeSphere(center, radius));
+        batch.sx[i] = center.x;
+        batch.sy[i] = center.y;
+        batch.sz[i] = center.z;
+        batch.r[i] = radius;
+    }
+}
+
+static const char* TypeName(BatchType type) {
+    switch (type) {
+        case BatchType::SPHERE_SPHERE:
+            return "sphere-sphere";
+        case BatchType::BOX_SPHERE:
+            return "box-sphere";
+        case BatchType::CAPSULE_SPHERE:
+            return "capsule-sphere";
+        case BatchType::TRIANGLE_SPHERE:
+            return "triangle-sphere";
+        default:
+            return "";
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static void NarrowBatched(benchmark::State& state) {
+    PairSet pairs((BatchType)state.range(0));
+    for (auto _ : state) {
+        ChNarrowphase::ProcessBatch(pairs.type, separation, pairs.batch, 0, num_pairs);
+        benchmark::DoNotOptimize(pairs.batch.active.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_pairs);
+    state.SetLabel(TypeName(pairs.type));
+}
+
+static void NarrowPerPair(benchmark::State& state) {
+    PairSet pairs((BatchType)state.range(0));
+    std::vector<real3> norm(num_pairs);
+    std::vector<real3> pt1(num_pairs);
+    std::vector<real3> pt2(num_pairs);
+    std::vector<real> depth(num_pairs);
+    std::vector<real> eff_rad(num_pairs);
+    std::vector<int> nC(num_pairs);
+    for (auto _ : state) {
+        for (int i = 0; i < num_pairs; i++) {
+            ChNarrowphase::PRIMSCollision(pairs.shapes1[i].get(), pairs.shapes2[i].get(), separation, &norm[i],
+                                          &pt1[i], &pt2[i], &depth[i], &eff_rad[i], nC[i]);
+        }
+        benchmark::DoNotOptimize(nC.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * num_pairs);
+    state.SetLabel(TypeName(pairs.type));
+}
+
+BENCHMARK(NarrowBatched)->DenseRange(0, (int)BatchType::NONE - 1);
+BENCHMARK(NarrowPerPair)->DenseRange(0, (int)BatchType::NONE - 1);
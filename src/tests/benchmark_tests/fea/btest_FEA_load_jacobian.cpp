@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark test for the evaluation of load Jacobians.
+// Compares the cost of evaluating the Jacobians of pressure loads on a mesh of
+// ANCF shell elements with finite differences and with forward-mode automatic
+// differentiation. Note that the finite-difference evaluation does not capture
+// the dependency of the follower load on the surface orientation.
+//
+// =============================================================================
+
+#include <benchmark/benchmark.h>
+
+#include "chrono/physics/ChLoad.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Benchmarking fixture: a plate of ANCF shell elements, each with a stiff pressure load
+class PressureFixture : public ::benchmark::Fixture {
+  public:
+    void SetUp(const ::benchmark::State& st) override {
+        const int num_div = 10;
+        const double length = 1.0;
+        const double dx = length / num_div;
+
+        sys = new ChSystemSMC();
+        auto mesh = chrono_types::make_shared<ChMesh>();
+        auto material = chrono_types::make_shared<ChMaterialShellANCF>(1000, 1e7, 0.3);
+
+        std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+        for (int j = 0; j <= num_div; j++) {
+            for (int i = 0; i <= num_div; i++) {
+                // Slightly curved plate, so that the normals vary over the surface
+                double x = i * dx;
+                double y = j * dx;
+                auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(x, y, 0.1 * x * x), ChVector<>(0, 0, 1));
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+
+        for (int j = 0; j < num_div; j++) {
+            for (int i = 0; i < num_div; i++) {
+                int n0 = j * (num_div + 1) + i;
+                auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+                element->SetNodes(nodes[n0], nodes[n0 + 1], nodes[n0 + num_div + 2], nodes[n0 + num_div + 1]);
+                element->SetDimensions(dx, dx);
+                element->AddLayer(0.01, 0, material);
+                mesh->AddElement(element);
+
+                auto load = chrono_types::make_shared<ChLoad<ChLoaderPressure>>(element);
+                load->loader.SetPressure(1e4);
+                load->loader.SetIntegrationPoints(2);
+                load->loader.SetStiff(true);
+                load->CreateJacobianMatrices();
+                loads.push_back(load);
+            }
+        }
+
+        sys->Add(mesh);
+        sys->Update();
+
+        state_x = new ChState(24, nullptr);
+        state_w = new ChStateDelta(24, nullptr);
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        delete state_x;
+        delete state_w;
+        loads.clear();
+        delete sys;
+    }
+
+    ChSystemSMC* sys;
+    std::vector<std::shared_ptr<ChLoad<ChLoaderPressure>>> loads;
+    ChState* state_x;
+    ChStateDelta* state_w;
+};
+
+BENCHMARK_DEFINE_F(PressureFixture, FD)(benchmark::State& st) {
+    for (auto _ : st) {
+        for (auto& load : loads) {
+            load->LoadGetStateBlock_x(*state_x);
+            load->LoadGetStateBlock_w(*state_w);
+            load->ComputeJacobianFD(state_x, state_w);
+        }
+    }
+    st.SetItemsProcessed(st.iterations() * loads.size());
+}
+BENCHMARK_REGISTER_F(PressureFixture, FD)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_DEFINE_F(PressureFixture, AD)(benchmark::State& st) {
+    for (auto _ : st) {
+        for (auto& load : loads) {
+            load->LoadGetStateBlock_x(*state_x);
+            load->LoadGetStateBlock_w(*state_w);
+            load->ComputeJacobianAD(state_x, state_w);
+        }
+    }
+    st.SetItemsProcessed(st.iterations() * loads.size());
+}
+BENCHMARK_REGISTER_F(PressureFixture, AD)->Unit(benchmark::kMicrosecond);
@@ -13,6 +13,8 @@
 // =============================================================================
 //
 // Chrono::Multicore benchmark program using SMC method for frictional contact.
+// The NSC variants compare the double-precision and mixed-precision storage of the
+// constraint Jacobian blocks used in the Shur product.
 //
 // The global reference frame has Z up.
 // =============================================================================
@@ -38,6 +40,58 @@
 
 using namespace chrono;
 
+// Create a bin with granular material in layers. Return the number of particles.
+static unsigned int CreateBed(ChSystemMulticore* sys, std::shared_ptr<ChMaterialSurface> mat) {
+    // Container half-dimensions
+    ChVector<> hdim(2, 2, 0.5);
+    double hthick = 0.1;
+
+    // Create a bin consisting of five boxes attached to the ground.
+    auto bin = std::shared_ptr<ChBody>(sys->NewBody());
+    bin->SetMass(1);
+    bin->SetPos(ChVector<>(0, 0, 0));
+    bin->SetCollide(true);
+    bin->SetBodyFixed(true);
+
+    bin->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hdim.y(), hthick), ChVector<>(0, 0, -hthick));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
+                          ChVector<>(-hdim.x() - hthick, 0, hdim.z()));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
+                          ChVector<>(hdim.x() + hthick, 0, hdim.z()));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
+                          ChVector<>(0, -hdim.y() - hthick, hdim.z()));
+    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
+                          ChVector<>(0, hdim.y() + hthick, hdim.z()));
+    bin->GetCollisionModel()->BuildModel();
+
+    sys->AddBody(bin);
+
+    // Create granular material in layers
+    double rho = 2000;
+    double radius = 0.02;
+    int num_layers = 8;
+
+    // Create a particle generator and a mixture entirely made out of spheres
+    double r = 1.01 * radius;
+    utils::PDSampler<double> sampler(2 * r);
+    utils::Generator gen(sys);
+    std::shared_ptr<utils::MixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->setDefaultMaterial(mat);
+    m1->setDefaultDensity(rho);
+    m1->setDefaultSize(radius);
+
+    // Create particles in layers until reaching the desired number of particles
+    ChVector<> range(hdim.x() - r, hdim.y() - r, 0);
+    ChVector<> center(0, 0, 2 * r);
+    for (int il = 0; il < num_layers; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+
+    return gen.getTotalNumBodies();
+}
+
 class SettlingSMC : public utils::ChBenchmarkTest {
   public:
     SettlingSMC();
@@ -88,54 +142,7 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     mat->SetRestitution(cr);
     mat->SetAdhesion(0);
 
-    // Container half-dimensions
-    ChVector<> hdim(2, 2, 0.5);
-    double hthick = 0.1;
-
-    // Create a bin consisting of five boxes attached to the ground.
-    auto bin = std::shared_ptr<ChBody>(m_system->NewBody());
-    bin->SetMass(1);
-    bin->SetPos(ChVector<>(0, 0, 0));
-    bin->SetCollide(true);
-    bin->SetBodyFixed(true);
-
-    bin->GetCollisionModel()->ClearModel();
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hdim.y(), hthick), ChVector<>(0, 0, -hthick));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
-                          ChVector<>(-hdim.x() - hthick, 0, hdim.z()));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hthick, hdim.y(), hdim.z()),
-                          ChVector<>(hdim.x() + hthick, 0, hdim.z()));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
-                          ChVector<>(0, -hdim.y() - hthick, hdim.z()));
-    utils::AddBoxGeometry(bin.get(), mat, ChVector<>(hdim.x(), hthick, hdim.z()),
-                          ChVector<>(0, hdim.y() + hthick, hdim.z()));
-    bin->GetCollisionModel()->BuildModel();
-
-    m_system->AddBody(bin);
-
-    // Create granular material in layers
-    double rho = 2000;
-    double radius = 0.02;
-    int num_layers = 8;
-
-    // Create a particle generator and a mixture entirely made out of spheres
-    double r = 1.01 * radius;
-    utils::PDSampler<double> sampler(2 * r);
-    utils::Generator gen(m_system);
-    std::shared_ptr<utils::MixtureIngredient> m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
-    m1->setDefaultMaterial(mat);
-    m1->setDefaultDensity(rho);
-    m1->setDefaultSize(radius);
-
-    // Create particles in layers until reaching the desired number of particles
-    ChVector<> range(hdim.x() - r, hdim.y() - r, 0);
-    ChVector<> center(0, 0, 2 * r);
-    for (int il = 0; il < num_layers; il++) {
-        gen.CreateObjectsBox(sampler, center, range);
-        center.z() += 2 * r;
-    }
-
-    m_num_particles = gen.getTotalNumBodies();
+    m_num_particles = CreateBed(m_system, mat);
 }
 
 // Run settling simulation with visualization
@@ -159,6 +166,62 @@ void SettlingSMC::SimulateVis() {
 
 // =============================================================================
 
+template <bool MIXED>
+class SettlingNSC : public utils::ChBenchmarkTest {
+  public:
+    SettlingNSC();
+    ~SettlingNSC() { delete m_system; }
+
+    void SetNumthreads(int nthreads) { m_system->SetNumThreads(nthreads); }
+    unsigned int GetNumParticles() const { return m_num_particles; }
+
+    /// Memory footprint (in MB) of the Jacobian blocks traversed in each Shur product.
+    double GetJacobianMemory() const;
+
+    virtual ChSystem* GetSystem() override { return m_system; }
+    virtual void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemMulticoreNSC* m_system;
+    double m_step;
+    unsigned int m_num_particles;
+};
+
+template <bool MIXED>
+SettlingNSC<MIXED>::SettlingNSC() : m_system(new ChSystemMulticoreNSC), m_step(1e-3) {
+    m_system->Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    m_system->GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    m_system->GetSettings()->solver.max_iteration_normal = 0;
+    m_system->GetSettings()->solver.max_iteration_sliding = 100;
+    m_system->GetSettings()->solver.max_iteration_spinning = 0;
+    m_system->GetSettings()->solver.max_iteration_bilateral = 0;
+    m_system->GetSettings()->solver.tolerance = 1e-3;
+    m_system->GetSettings()->solver.alpha = 0;
+    m_system->GetSettings()->solver.contact_recovery_speed = 1e4;
+    m_system->GetSettings()->solver.use_mixed_precision = MIXED;
+    m_system->ChangeSolverType(SolverType::APGD);
+
+    m_system->GetSettings()->collision.narrowphase_algorithm = collision::ChNarrowphase::Algorithm::HYBRID;
+    m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    m_num_particles = CreateBed(m_system, mat);
+}
+
+template <bool MIXED>
+double SettlingNSC<MIXED>::GetJacobianMemory() const {
+    const auto& data = m_system->data_manager->host_data;
+    size_t nnz = MIXED ? data.D_T_sp.nonZeros() + data.M_invD_sp.nonZeros()
+                       : data.D_T.nonZeros() + data.M_invD.nonZeros();
+    size_t value_size = MIXED ? sizeof(float) : sizeof(real);
+    return nnz * (value_size + sizeof(size_t)) / (1024.0 * 1024.0);
+}
+
+// =============================================================================
+
 #define NUM_SKIP_STEPS 500  // number of steps for hot start
 #define NUM_SIM_STEPS 500   // number of simulation steps for benchmarking
 
@@ -182,6 +245,28 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+#define NSC_BENCHMARK(NAME, MIXED)                                                  \
+    using NAME = chrono::utils::ChBenchmarkFixture<SettlingNSC<MIXED>, 0>;         \
+    BENCHMARK_DEFINE_F(NAME, Settle)(benchmark::State & st) {                      \
+        Reset(NUM_SKIP_STEPS);                                                     \
+        m_test->SetNumthreads((int)st.range(0));                                   \
+        while (st.KeepRunning()) {                                                 \
+            m_test->Simulate(NUM_SIM_STEPS);                                       \
+        }                                                                          \
+        Report(st);                                                                \
+        st.counters["Jacobian_MB"] = m_test->GetJacobianMemory();                  \
+        st.counters["Num_contacts"] = m_test->GetSystem()->GetNcontacts();         \
+    }                                                                              \
+    BENCHMARK_REGISTER_F(NAME, Settle)                                             \
+        ->Unit(benchmark::kMillisecond)                                            \
+        ->Iterations(1)                                                            \
+        ->Repetitions(1)                                                           \
+        ->UseRealTime()                                                            \
+        ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
+NSC_BENCHMARK(NSC_DOUBLE, false)
+NSC_BENCHMARK(NSC_MIXED, true)
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Throughput of the CPU ray casting backend for a 32-channel spinning lidar
+// (360 deg, 0.2 deg horizontal resolution) scanning at 10 Hz. The scene has a
+// terrain mesh, a ground box, and a few hundred boxes, spheres, and cylinders.
+// Rays are generated like in ChFilterCPURender and distributed over a
+// ChCPUWorkerPool.
+//
+// Usage: btest_SEN_cpu_lidar [num_threads (8)] [num_scans (50)]
+//
+// =============================================================================
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "chrono/assets/ChBoxShape.h"
+#include "chrono/assets/ChCylinderShape.h"
+#include "chrono/assets/ChSphereShape.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_sensor/cpu/ChCPURayScene.h"
+#include "chrono_sensor/cpu/ChCPUWorkerPool.h"
+
+using namespace chrono;
+using namespace chrono::sensor;
+
+const int num_channels = 32;
+const int num_samples = 1800;
+const float max_vert_angle = (float)(15 * CH_C_DEG_TO_RAD);
+const float min_vert_angle = (float)(-25 * CH_C_DEG_TO_RAD);
+const double max_distance = 100;
+const double scan_rate = 10;
+
+static void AddShape(ChSystem& sys, std::shared_ptr<ChVisualShape> shape, const ChVector<>& pos) {
+    shape->SetMutable(false);
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetBodyFixed(true);
+    body->SetPos(pos);
+    body->AddVisualShape(shape);
+    sys.AddBody(body);
+}
+
+// Height field terrain mesh with n x n cells of the given size
+static std::shared_ptr<ChTriangleMeshShape> TerrainMesh(int n, double size) {
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    auto& vertices = trimesh->getCoordsVertices();
+    auto& indices = trimesh->getIndicesVertexes();
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            double x = (i - n / 2.0) * size;
+            double y = (j - n / 2.0) * size;
+            vertices.push_back(ChVector<>(x, y, 0.2 * std::sin(0.3 * x) * std::cos(0.2 * y)));
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v = i * (n + 1) + j;
+            indices.push_back(ChVector<int>(v, v + n + 1, v + n + 2));
+            indices.push_back(ChVector<int>(v, v + n + 2, v + 1));
+        }
+    }
+    auto shape = chrono_types::make_shared<ChTriangleMeshShape>();
+    shape->SetMesh(trimesh);
+    return shape;
+}
+
+int main(int argc, char* argv[]) {
+    int num_threads = argc > 1 ? std::atoi(argv[1]) : 8;
+    int num_scans = argc > 2 ? std::atoi(argv[2]) : 50;
+
+    ChSystemNSC sys;
+    AddShape(sys, TerrainMesh(200, 1.0), ChVector<>(0, 0, 0));
+    AddShape(sys, chrono_types::make_shared<ChBoxShape>(300, 300, 1), ChVector<>(0, 0, -1));
+    for (int i = 0; i < 200; i++) {
+        ChVector<> pos(ChRandom() * 160 - 80, ChRandom() * 160 - 80, 1);
+        if (i % 3 == 0)
+            AddShape(sys, chrono_types::make_shared<ChBoxShape>(2, 4, 2), pos);
+        else if (i % 3 == 1)
+            AddShape(sys, chrono_types::make_shared<ChSphereShape>(1), pos);
+        else
+            AddShape(sys, chrono_types::make_shared<ChCylinderShape>(0.3, 4), pos);
+    }
+
+    ChCPURayScene scene(&sys);
+    scene.Construct();
+    ChCPUWorkerPool pool(num_threads);
+
+    std::vector<float> ranges(num_channels * num_samples);
+    const ChVector<> origin(0, 0, 2);
+    const float hfov = (float)CH_C_2PI;
+
+    // one scan: lidar rays in the sensor frame (x forward, z up), rotating with the scan index
+    auto scan = [&](int k) {
+        double yaw = k * 0.1;
+        scene.Update();
+        pool.ParallelFor(num_channels, [&](unsigned int y) {
+            float phi = (y / (float)(num_channels - 1)) * (max_vert_angle - min_vert_angle) + min_vert_angle;
+            for (int x = 0; x < num_samples; x++) {
+                double theta = yaw + (x / (float)(num_samples - 1)) * hfov - hfov / 2;
+                ChVector<> dir(std::cos(phi) * std::cos(theta), std::cos(phi) * std::sin(theta), std::sin(phi));
+                ChCPURayScene::Hit hit;
+                bool found = scene.Intersect(origin, dir, 1e-3, max_distance, hit);
+                ranges[y * num_samples + x] = found ? (float)hit.distance : 0;
+            }
+        });
+    };
+
+    // warm up, then time the scans
+    scan(0);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int k = 1; k <= num_scans; k++)
+        scan(k);
+    auto end = std::chrono::high_resolution_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+
+    int hits = 0;
+    for (auto r : ranges)
+        hits += r > 0;
+
+    double scans_per_second = num_scans / elapsed;
+    double rays_per_scan = num_channels * num_samples;
+    std::cout << "Shape instances:   " << scene.GetNumInstances() << "\n";
+    std::cout << "Threads:           " << pool.GetNumThreads() << "\n";
+    std::cout << "Rays per scan:     " << rays_per_scan << " (" << hits << " hits in last scan)\n";
+    std::cout << "Time per scan:     " << 1e3 * elapsed / num_scans << " ms\n";
+    std::cout << "Throughput:        " << scans_per_second * rays_per_scan / 1e6 << " Mrays/s, " << scans_per_second
+              << " scans/s\n";
+    std::cout << "Real-time factor:  " << scans_per_second / scan_rate << " (at " << scan_rate << " Hz)\n";
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Benchmark test for track shoe - track wheel contact on the M113 (single- and
+// double-pin track shoes): analytic contact (ChTrackAssembly::
+// EnableAnalyticWheelContact) versus generic collision detection between the
+// wheel and shoe collision geometry.
+//
+// Before running the benchmarks, the two contact paths are compared on the
+// same maneuver (settle, then accelerate on flat ground) and the final
+// chassis states and run times are reported.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "chrono/ChConfig.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_models/vehicle/m113/M113.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::m113;
+
+// =============================================================================
+
+template <TrackShoeType SHOE_TYPE, bool ANALYTIC>
+class M113WheelContactTest : public utils::ChBenchmarkTest {
+  public:
+    M113WheelContactTest();
+    ~M113WheelContactTest();
+
+    ChSystem* GetSystem() override { return m_m113->GetSystem(); }
+    void ExecuteStep() override;
+
+    const ChVector<>& GetChassisPos() const { return m_m113->GetChassisBody()->GetPos(); }
+    double GetChassisSpeed() const { return m_m113->GetVehicle().GetSpeed(); }
+    int GetNumContacts() const { return m_m113->GetSystem()->GetNcontacts(); }
+
+  private:
+    M113* m_m113;
+    RigidTerrain* m_terrain;
+
+    TerrainForces m_shoeL;
+    TerrainForces m_shoeR;
+
+    double m_step;
+};
+
+template <TrackShoeType SHOE_TYPE, bool ANALYTIC>
+M113WheelContactTest<SHOE_TYPE, ANALYTIC>::M113WheelContactTest() : m_step(1e-3) {
+    // Create the M113 vehicle, set parameters, and initialize.
+    m_m113 = new M113();
+    m_m113->SetContactMethod(ChContactMethod::NSC);
+    m_m113->SetTrackShoeType(SHOE_TYPE);
+    m_m113->SetDrivelineType(DrivelineTypeTV::SIMPLE);
+    m_m113->SetBrakeType(BrakeType::SIMPLE);
+    m_m113->SetPowertrainType(PowertrainModelType::SIMPLE);
+    m_m113->SetChassisCollisionType(CollisionType::NONE);
+    m_m113->SetAnalyticWheelContact(ANALYTIC);
+
+    m_m113->SetInitPosition(ChCoordsys<>(ChVector<>(0, 0, 1.1), QUNIT));
+    m_m113->Initialize();
+
+    // Create the terrain
+    m_terrain = new RigidTerrain(m_m113->GetSystem());
+    auto patch_material = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    patch_material->SetFriction(0.9f);
+    patch_material->SetRestitution(0.01f);
+    m_terrain->AddPatch(patch_material, CSYSNORM, 200, 10);
+    m_terrain->Initialize();
+
+    // Solver settings
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(50);
+    solver->SetOmega(0.8);
+    solver->SetSharpnessLambda(1.0);
+    m_m113->GetSystem()->SetSolver(solver);
+
+    m_m113->GetSystem()->SetMaxPenetrationRecoverySpeed(1.5);
+    m_m113->GetSystem()->SetMinBounceSpeed(2.0);
+
+    m_shoeL.resize(m_m113->GetVehicle().GetNumTrackShoes(LEFT));
+    m_shoeR.resize(m_m113->GetVehicle().GetNumTrackShoes(RIGHT));
+}
+
+template <TrackShoeType SHOE_TYPE, bool ANALYTIC>
+M113WheelContactTest<SHOE_TYPE, ANALYTIC>::~M113WheelContactTest() {
+    delete m_m113;
+    delete m_terrain;
+}
+
+template <TrackShoeType SHOE_TYPE, bool ANALYTIC>
+void M113WheelContactTest<SHOE_TYPE, ANALYTIC>::ExecuteStep() {
+    double time = m_m113->GetVehicle().GetChTime();
+
+    // Settle, then accelerate
+    DriverInputs driver_inputs = {0, 0, 0};
+    driver_inputs.m_throttle = time < 0.5 ? 0 : std::min(1.0, 2 * (time - 0.5));
+
+    m_terrain->Synchronize(time);
+    m_m113->Synchronize(time, driver_inputs, m_shoeL, m_shoeR);
+
+    m_terrain->Advance(m_step);
+    m_m113->Advance(m_step);
+}
+
+// =============================================================================
+
+// Run the same maneuver with generic and analytic shoe-wheel contact and report the final states and run times.
+template <TrackShoeType SHOE_TYPE, bool ANALYTIC>
+static void RunComparison(const char* name, int num_steps) {
+    M113WheelContactTest<SHOE_TYPE, ANALYTIC> test;
+
+    double timer = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < num_steps; i++) {
+        test.ExecuteStep();
+        timer += test.GetSystem()->GetTimerCollision();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double elapsed = std::chrono::duration<double>(end - start).count();
+
+    const auto& pos = test.GetChassisPos();
+    printf("%-22s  x = %8.4f  z = %8.4f  speed = %7.4f  contacts = %5d  time = %7.3f s  (collision %7.3f s)\n", name,
+           pos.x(), pos.z(), test.GetChassisSpeed(), test.GetNumContacts(), elapsed, timer);
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 1000  // number of steps for hot start
+#define NUM_SIM_STEPS 1000   // number of simulation steps for each benchmark
+#define REPEATS 10
+
+// NOTE: trick to prevent erros in expanding macros due to types that contain a comma.
+typedef M113WheelContactTest<TrackShoeType::SINGLE_PIN, false> sp_generic_test_type;
+typedef M113WheelContactTest<TrackShoeType::SINGLE_PIN, true> sp_analytic_test_type;
+typedef M113WheelContactTest<TrackShoeType::DOUBLE_PIN, false> dp_generic_test_type;
+typedef M113WheelContactTest<TrackShoeType::DOUBLE_PIN, true> dp_analytic_test_type;
+
+CH_BM_SIMULATION_LOOP(M113WheelContact_SP_generic, sp_generic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113WheelContact_SP_analytic, sp_analytic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113WheelContact_DP_generic, dp_generic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_LOOP(M113WheelContact_DP_analytic, dp_analytic_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+
+    int num_steps = 3000;
+    printf("Chassis state after %g s (settle, then accelerate):\n", num_steps * 1e-3);
+    RunComparison<TrackShoeType::SINGLE_PIN, false>("single-pin, generic", num_steps);
+    RunComparison<TrackShoeType::SINGLE_PIN, true>("single-pin, analytic", num_steps);
+    RunComparison<TrackShoeType::DOUBLE_PIN, false>("double-pin, generic", num_steps);
+    RunComparison<TrackShoeType::DOUBLE_PIN, true>("double-pin, analytic", num_steps);
+    printf("\n");
+
+    ::benchmark::RunSpecifiedBenchmarks();
+}
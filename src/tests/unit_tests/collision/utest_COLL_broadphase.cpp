@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2022 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the broadphase grids of the Chrono collision system.
+// For a polydisperse mix of spheres and boxes in a container, the contacts
+// found with a hierarchical (multi-level) grid must match those found with a
+// single uniform grid. Ray intersection tests must also give the same results.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+struct ContactData {
+    ChVector<> pA;
+    ChVector<> pB;
+    double distance;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, distance});
+        return true;
+    }
+    std::vector<ContactData> contacts;
+};
+
+// Create a system with a container and a polydisperse mix of spheres and boxes (sizes over two orders of magnitude).
+// Bodies in family 2 do not collide with each other.
+static std::shared_ptr<ChSystemNSC> CreateSystem(bool multi_level) {
+    auto sys = chrono_types::make_shared<ChSystemNSC>();
+    sys->SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto coll_sys = std::static_pointer_cast<ChCollisionSystemChrono>(sys->GetCollisionSystem());
+    coll_sys->SetEnvelope(0.01);
+    if (multi_level)
+        coll_sys->SetBroadphaseMultiLevelGrid(2);
+    else
+        coll_sys->SetBroadphaseGridDensity(5);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto container = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+    container->SetBodyFixed(true);
+    container->GetCollisionModel()->ClearModel();
+    container->GetCollisionModel()->AddBox(mat, 5, 5, 0.1, ChVector<>(0, 0, -0.1));
+    container->GetCollisionModel()->AddBox(mat, 0.1, 5, 2, ChVector<>(-5.1, 0, 2));
+    container->GetCollisionModel()->AddBox(mat, 0.1, 5, 2, ChVector<>(+5.1, 0, 2));
+    container->GetCollisionModel()->BuildModel();
+    container->SetCollide(true);
+    sys->AddBody(container);
+
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> unif(0, 1);
+    for (int i = 0; i < 800; i++) {
+        double size = 0.02 * std::pow(50.0, unif(gen) * unif(gen));
+        ChVector<> pos(10 * unif(gen) - 5, 10 * unif(gen) - 5, 2 * unif(gen));
+
+        auto body = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+        body->SetPos(pos);
+        body->SetRot(Q_from_AngZ(unif(gen)));
+        body->SetBodyFixed(i % 10 == 0);
+        body->GetCollisionModel()->ClearModel();
+        if (i % 2 == 0)
+            body->GetCollisionModel()->AddSphere(mat, size);
+        else
+            body->GetCollisionModel()->AddBox(mat, size, 0.5 * size, 0.8 * size);
+        body->GetCollisionModel()->BuildModel();
+        body->SetCollide(true);
+        if (i % 7 == 0) {
+            body->GetCollisionModel()->SetFamily(2);
+            body->GetCollisionModel()->SetFamilyMaskNoCollisionWithFamily(2);
+        }
+        sys->AddBody(body);
+    }
+
+    return sys;
+}
+
+static std::vector<ContactData> GetContacts(ChSystemNSC& sys) {
+    sys.DoStepDynamics(1e-3);
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    auto& contacts = collector->contacts;
+    std::sort(contacts.begin(), contacts.end(), [](const ContactData& a, const ContactData& b) {
+        if (a.pA.x() != b.pA.x())
+            return a.pA.x() < b.pA.x();
+        if (a.pA.y() != b.pA.y())
+            return a.pA.y() < b.pA.y();
+        if (a.pA.z() != b.pA.z())
+            return a.pA.z() < b.pA.z();
+        return a.pB.x() < b.pB.x();
+    });
+    return contacts;
+}
+
+TEST(ChBroadphase, multi_level_contacts) {
+    auto sys1 = CreateSystem(false);
+    auto sys2 = CreateSystem(true);
+
+    auto ref = GetContacts(*sys1);
+    auto contacts = GetContacts(*sys2);
+
+    ASSERT_GT(ref.size(), 200u);
+    ASSERT_EQ(contacts.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_NEAR((contacts[i].pA - ref[i].pA).Length(), 0.0, 1e-12);
+        ASSERT_NEAR((contacts[i].pB - ref[i].pB).Length(), 0.0, 1e-12);
+        ASSERT_NEAR(contacts[i].distance, ref[i].distance, 1e-12);
+    }
+}
+
+TEST(ChBroadphase, multi_level_ray_test) {
+    auto sys1 = CreateSystem(false);
+    auto sys2 = CreateSystem(true);
+    sys1->DoStepDynamics(1e-3);
+    sys2->DoStepDynamics(1e-3);
+
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<double> unif(-5, 5);
+    int num_hits = 0;
+    for (int i = 0; i < 50; i++) {
+        ChVector<> from(unif(gen), unif(gen), 6);
+        ChVector<> to(unif(gen), unif(gen), -1);
+        ChCollisionSystem::ChRayhitResult ref;
+        ChCollisionSystem::ChRayhitResult result;
+        sys1->GetCollisionSystem()->RayHit(from, to, ref);
+        sys2->GetCollisionSystem()->RayHit(from, to, result);
+        ASSERT_EQ(result.hit, ref.hit);
+        if (ref.hit) {
+            ASSERT_NEAR((result.abs_hitPoint - ref.abs_hitPoint).Length(), 0.0, 1e-12);
+            num_hits++;
+        }
+    }
+    ASSERT_GT(num_hits, 0);
+}
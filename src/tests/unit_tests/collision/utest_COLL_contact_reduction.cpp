@@ -0,0 +1,214 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for contact reduction (ChContactReduction).
+// - reduction of synthetic contact patches: deepest and extremal contacts are
+//   kept, weights account for all contacts, patches with different normals
+//   and different pairs are reduced separately
+// - a plate of spheres resting on the ground: fewer contacts with reduction,
+//   same resting height (for SMC, the contact weights preserve the stiffness)
+//
+// =============================================================================
+
+#include "chrono/collision/ChContactReduction.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Grid of n x n contacts in the plane z = 0, with normal along z, deepest at (i_deep, j_deep)
+static void AddGrid(ChContactReduction& reduction,
+                    ChCollisionModel* modelA,
+                    ChCollisionModel* modelB,
+                    int n,
+                    int i_deep,
+                    int j_deep) {
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ChCollisionInfo cinfo;
+            cinfo.modelA = modelA;
+            cinfo.modelB = modelB;
+            cinfo.vN = ChVector<>(0, 0, 1);
+            cinfo.vpA = ChVector<>(i, j, 0);
+            cinfo.vpB = ChVector<>(i, j, 0.01);
+            cinfo.distance = (i == i_deep && j == j_deep) ? -0.02 : -0.01;
+            reduction.Add(cinfo);
+        }
+    }
+}
+
+static double TotalWeight(const std::vector<ChCollisionInfo>& contacts) {
+    double weight = 0;
+    for (const auto& c : contacts)
+        weight += c.weight;
+    return weight;
+}
+
+TEST(ChContactReduction, patch) {
+    ChBody bodyA;
+    ChBody bodyB;
+    auto modelA = bodyA.GetCollisionModel().get();
+    auto modelB = bodyB.GetCollisionModel().get();
+
+    ChContactReduction reduction;
+    AddGrid(reduction, modelA, modelB, 10, 3, 4);
+
+    std::vector<ChCollisionInfo> contacts;
+    reduction.Reduce(contacts);
+    ASSERT_EQ(reduction.GetNumInputContacts(), 100);
+    ASSERT_EQ(reduction.GetNumOutputContacts(), 4);
+    ASSERT_EQ(contacts.size(), 4);
+
+    // Deepest contact first, then extremal contacts (on the boundary of the patch)
+    ASSERT_EQ(contacts[0].vpA, ChVector<>(3, 4, 0));
+    ASSERT_EQ(contacts[0].distance, -0.02);
+    for (int k = 1; k < 4; k++) {
+        const auto& p = contacts[k].vpA;
+        ASSERT_TRUE(p.x() == 0 || p.x() == 9 || p.y() == 0 || p.y() == 9);
+        ASSERT_GE(contacts[k].weight, 1.0);
+    }
+    ASSERT_DOUBLE_EQ(TotalWeight(contacts), 100.0);
+
+    // Collected contacts are cleared
+    reduction.Reduce(contacts);
+    ASSERT_EQ(contacts.size(), 0);
+
+    // A larger number of representative contacts
+    reduction.SetMaxContactsPerPatch(8);
+    AddGrid(reduction, modelA, modelB, 10, 3, 4);
+    reduction.Reduce(contacts);
+    ASSERT_EQ(contacts.size(), 8);
+    ASSERT_DOUBLE_EQ(TotalWeight(contacts), 100.0);
+}
+
+TEST(ChContactReduction, patches_and_pairs) {
+    ChBody bodyA;
+    ChBody bodyB;
+    ChBody bodyC;
+    auto modelA = bodyA.GetCollisionModel().get();
+    auto modelB = bodyB.GetCollisionModel().get();
+    auto modelC = bodyC.GetCollisionModel().get();
+
+    ChContactReduction reduction;
+    AddGrid(reduction, modelA, modelB, 5, 0, 0);
+
+    // Second patch of the same pair, with a normal at 45 degrees
+    for (int i = 0; i < 6; i++) {
+        ChCollisionInfo cinfo;
+        cinfo.modelA = modelA;
+        cinfo.modelB = modelB;
+        cinfo.vN = ChVector<>(1, 0, 1).GetNormalized();
+        cinfo.vpA = ChVector<>(10, i, 0);
+        cinfo.vpB = cinfo.vpA + 0.01 * cinfo.vN;
+        cinfo.distance = -0.01;
+        reduction.Add(cinfo);
+    }
+
+    // A different pair with few contacts (not reduced)
+    for (int i = 0; i < 3; i++) {
+        ChCollisionInfo cinfo;
+        cinfo.modelA = modelA;
+        cinfo.modelB = modelC;
+        cinfo.vpA = ChVector<>(0, 0, i);
+        cinfo.distance = -0.01 * i;
+        reduction.Add(cinfo);
+    }
+
+    std::vector<ChCollisionInfo> contacts;
+    reduction.Reduce(contacts);
+    ASSERT_EQ(reduction.GetNumInputContacts(), 25 + 6 + 3);
+    ASSERT_EQ(contacts.size(), 4 + 4 + 3);
+
+    // Pairs in order of first appearance, patches in order of first contact
+    for (int k = 0; k < 8; k++)
+        ASSERT_EQ(contacts[k].modelB, modelB);
+    ASSERT_EQ(contacts[0].vN, ChVector<>(0, 0, 1));
+    ASSERT_EQ(contacts[4].vN, ChVector<>(1, 0, 1).GetNormalized());
+    ASSERT_DOUBLE_EQ(TotalWeight(std::vector<ChCollisionInfo>(contacts.begin(), contacts.begin() + 4)), 25.0);
+    ASSERT_DOUBLE_EQ(TotalWeight(std::vector<ChCollisionInfo>(contacts.begin() + 4, contacts.begin() + 8)), 6.0);
+    for (int k = 8; k < 11; k++) {
+        ASSERT_EQ(contacts[k].modelB, modelC);
+        ASSERT_EQ(contacts[k].vpA, ChVector<>(0, 0, k - 8));
+        ASSERT_EQ(contacts[k].weight, 1.0);
+    }
+}
+
+// Plate made of 5 x 5 spheres, dropped on the ground.
+// Return the final height of the plate and the final number of contacts.
+static std::pair<double, int> DropPlate(ChSystem& sys, std::shared_ptr<ChMaterialSurface> mat, bool reduce) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    if (reduce)
+        sys.GetCollisionSystem()->SetContactReduction(chrono_types::make_shared<ChContactReduction>());
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.5));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    double radius = 0.1;
+    auto plate = chrono_types::make_shared<ChBody>();
+    plate->SetMass(10);
+    plate->SetInertiaXX(ChVector<>(0.5, 0.5, 1));
+    plate->SetPos(ChVector<>(0, 0, radius + 0.01));
+    plate->GetCollisionModel()->ClearModel();
+    for (int i = -2; i <= 2; i++)
+        for (int j = -2; j <= 2; j++)
+            plate->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(i * 0.3, j * 0.3, 0));
+    plate->GetCollisionModel()->BuildModel();
+    plate->SetCollide(true);
+    sys.AddBody(plate);
+
+    while (sys.GetChTime() < 0.5)
+        sys.DoStepDynamics(1e-4);
+
+    return std::make_pair(plate->GetPos().z(), sys.GetNcontacts());
+}
+
+TEST(ChContactReduction, plate_nsc) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    ChSystemNSC sys_ref;
+    auto ref = DropPlate(sys_ref, mat, false);
+
+    ChSystemNSC sys;
+    auto res = DropPlate(sys, mat, true);
+
+    ASSERT_EQ(ref.second, 25);
+    ASSERT_EQ(res.second, 4);
+    ASSERT_NEAR(res.first, ref.first, 1e-3);
+}
+
+TEST(ChContactReduction, plate_smc) {
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetYoungModulus(1e6f);
+
+    ChSystemSMC sys_ref;
+    auto ref = DropPlate(sys_ref, mat, false);
+
+    ChSystemSMC sys;
+    auto res = DropPlate(sys, mat, true);
+
+    ASSERT_EQ(ref.second, 25);
+    ASSERT_EQ(res.second, 4);
+
+    // The contact weights preserve the total stiffness, and hence the penetration at rest
+    double penetration_ref = 0.1 - ref.first;
+    double penetration = 0.1 - res.first;
+    ASSERT_GT(penetration_ref, 0);
+    ASSERT_NEAR(penetration, penetration_ref, 0.05 * penetration_ref);
+}
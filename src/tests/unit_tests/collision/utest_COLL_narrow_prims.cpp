@@ -15,6 +15,9 @@
 // Chrono unit test for narrow phase type PRIMS collision detection
 // =============================================================================
 
+#include <memory>
+#include <random>
+
 #include "chrono/collision/chrono/ChNarrowphase.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
 
@@ -1537,4 +1540,109 @@ TEST_P(Collision, roundedcyl_sphere) {
     delete shapeC;
 }
 
+// Batched kernels for sphere pairs must produce the same results as PRIMSCollision
+TEST_P(Collision, sphere_batches) {
+    real separation = sep ? 0.1 : 0.0;
+    const int n = 1000;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<real> unif(-1, 1);
+    auto rand3 = [&](real scale) { return real3(scale * unif(gen), scale * unif(gen), scale * unif(gen)); };
+    auto rand_rot = [&]() { return Normalize(quaternion(unif(gen), unif(gen), unif(gen), unif(gen))); };
+
+    using BatchType = ChNarrowphase::BatchType;
+    for (auto type : {BatchType::SPHERE_SPHERE, BatchType::BOX_SPHERE, BatchType::CAPSULE_SPHERE,
+                      BatchType::TRIANGLE_SPHERE}) {
+        std::vector<std::unique_ptr<ConvexBase>> shapes1;
+        std::vector<std::unique_ptr<ConvexBase>> shapes2;
+
+        ChNarrowphase::PairBatch batch;
+        batch.Resize(type, n);
+        for (int i = 0; i < n; i++) {
+            real3 pos = rand3(1);
+            quaternion rot = rand_rot();
+            real3 dims(0.3 + 0.2 * unif(gen), 0.4 + 0.2 * unif(gen), 0.5 + 0.2 * unif(gen));
+            batch.px[i] = pos.x;
+            batch.py[i] = pos.y;
+            batch.pz[i] = pos.z;
+            batch.dx[i] = dims.x;
+            switch (type) {
+                case BatchType::SPHERE_SPHERE:
+                    shapes1.emplace_back(new ConvexShapeCustom(ChCollisionShape::Type::SPHERE, pos, rot, dims));
+                    break;
+                case BatchType::BOX_SPHERE:
+                case BatchType::CAPSULE_SPHERE:
+                    shapes1.emplace_back(new ConvexShapeCustom(type == BatchType::BOX_SPHERE
+                                                                   ? ChCollisionShape::Type::BOX
+                                                                   : ChCollisionShape::Type::CAPSULE,
+                                                               pos, rot, dims));
+                    batch.qw[i] = rot.w;
+                    batch.qx[i] = rot.x;
+                    batch.qy[i] = rot.y;
+                    batch.qz[i] = rot.z;
+                    batch.dy[i] = dims.y;
+                    if (type == BatchType::BOX_SPHERE)
+                        batch.dz[i] = dims.z;
+                    break;
+                case BatchType::TRIANGLE_SPHERE: {
+                    real3 B = pos + rand3(1.5);
+                    real3 C = pos + rand3(1.5);
+                    shapes1.emplace_back(new ConvexShapeTriangle(pos, B, C));
+                    batch.bx[i] = B.x;
+                    batch.by[i] = B.y;
+                    batch.bz[i] = B.z;
+                    batch.cx[i] = C.x;
+                    batch.cy[i] = C.y;
+                    batch.cz[i] = C.z;
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            // Place the spheres near the triangles, so that these pairs also produce enough contacts
+            real3 center = rand3(1.5);
+            if (type == BatchType::TRIANGLE_SPHERE) {
+                const real3* tri = shapes1.back()->Triangles();
+                center = (tri[0] + tri[1] + tri[2]) / 3 + rand3(0.8);
+            }
+            real radius = 0.2 + 0.3 * (unif(gen) + 1);
+            shapes2.emplace_back(new ConvexShapeSphere(center, radius));
+            batch.sx[i] = center.x;
+            batch.sy[i] = center.y;
+            batch.sz[i] = center.z;
+            batch.r[i] = radius;
+        }
+
+        // Process the batch in two parts
+        ChNarrowphase::ProcessBatch(type, separation, batch, 0, n / 3);
+        ChNarrowphase::ProcessBatch(type, separation, batch, n / 3, n);
+
+        int num_contacts = 0;
+        for (int i = 0; i < n; i++) {
+            real3 norm;
+            real3 pt1;
+            real3 pt2;
+            real depth;
+            real eff_rad;
+            int nC;
+            ASSERT_TRUE(ChNarrowphase::PRIMSCollision(shapes1[i].get(), shapes2[i].get(), separation, &norm, &pt1, &pt2,
+                                                      &depth, &eff_rad, nC));
+            ASSERT_EQ((int)batch.active[i], nC) << "pair type " << (int)type << ", pair " << i;
+            if (nC == 0)
+                continue;
+            num_contacts++;
+            Assert_near(real3(batch.nx[i], batch.ny[i], batch.nz[i]), norm, precision);
+            Assert_near(real3(batch.p1x[i], batch.p1y[i], batch.p1z[i]), pt1, precision);
+            Assert_near(real3(batch.p2x[i], batch.p2y[i], batch.p2z[i]), pt2, precision);
+            ASSERT_NEAR(batch.depth[i], depth, precision);
+            ASSERT_NEAR(batch.eff_rad[i], eff_rad, precision);
+        }
+
+        // Make sure both outcomes are exercised
+        ASSERT_GT(num_contacts, n / 20) << "pair type " << (int)type;
+        ASSERT_LT(num_contacts, n) << "pair type " << (int)type;
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(R, Collision, ::testing::Bool());
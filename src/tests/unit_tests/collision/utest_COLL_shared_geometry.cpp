@@ -0,0 +1,341 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for shared (instanced) collision geometry.
+// Bodies using an instance of a shared convex hull must behave as bodies with
+// their own copy of the same convex hull. Contacts generated for instances of
+// shared geometry must be identical to those generated for per-body copies of
+// the same geometry.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <functional>
+
+#include "chrono/ChConfig.h"
+#include "chrono/collision/ChSharedCollisionGeometry.h"
+#include "chrono/core/ChGlobal.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+static std::vector<ChVector<>> CubePoints(double hdim) {
+    std::vector<ChVector<>> points;
+    for (int i = -1; i <= 1; i += 2)
+        for (int j = -1; j <= 1; j += 2)
+            for (int k = -1; k <= 1; k += 2)
+                points.push_back(ChVector<>(i * hdim, j * hdim, k * hdim));
+    return points;
+}
+
+// Drop boxes represented by convex hulls, either with their own copy of the hull or instancing a shared hull.
+// Envelope and safe margin are exactly representable as floats (collision models store them in single precision).
+static std::vector<ChVector<>> DropConvexHulls(bool shared) {
+    const double envelope = 0.03125;
+    const double safe_margin = 0.0078125;
+
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, true, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.5));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto points = CubePoints(0.5);
+    auto geometry = ChSharedCollisionGeometry::CreateConvexHull(points, envelope, safe_margin);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 4; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetMass(1);
+        body->SetPos(ChVector<>(2.0 * i, 0, 1));
+        body->GetCollisionModel()->ClearModel();
+        body->GetCollisionModel()->SetEnvelope(envelope);
+        body->GetCollisionModel()->SetSafeMargin(safe_margin);
+        if (shared)
+            body->GetCollisionModel()->AddSharedGeometry(mat, geometry);
+        else
+            body->GetCollisionModel()->AddConvexHull(mat, points);
+        body->GetCollisionModel()->BuildModel();
+        body->SetCollide(true);
+        sys.AddBody(body);
+        bodies.push_back(body);
+    }
+
+    while (sys.GetChTime() < 3.0)
+        sys.DoStepDynamics(1e-3);
+
+    std::vector<ChVector<>> pos;
+    for (const auto& body : bodies)
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+TEST(SharedCollisionGeometry, convex_hull_bullet) {
+    auto ref = DropConvexHulls(false);
+    auto pos = DropConvexHulls(true);
+
+    ASSERT_EQ(pos.size(), ref.size());
+    for (size_t i = 0; i < pos.size(); i++) {
+        ASSERT_NEAR((pos[i] - ref[i]).Length(), 0.0, 1e-6);
+        ASSERT_NEAR(pos[i].z(), 0.5, 1e-2);
+    }
+}
+
+TEST(SharedCollisionGeometry, triangle_mesh_bullet) {
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    // Triangle soup (off-center instances are not supported for connected meshes)
+    auto mesh = chrono_types::make_shared<geometry::ChTriangleMeshSoup>();
+    mesh->addTriangle(ChVector<>(-10, -10, 0), ChVector<>(10, -10, 0), ChVector<>(10, 10, 0));
+    mesh->addTriangle(ChVector<>(-10, -10, 0), ChVector<>(10, 10, 0), ChVector<>(-10, 10, 0));
+    auto geometry = ChSharedCollisionGeometry::CreateTriangleMesh(mesh, true, false);
+
+    // Two fixed bodies instancing the same static mesh at different heights
+    for (int i = 0; i < 2; i++) {
+        auto ground = chrono_types::make_shared<ChBody>();
+        ground->SetBodyFixed(true);
+        ground->GetCollisionModel()->ClearModel();
+        ground->GetCollisionModel()->AddSharedGeometry(mat, geometry, ChVector<>(i * 20.0, 0, -i * 1.0));
+        ground->GetCollisionModel()->BuildModel();
+        ground->SetCollide(true);
+        sys.AddBody(ground);
+    }
+
+    auto ball1 = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, true, true, mat);
+    ball1->SetPos(ChVector<>(0, 0, 1));
+    sys.AddBody(ball1);
+
+    auto ball2 = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, true, true, mat);
+    ball2->SetPos(ChVector<>(20, 0, 0));
+    sys.AddBody(ball2);
+
+    while (sys.GetChTime() < 1.0)
+        sys.DoStepDynamics(1e-3);
+
+    // Both balls rest on their mesh instance (up to the penetration allowed by the Bullet collision margins)
+    ASSERT_NEAR(ball1->GetPos().z(), 0.5, 0.05);
+    ASSERT_NEAR(ball2->GetPos().z(), -0.5, 0.05);
+    ASSERT_NEAR(ball1->GetPos().z() - ball2->GetPos().z(), 1.0, 1e-6);
+}
+
+// -----------------------------------------------------------------------------
+
+static std::shared_ptr<geometry::ChTriangleMeshConnected> PlaneMesh(int n, double size) {
+    auto mesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    for (int i = 0; i <= n; i++)
+        for (int j = 0; j <= n; j++)
+            mesh->getCoordsVertices().push_back(ChVector<>((i - n / 2.0) * size, (j - n / 2.0) * size, 0));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v = i * (n + 1) + j;
+            mesh->getIndicesVertexes().push_back(ChVector<int>(v, v + n + 1, v + n + 2));
+            mesh->getIndicesVertexes().push_back(ChVector<int>(v, v + n + 2, v + 1));
+        }
+    }
+    return mesh;
+}
+
+static std::shared_ptr<geometry::ChTriangleMeshSoup> ToSoup(const geometry::ChTriangleMesh& mesh) {
+    auto soup = chrono_types::make_shared<geometry::ChTriangleMeshSoup>();
+    for (int i = 0; i < mesh.getNumTriangles(); i++)
+        soup->addTriangle(mesh.getTriangle(i));
+    return soup;
+}
+
+// Contact data, in the order in which the contacts are reported
+struct ContactData {
+    ChVector<> pA;
+    ChVector<> pB;
+    ChVector<> normal;
+    double distance;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, pB, plane_coord.Get_A_Xaxis(), distance});
+        return true;
+    }
+    std::vector<ContactData> contacts;
+};
+
+// Collision model setup: either with an instance of shared geometry or with a per-body copy of the same geometry
+typedef std::function<void(ChCollisionModel* model, bool shared)> ModelSetup;
+
+// Create a fixed ground body and 4 moving bodies, run one step, and return the contacts sorted by position
+static std::vector<ContactData> RunContacts(ChCollisionSystemType type,
+                                            bool shared,
+                                            const ModelSetup& ground_setup,
+                                            const ModelSetup& body_setup) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(type);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto ground = chrono_types::make_shared<ChBody>(type);
+    ground->SetBodyFixed(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground_setup(ground->GetCollisionModel().get(), shared);
+    ground->GetCollisionModel()->BuildModel();
+    ground->SetCollide(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto body = chrono_types::make_shared<ChBody>(type);
+        body->SetMass(1);
+        body->SetPos(ChVector<>(3.0 * i - 6, 0.5 * i, 0));
+        body->SetRot(Q_from_AngZ(0.3 * i));
+        body->GetCollisionModel()->ClearModel();
+        body_setup(body->GetCollisionModel().get(), shared);
+        body->GetCollisionModel()->BuildModel();
+        body->SetCollide(true);
+        sys.AddBody(body);
+    }
+
+    sys.DoStepDynamics(1e-3);
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+
+    auto& contacts = collector->contacts;
+    std::sort(contacts.begin(), contacts.end(), [](const ContactData& a, const ContactData& b) {
+        if (a.pA.x() != b.pA.x())
+            return a.pA.x() < b.pA.x();
+        if (a.pA.y() != b.pA.y())
+            return a.pA.y() < b.pA.y();
+        return a.pA.z() < b.pA.z();
+    });
+    return contacts;
+}
+
+// Check that shared geometry and per-body geometry produce the same contacts
+static void CompareContacts(ChCollisionSystemType type, const ModelSetup& ground_setup, const ModelSetup& body_setup) {
+    auto ref = RunContacts(type, false, ground_setup, body_setup);
+    auto shr = RunContacts(type, true, ground_setup, body_setup);
+    ASSERT_GT(ref.size(), 0u);
+    ASSERT_EQ(shr.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ASSERT_NEAR((shr[i].pA - ref[i].pA).Length(), 0, 1e-6);
+        ASSERT_NEAR((shr[i].pB - ref[i].pB).Length(), 0, 1e-6);
+        ASSERT_NEAR((shr[i].normal - ref[i].normal).Length(), 0, 1e-6);
+        ASSERT_NEAR(shr[i].distance, ref[i].distance, 1e-6);
+    }
+}
+
+static std::shared_ptr<ChMaterialSurface> contact_mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+static void GroundBox(ChCollisionModel* model, bool shared) {
+    model->AddBox(contact_mat, 20, 20, 0.5, ChVector<>(0, 0, -0.5));
+}
+
+TEST(SharedCollisionGeometry, contacts_convex_hull) {
+    auto points = CubePoints(0.5);
+
+    std::vector<ChCollisionSystemType> types = {ChCollisionSystemType::BULLET};
+#ifdef CHRONO_COLLISION
+    types.push_back(ChCollisionSystemType::CHRONO);
+#endif
+
+    for (auto type : types) {
+        auto geometry = ChSharedCollisionGeometry::CreateConvexHull(points);
+        // hulls slightly penetrating the ground
+        ModelSetup hull = [&](ChCollisionModel* model, bool shared) {
+            ChVector<> pos(0, 0, 0.49);
+            if (shared)
+                model->AddSharedGeometry(contact_mat, geometry, pos);
+            else
+                model->AddConvexHull(contact_mat, points, pos);
+        };
+        CompareContacts(type, GroundBox, hull);
+    }
+}
+
+TEST(SharedCollisionGeometry, contacts_static_mesh_bullet) {
+    auto soup = ToSoup(*PlaneMesh(4, 10.0));
+    auto geometry = ChSharedCollisionGeometry::CreateTriangleMesh(soup, true, false);
+
+    // ground with two (off-center) instances of a static, non-connected mesh
+    ModelSetup ground = [&](ChCollisionModel* model, bool shared) {
+        for (int i = 0; i < 2; i++) {
+            ChVector<> pos(0.1 * i, 0, -0.05 * i);
+            if (shared)
+                model->AddSharedGeometry(contact_mat, geometry, pos);
+            else
+                model->AddTriangleMesh(contact_mat, soup, true, false, pos);
+        }
+    };
+    ModelSetup box = [&](ChCollisionModel* model, bool shared) {
+        model->AddBox(contact_mat, 0.5, 0.5, 0.5, ChVector<>(0, 0, 0.49));
+    };
+    CompareContacts(ChCollisionSystemType::BULLET, ground, box);
+}
+
+TEST(SharedCollisionGeometry, contacts_connected_mesh_bullet) {
+    auto mesh = PlaneMesh(4, 10.0);
+    double radius = 0.01;
+    auto geometry = ChSharedCollisionGeometry::CreateTriangleMesh(mesh, true, false, -1, -1, radius);
+
+    // ground with a connected mesh (triangle proxies with sphere-swept radius)
+    ModelSetup ground = [&](ChCollisionModel* model, bool shared) {
+        if (shared)
+            ASSERT_TRUE(model->AddSharedGeometry(contact_mat, geometry));
+        else
+            model->AddTriangleMesh(contact_mat, mesh, true, false, VNULL, ChMatrix33<>(1), radius);
+    };
+    ModelSetup sphere = [&](ChCollisionModel* model, bool shared) {
+        model->AddSphere(contact_mat, 0.5, ChVector<>(0, 0, 0.505));
+    };
+    CompareContacts(ChCollisionSystemType::BULLET, ground, sphere);
+
+    // connected meshes cannot be instanced off-center
+    ChBody body;
+    body.GetCollisionModel()->ClearModel();
+    ASSERT_FALSE(body.GetCollisionModel()->AddSharedGeometry(contact_mat, geometry, ChVector<>(1, 0, 0)));
+}
+
+TEST(SharedCollisionGeometry, contacts_concave_mesh_bullet) {
+    // moving, non-convex mesh (convex decomposition computed once for the shared geometry)
+    auto soup = ToSoup(*geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(
+        GetChronoDataFile("models/cube.obj"), false, false));
+    ASSERT_TRUE(soup->getNumTriangles() > 0);
+    auto geometry = ChSharedCollisionGeometry::CreateTriangleMesh(soup, false, false);
+
+    ModelSetup mesh = [&](ChCollisionModel* model, bool shared) {
+        ChVector<> pos(0, 0, 0.99);
+        if (shared)
+            model->AddSharedGeometry(contact_mat, geometry, pos);
+        else
+            model->AddTriangleMesh(contact_mat, soup, false, false, pos);
+    };
+    CompareContacts(ChCollisionSystemType::BULLET, GroundBox, mesh);
+}
@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for speculative contacts with the Chrono collision system.
+// A small, fast projectile (sphere or box) is shot at a thin wall with a step
+// size larger than the time needed to cross the wall. Without speculative
+// contacts, the projectile tunnels through the wall; with speculative contacts,
+// it is stopped in front of the wall.
+//
+// =============================================================================
+
+#include "chrono/collision/ChCollisionSystemChrono.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+const double wall_thickness = 0.02;
+const double size = 0.05;
+const double speed = 300;
+const double step = 1e-3;
+
+// Shoot the projectile at the wall (placed at x = 0) and return its final position and velocity along x.
+static std::pair<double, double> Shoot(ChCollisionShape::Type type,
+                                       ChNarrowphase::Algorithm algorithm,
+                                       bool speculative) {
+    ChSystemNSC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, 0));
+
+    auto coll_sys = chrono_types::make_shared<ChCollisionSystemChrono>();
+    coll_sys->SetNarrowphaseAlgorithm(algorithm);
+    coll_sys->EnableSpeculativeContacts(speculative);
+    sys.SetCollisionSystem(coll_sys);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetRestitution(0);
+
+    auto wall = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+    wall->SetBodyFixed(true);
+    wall->GetCollisionModel()->ClearModel();
+    wall->GetCollisionModel()->AddBox(mat, wall_thickness / 2, 1, 1);
+    wall->GetCollisionModel()->BuildModel();
+    wall->SetCollide(true);
+    sys.AddBody(wall);
+
+    auto projectile = chrono_types::make_shared<ChBody>(ChCollisionSystemType::CHRONO);
+    projectile->SetMass(0.1);
+    projectile->SetInertiaXX(ChVector<>(1e-4, 1e-4, 1e-4));
+    projectile->SetPos(ChVector<>(-1.05, 0, 0));
+    projectile->SetPos_dt(ChVector<>(speed, 0, 0));
+    projectile->GetCollisionModel()->ClearModel();
+    if (type == ChCollisionShape::Type::SPHERE)
+        projectile->GetCollisionModel()->AddSphere(mat, size);
+    else
+        projectile->GetCollisionModel()->AddBox(mat, size, size, size);
+    projectile->GetCollisionModel()->BuildModel();
+    projectile->SetCollide(true);
+    sys.AddBody(projectile);
+
+    while (sys.GetChTime() < 0.05)
+        sys.DoStepDynamics(step);
+
+    return std::make_pair(projectile->GetPos().x(), projectile->GetPos_dt().x());
+}
+
+static void Check(ChCollisionShape::Type type, ChNarrowphase::Algorithm algorithm) {
+    // The projectile travels 0.3 during a step and is never within the collision envelope of the wall
+    auto res_ref = Shoot(type, algorithm, false);
+    ASSERT_GT(res_ref.first, 1.0);
+    ASSERT_NEAR(res_ref.second, speed, 1e-6);
+
+    // With speculative contacts, the projectile stops in front of the wall
+    auto res = Shoot(type, algorithm, true);
+    ASSERT_LT(res.first, -wall_thickness / 2 - size + 0.01);
+    ASSERT_GT(res.first, -wall_thickness / 2 - size - 0.01);
+    ASSERT_NEAR(res.second, 0, 1e-3);
+}
+
+TEST(ChCollisionSystemChrono, speculative_sphere) {
+    Check(ChCollisionShape::Type::SPHERE, ChNarrowphase::Algorithm::HYBRID);
+}
+
+TEST(ChCollisionSystemChrono, speculative_box_prims) {
+    Check(ChCollisionShape::Type::BOX, ChNarrowphase::Algorithm::HYBRID);
+}
+
+TEST(ChCollisionSystemChrono, speculative_box_mpr) {
+    Check(ChCollisionShape::Type::BOX, ChNarrowphase::Algorithm::MPR);
+}
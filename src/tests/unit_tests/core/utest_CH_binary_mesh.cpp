@@ -0,0 +1,218 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for binary triangle mesh files and precomputed mesh connectivity.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/utils/ChAssetCache.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+// Output files in a directory in the system temporary directory
+static std::string TempDirectory(const std::string& name) {
+    const char* tmp = std::getenv("TMPDIR");
+    if (!tmp)
+        tmp = std::getenv("TEMP");
+    return std::string(tmp ? tmp : "/tmp") + "/" + name;
+}
+
+static const std::string out_dir = TempDirectory("chrono_utest_binary_mesh");
+
+static std::string OutputFile(const std::string& name) {
+    filesystem::create_directory(filesystem::path(out_dir));
+    return out_dir + "/" + name;
+}
+
+// Open grid of n x n quads (two triangles each), with normals and UVs
+static ChTriangleMeshConnected GridMesh(int n) {
+    ChTriangleMeshConnected mesh;
+    for (int i = 0; i <= n; i++) {
+        for (int j = 0; j <= n; j++) {
+            mesh.m_vertices.push_back(ChVector<>(i, j, 0.1 * i * j));
+            mesh.m_UV.push_back(ChVector2<>(i / (double)n, j / (double)n));
+        }
+    }
+    mesh.m_normals.push_back(ChVector<>(0, 0, 1));
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int v = i * (n + 1) + j;
+            mesh.m_face_v_indices.push_back(ChVector<int>(v, v + n + 1, v + n + 2));
+            mesh.m_face_v_indices.push_back(ChVector<int>(v, v + n + 2, v + 1));
+            mesh.m_face_n_indices.push_back(ChVector<int>(0, 0, 0));
+            mesh.m_face_n_indices.push_back(ChVector<int>(0, 0, 0));
+            mesh.m_face_uv_indices.push_back(ChVector<int>(v, v + n + 1, v + n + 2));
+            mesh.m_face_uv_indices.push_back(ChVector<int>(v, v + n + 2, v + 1));
+        }
+    }
+    mesh.m_filename = "grid.obj";
+    return mesh;
+}
+
+static void CheckConnectivity(const ChTriangleMeshConnected& mesh, const ChTriangleMeshConnected& ref) {
+    std::vector<std::array<int, 4>> tri_map;
+    std::vector<std::array<int, 4>> tri_map_ref;
+    ASSERT_EQ(mesh.ComputeNeighbouringTriangleMap(tri_map), ref.ComputeNeighbouringTriangleMap(tri_map_ref));
+    ASSERT_EQ(tri_map, tri_map_ref);
+
+    for (bool single_wing : {true, false}) {
+        std::map<std::pair<int, int>, std::pair<int, int>> edges;
+        std::map<std::pair<int, int>, std::pair<int, int>> edges_ref;
+        ASSERT_EQ(mesh.ComputeWingedEdges(edges, single_wing), ref.ComputeWingedEdges(edges_ref, single_wing));
+        ASSERT_EQ(edges, edges_ref);
+    }
+}
+
+TEST(ChTriangleMeshConnected, binary_round_trip) {
+    auto ref = GridMesh(10);
+    ASSERT_FALSE(ref.HasAdjacency());
+
+    auto mesh = ref;
+    mesh.ComputeAdjacency();
+    ASSERT_TRUE(mesh.HasAdjacency());
+    CheckConnectivity(mesh, ref);
+
+    std::string filename = OutputFile("grid.chmesh");
+    ASSERT_TRUE(mesh.WriteBinaryMesh(filename));
+
+    auto loaded = ChTriangleMeshConnected::CreateFromBinaryFile(filename);
+    ASSERT_TRUE(loaded != nullptr);
+    ASSERT_EQ(loaded->m_filename, ref.m_filename);
+    ASSERT_EQ(loaded->m_vertices.size(), ref.m_vertices.size());
+    for (size_t i = 0; i < ref.m_vertices.size(); i++) {
+        ASSERT_EQ(loaded->m_vertices[i], ref.m_vertices[i]);
+        ASSERT_EQ(loaded->m_UV[i].x(), ref.m_UV[i].x());
+        ASSERT_EQ(loaded->m_UV[i].y(), ref.m_UV[i].y());
+    }
+    ASSERT_EQ(loaded->m_normals.size(), 1);
+    ASSERT_EQ(loaded->m_face_v_indices, ref.m_face_v_indices);
+    ASSERT_EQ(loaded->m_face_n_indices, ref.m_face_n_indices);
+    ASSERT_EQ(loaded->m_face_uv_indices, ref.m_face_uv_indices);
+    ASSERT_TRUE(loaded->m_colors.empty());
+    ASSERT_TRUE(loaded->m_face_mat_indices.empty());
+
+    ASSERT_TRUE(loaded->HasAdjacency());
+    CheckConnectivity(*loaded, ref);
+
+    // Modifying the face indices invalidates the stored connectivity
+    std::swap(loaded->m_face_v_indices[0], loaded->m_face_v_indices[5]);
+    std::swap(ref.m_face_v_indices[0], ref.m_face_v_indices[5]);
+    ASSERT_FALSE(loaded->HasAdjacency());
+    CheckConnectivity(*loaded, ref);
+
+    // A mesh without connectivity data is written without it
+    ASSERT_TRUE(ref.WriteBinaryMesh(filename));
+    ASSERT_TRUE(loaded->LoadBinaryMesh(filename));
+    ASSERT_FALSE(loaded->HasAdjacency());
+    ASSERT_EQ(loaded->m_face_v_indices, ref.m_face_v_indices);
+
+    filesystem::path(filename).remove_file();
+    std::remove(out_dir.c_str());
+}
+
+TEST(ChTriangleMeshConnected, binary_invalid) {
+    auto mesh = GridMesh(4);
+    mesh.ComputeAdjacency();
+    std::string filename = OutputFile("invalid.chmesh");
+    ASSERT_TRUE(mesh.WriteBinaryMesh(filename));
+
+    std::string contents;
+    ASSERT_TRUE(utils::ChAssetCache::ReadFile(filename, contents));
+
+    ChTriangleMeshConnected loaded;
+
+    // Truncated file
+    {
+        std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+        ofs.write(contents.data(), contents.size() / 2);
+    }
+    ASSERT_FALSE(loaded.LoadBinaryMesh(filename));
+    ASSERT_EQ(loaded.getNumTriangles(), 0);
+    ASSERT_FALSE(loaded.HasAdjacency());
+
+    // Different format version
+    {
+        std::string modified = contents;
+        modified[8] = 99;
+        std::ofstream ofs(filename, std::ios::binary | std::ios::trunc);
+        ofs.write(modified.data(), modified.size());
+    }
+    ASSERT_FALSE(loaded.LoadBinaryMesh(filename));
+
+    // Not a binary mesh file
+    ASSERT_FALSE(loaded.LoadBinaryMesh(OutputFile("missing.chmesh")));
+
+    filesystem::path(filename).remove_file();
+    std::remove(out_dir.c_str());
+}
+
+TEST(ChTriangleMeshConnected, asset_cache_binary) {
+    std::string obj_file = OutputFile("cube.obj");
+    {
+        std::ofstream ofs(obj_file);
+        ofs << "v -1 -1 -1\nv 1 -1 -1\nv 1 1 -1\nv -1 1 -1\nv -1 -1 1\nv 1 -1 1\nv 1 1 1\nv -1 1 1\n"
+               "f 1 3 2\nf 1 4 3\nf 5 6 7\nf 5 7 8\nf 1 2 6\nf 1 6 5\nf 2 3 7\nf 2 7 6\nf 3 4 8\nf 3 8 7\n"
+               "f 4 1 5\nf 4 5 8\n";
+    }
+
+    // Expected name of the binary mesh file: asset key (content hash and load options) in hexadecimal
+    utils::ChAssetCache::Key key;
+    {
+        utils::ChAssetCache cache;
+        ASSERT_TRUE(cache.GetFileKey(obj_file, key));
+    }
+    key = utils::ChAssetCache::HashBytes("objn", 4, key);
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.chmesh", (unsigned long long)key);
+    std::string binary_file = out_dir + "/" + name;
+    filesystem::path(binary_file).remove_file();
+
+    // First run: parse the OBJ file and write the binary file
+    std::shared_ptr<const ChTriangleMeshConnected> mesh1;
+    {
+        utils::ChAssetCache cache;
+        cache.SetMeshCacheDirectory(out_dir);
+        mesh1 = cache.GetTriangleMesh(obj_file);
+        ASSERT_TRUE(mesh1 != nullptr);
+        ASSERT_TRUE(mesh1->HasAdjacency());
+        ASSERT_TRUE(filesystem::path(binary_file).exists());
+    }
+
+    // Second run: load the binary file
+    {
+        utils::ChAssetCache cache;
+        cache.SetMeshCacheDirectory(out_dir);
+        auto mesh2 = cache.GetTriangleMesh(obj_file);
+        ASSERT_TRUE(mesh2 != nullptr);
+        ASSERT_EQ(mesh2->m_filename, obj_file);
+        ASSERT_EQ(mesh2->m_vertices, mesh1->m_vertices);
+        ASSERT_EQ(mesh2->m_face_v_indices, mesh1->m_face_v_indices);
+        ASSERT_TRUE(mesh2->HasAdjacency());
+        CheckConnectivity(*mesh2, *mesh1);
+    }
+
+    filesystem::path(binary_file).remove_file();
+    filesystem::path(obj_file).remove_file();
+    std::remove(out_dir.c_str());
+}
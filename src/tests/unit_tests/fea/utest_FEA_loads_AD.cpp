@@ -0,0 +1,314 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for load Jacobians evaluated with forward-mode automatic
+// differentiation. A stiff distributed load and a stiff atomic load are applied
+// to a tetrahedron; their K and R Jacobians obtained with AD are compared
+// against finite-difference approximations. A follower pressure load is applied
+// to a deformed ANCF shell; its AD stiffness matrix is compared against central
+// differences obtained by moving the element nodes.
+//
+// =============================================================================
+
+#include "chrono/physics/ChLoad.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChElementTetraCorot_4.h"
+#include "chrono/fea/ChMesh.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Nonlinear spring-damper pulling each point of a tetrahedron towards its initial position:
+//   F = -k |p - p0| (p - p0) - c v
+// with p and v interpolated from the nodal states.
+class TetraSpringLoader : public ChLoaderUVWdistributed {
+  public:
+    static const bool AD_enabled = true;
+
+    TetraSpringLoader(std::shared_ptr<ChLoadableUVW> loadable) : ChLoaderUVWdistributed(loadable) {}
+
+    void SetReference(const ChVectorDynamic<>& x0) { m_x0 = x0; }
+
+    template <typename Real>
+    void ComputeF_AD(const double U,
+                     const double V,
+                     const double W,
+                     ChVectorDynamic<Real>& F,
+                     const ChVectorDynamic<Real>& state_x,
+                     const ChVectorDynamic<Real>& state_w) {
+        using std::sqrt;
+        double N[4] = {1 - U - V - W, U, V, W};
+        Real d[3];
+        Real v[3];
+        for (int j = 0; j < 3; j++) {
+            d[j] = Real(0);
+            v[j] = Real(0);
+            for (int i = 0; i < 4; i++) {
+                d[j] += N[i] * (state_x(3 * i + j) - m_x0(3 * i + j));
+                v[j] += N[i] * state_w(3 * i + j);
+            }
+        }
+        Real len = sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + 1e-12);
+        for (int j = 0; j < 3; j++)
+            F(j) = -m_k * len * d[j] - m_c * v[j];
+    }
+
+    virtual void ComputeF(const double U,
+                          const double V,
+                          const double W,
+                          ChVectorDynamic<>& F,
+                          ChVectorDynamic<>* state_x,
+                          ChVectorDynamic<>* state_w) override {
+        ChVectorDynamic<> x(12);
+        ChVectorDynamic<> w(12);
+        if (state_x) {
+            x = *state_x;
+            w = *state_w;
+        } else {
+            ChState sx(12, nullptr);
+            ChStateDelta sw(12, nullptr);
+            loadable->LoadableGetStateBlock_x(0, sx);
+            loadable->LoadableGetStateBlock_w(0, sw);
+            x = sx;
+            w = sw;
+        }
+        ComputeF_AD<double>(U, V, W, F, x, w);
+    }
+
+    virtual int GetIntegrationPointsU() override { return 3; }
+    virtual int GetIntegrationPointsV() override { return 3; }
+    virtual int GetIntegrationPointsW() override { return 3; }
+
+    virtual bool IsStiff() override { return true; }
+
+  private:
+    ChVectorDynamic<> m_x0;
+    double m_k = 2e3;
+    double m_c = 15;
+};
+
+// Same force law, concentrated at a point of the tetrahedron.
+class TetraSpringLoaderAtomic : public ChLoaderUVWatomic {
+  public:
+    static const bool AD_enabled = true;
+
+    TetraSpringLoaderAtomic(std::shared_ptr<ChLoadableUVW> loadable)
+        : ChLoaderUVWatomic(loadable, 0.2, 0.3, 0.1), m_distributed(loadable) {}
+
+    void SetReference(const ChVectorDynamic<>& x0) { m_distributed.SetReference(x0); }
+
+    template <typename Real>
+    void ComputeF_AD(const double U,
+                     const double V,
+                     const double W,
+                     ChVectorDynamic<Real>& F,
+                     const ChVectorDynamic<Real>& state_x,
+                     const ChVectorDynamic<Real>& state_w) {
+        m_distributed.ComputeF_AD(U, V, W, F, state_x, state_w);
+    }
+
+    virtual void ComputeF(const double U,
+                          const double V,
+                          const double W,
+                          ChVectorDynamic<>& F,
+                          ChVectorDynamic<>* state_x,
+                          ChVectorDynamic<>* state_w) override {
+        m_distributed.ComputeF(U, V, W, F, state_x, state_w);
+    }
+
+    virtual bool IsStiff() override { return true; }
+
+  private:
+    TetraSpringLoader m_distributed;
+};
+
+static_assert(ChLoaderSupportsAD<TetraSpringLoader>::value, "AD support not detected");
+static_assert(!ChLoaderSupportsAD<ChLoaderGravity>::value, "AD support wrongly detected");
+static_assert(ChLoaderSupportsAD<ChLoaderPressure>::value, "AD support not detected");
+
+class LoadAD : public ::testing::Test {
+  protected:
+    LoadAD();
+
+    template <class Tloader>
+    void Check();
+
+    ChSystemSMC sys;
+    std::shared_ptr<ChElementTetraCorot_4> element;
+    ChVectorDynamic<> x0;
+};
+
+LoadAD::LoadAD() {
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e7);
+    material->Set_v(0.3);
+    material->Set_density(1000);
+
+    ChVector<> pos[4] = {ChVector<>(0, 0, 0), ChVector<>(1, 0, 0), ChVector<>(0, 1, 0), ChVector<>(0, 0, 1)};
+    std::shared_ptr<ChNodeFEAxyz> nodes[4];
+    x0.resize(12);
+    for (int i = 0; i < 4; i++) {
+        nodes[i] = chrono_types::make_shared<ChNodeFEAxyz>(pos[i]);
+        mesh->AddNode(nodes[i]);
+        x0.segment(3 * i, 3) = pos[i].eigen();
+    }
+
+    element = chrono_types::make_shared<ChElementTetraCorot_4>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetMaterial(material);
+    mesh->AddElement(element);
+    sys.Add(mesh);
+    sys.Update();
+
+    // Move the nodes away from their initial positions and give them some velocity
+    for (int i = 0; i < 4; i++) {
+        nodes[i]->SetPos(pos[i] + ChVector<>(0.01 * (i + 1), -0.02 * i, 0.015));
+        nodes[i]->SetPos_dt(ChVector<>(0.1 * i, 0.2, -0.3 * i));
+    }
+}
+
+template <class Tloader>
+void LoadAD::Check() {
+    auto load = chrono_types::make_shared<ChLoad<Tloader>>(element);
+    load->loader.SetReference(x0);
+    load->CreateJacobianMatrices();
+
+    int n = load->LoadGet_ndof_w();
+    ChState state_x(load->LoadGet_ndof_x(), nullptr);
+    ChStateDelta state_w(n, nullptr);
+    load->LoadGetStateBlock_x(state_x);
+    load->LoadGetStateBlock_w(state_w);
+
+    load->ComputeJacobianFD(&state_x, &state_w);
+    ChMatrixDynamic<> K_fd = load->GetJacobians()->K;
+    ChMatrixDynamic<> R_fd = load->GetJacobians()->R;
+
+    // The default Jacobian evaluation uses AD for this loader
+    load->ComputeJacobian(&state_x, &state_w, load->GetJacobians()->K, load->GetJacobians()->R,
+                          load->GetJacobians()->M);
+    const ChMatrixDynamic<>& K = load->GetJacobians()->K;
+    const ChMatrixDynamic<>& R = load->GetJacobians()->R;
+
+    ASSERT_GT(K.cwiseAbs().maxCoeff(), 0.0);
+    ASSERT_GT(R.cwiseAbs().maxCoeff(), 0.0);
+
+    double tolK = 1e-4 * K.cwiseAbs().maxCoeff();
+    double tolR = 1e-4 * R.cwiseAbs().maxCoeff();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ASSERT_NEAR(K(i, j), K_fd(i, j), tolK) << "K(" << i << "," << j << ")";
+            ASSERT_NEAR(R(i, j), R_fd(i, j), tolR) << "R(" << i << "," << j << ")";
+        }
+    }
+}
+
+TEST_F(LoadAD, distributed) {
+    Check<TetraSpringLoader>();
+}
+
+TEST_F(LoadAD, atomic) {
+    Check<TetraSpringLoaderAtomic>();
+}
+
+// Set the coordinates (positions and position gradients) of the nodes of an ANCF shell element.
+static void SetShellState(std::shared_ptr<ChNodeFEAxyzD> nodes[4], const ChVectorDynamic<>& x) {
+    for (int i = 0; i < 4; i++) {
+        nodes[i]->SetPos(ChVector<>(x(6 * i + 0), x(6 * i + 1), x(6 * i + 2)));
+        nodes[i]->SetD(ChVector<>(x(6 * i + 3), x(6 * i + 4), x(6 * i + 5)));
+    }
+}
+
+TEST(LoadPressureAD, shell) {
+    ChSystemSMC sys;
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    auto material = chrono_types::make_shared<ChMaterialShellANCF>(1000, 1e7, 0.3);
+
+    ChVector<> pos[4] = {ChVector<>(0, 0, 0), ChVector<>(1, 0, 0), ChVector<>(1, 1, 0), ChVector<>(0, 1, 0)};
+    std::shared_ptr<ChNodeFEAxyzD> nodes[4];
+    for (int i = 0; i < 4; i++) {
+        nodes[i] = chrono_types::make_shared<ChNodeFEAxyzD>(pos[i], ChVector<>(0, 0, 1));
+        mesh->AddNode(nodes[i]);
+    }
+
+    auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+    element->SetNodes(nodes[0], nodes[1], nodes[2], nodes[3]);
+    element->SetDimensions(1, 1);
+    element->AddLayer(0.01, 0, material);
+    element->SetAlphaDamp(0.0);
+    mesh->AddElement(element);
+    sys.Add(mesh);
+    sys.Update();
+
+    // Deform the shell (out-of-plane bending and in-plane shear), so that the normal and the area vary over it
+    nodes[1]->SetPos(ChVector<>(1.05, 0.02, 0.1));
+    nodes[2]->SetPos(ChVector<>(1.1, 0.95, 0.25));
+    nodes[3]->SetPos(ChVector<>(-0.05, 1.02, 0.05));
+    nodes[1]->SetD(ChVector<>(-0.1, 0, 1).GetNormalized());
+    nodes[2]->SetD(ChVector<>(-0.2, -0.1, 1).GetNormalized());
+
+    auto load = chrono_types::make_shared<ChLoad<ChLoaderPressure>>(element);
+    load->loader.SetPressure(1e4);
+    load->loader.SetIntegrationPoints(2);
+    load->loader.SetStiff(true);
+    load->CreateJacobianMatrices();
+
+    int n = load->LoadGet_ndof_w();
+    ChState state_x(load->LoadGet_ndof_x(), nullptr);
+    ChStateDelta state_w(n, nullptr);
+    load->LoadGetStateBlock_x(state_x);
+    load->LoadGetStateBlock_w(state_w);
+
+    // AD Jacobians (the default for this loader and loadable)
+    load->ComputeJacobian(&state_x, &state_w, load->GetJacobians()->K, load->GetJacobians()->R,
+                          load->GetJacobians()->M);
+    ChMatrixDynamic<> K = load->GetJacobians()->K;
+    ChMatrixDynamic<> R = load->GetJacobians()->R;
+
+    // The AD pass also returns the generalized load, which must match the standard evaluation
+    ChVectorDynamic<> Q_ad = load->loader.Q;
+    load->loader.ComputeQ(nullptr, nullptr);
+    ASSERT_NEAR((Q_ad - load->loader.Q).norm(), 0.0, 1e-10 * load->loader.Q.norm());
+
+    // Central differences of the load w.r.t. the nodal coordinates, moving the nodes
+    ChVectorDynamic<> x0 = state_x;
+    ChMatrixDynamic<> K_fd(n, n);
+    double delta = 1e-6;
+    for (int j = 0; j < n; j++) {
+        ChVectorDynamic<> x = x0;
+        x(j) = x0(j) + delta;
+        SetShellState(nodes, x);
+        load->loader.ComputeQ(nullptr, nullptr);
+        ChVectorDynamic<> Qp = load->loader.Q;
+        x(j) = x0(j) - delta;
+        SetShellState(nodes, x);
+        load->loader.ComputeQ(nullptr, nullptr);
+        ChVectorDynamic<> Qm = load->loader.Q;
+        K_fd.col(j) = -(Qp - Qm) / (2 * delta);
+    }
+    SetShellState(nodes, x0);
+
+    double Kmax = K_fd.cwiseAbs().maxCoeff();
+    ASSERT_GT(Kmax, 0.0);
+    ASSERT_EQ(R.cwiseAbs().maxCoeff(), 0.0);
+
+    double tol = 1e-6 * Kmax;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ASSERT_NEAR(K(i, j), K_fd(i, j), tol) << "K(" << i << "," << j << ")";
+        }
+    }
+}
@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Chrono::Multicore unit test for FEA meshes.
+// - a free mesh (two nodes connected by a spring) falls under gravity
+// - a mesh with a node cloud contact surface settles on a box fixed to ground
+//
+// =============================================================================
+
+#include "chrono/fea/ChContactSurfaceNodeCloud.h"
+#include "chrono/fea/ChElementSpring.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+
+#include "unit_testing.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a mesh with two nodes at the specified height, connected by a spring.
+// Optionally, add a node cloud contact surface.
+static std::shared_ptr<ChMesh> CreateMesh(double height,
+                                          double radius,
+                                          std::shared_ptr<ChMaterialSurface> mat,
+                                          std::vector<std::shared_ptr<ChNodeFEAxyz>>& nodes) {
+    auto mesh = chrono_types::make_shared<ChMesh>();
+
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(-0.1, 0, height)));
+    nodes.push_back(chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(+0.1, 0, height)));
+    for (auto& node : nodes) {
+        node->SetMass(0.1);
+        mesh->AddNode(node);
+    }
+
+    auto spring = chrono_types::make_shared<ChElementSpring>();
+    spring->SetNodes(nodes[0], nodes[1]);
+    spring->SetSpringK(1e3);
+    spring->SetDamperR(1);
+    mesh->AddElement(spring);
+
+    if (mat) {
+        auto cloud = chrono_types::make_shared<ChContactSurfaceNodeCloud>(mat);
+        mesh->AddContactSurface(cloud);
+        cloud->AddAllNodes(radius);
+    }
+
+    return mesh;
+}
+
+TEST(ChronoMulticore, fea_gravity) {
+    ChVector<> gravity(0, 0, -9.81);
+    ChSystemMulticoreSMC sys;
+    sys.Set_G_acc(gravity);
+    sys.SetNumThreads(2);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto mesh = CreateMesh(1.0, 0.0, nullptr, nodes);
+    sys.AddMesh(mesh);
+
+    double step = 1e-3;
+    while (sys.GetChTime() < 0.5) {
+        sys.DoStepDynamics(step);
+    }
+
+    // The semi-implicit Euler scheme has an O(h) error in position
+    double time = sys.GetChTime();
+    for (auto& node : nodes) {
+        double z_ref = 1.0 + 0.5 * gravity.z() * time * time;
+        ASSERT_NEAR(node->GetPos().z(), z_ref, step * time * 9.81);
+    }
+    ASSERT_NEAR((nodes[1]->GetPos() - nodes[0]->GetPos()).Length(), 0.2, 1e-8);
+}
+
+TEST(ChronoMulticore, fea_contact) {
+    ChSystemMulticoreSMC sys;
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetNumThreads(2);
+    sys.GetSettings()->solver.contact_force_model = ChSystemSMC::Hooke;
+    sys.GetSettings()->solver.use_material_properties = false;
+    sys.GetSettings()->num_fea_substeps = 4;
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetKn(1e4);
+    mat->SetGn(1e2);
+    mat->SetFriction(0.4f);
+
+    // Box with top face at z = 0
+    auto ground = std::shared_ptr<ChBody>(sys.NewBody());
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat, ChVector<>(1, 1, 0.1), ChVector<>(0, 0, -0.1));
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    double radius = 0.02;
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    auto mesh = CreateMesh(0.1, radius, mat, nodes);
+    sys.AddMesh(mesh);
+
+    ASSERT_EQ(sys.GetMeshes().size(), 1);
+    ASSERT_EQ(sys.GetMeshes()[0]->GetNumProxies(), 2);
+
+    while (sys.GetChTime() < 1.0) {
+        sys.DoStepDynamics(1e-4);
+    }
+
+    // Nodes at rest on the box, with a small penetration (weight / kn)
+    for (auto& node : nodes) {
+        ASSERT_NEAR(node->GetPos().z(), radius - 0.1 * 9.81 / 1e4, 1e-3);
+        ASSERT_NEAR(node->GetPos_dt().Length(), 0, 1e-2);
+    }
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the closed-form Jacobians of SMC contact forces.
+// The stiffness and damping matrices of a contact between two rigid bodies are
+// compared against their finite-difference approximations, for the built-in
+// contact force models, in both the viscous and Coulomb friction regimes, with
+// and without body angular velocities and adhesion.
+//
+// The finite-difference Jacobians use forward differences with a perturbation
+// of 1e-5, so they are accurate to about 1e-4 relative to the largest entry.
+// Every entry of the closed-form Jacobians must match within 1e-3 times the
+// largest entry of the corresponding finite-difference matrix.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChContactSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+typedef ChContactSMC<ChContactable_1vars<6>, ChContactable_1vars<6>> ContactBodyBody;
+
+// Create a contact between two bodies and compare the analytical and finite-difference Jacobians.
+// The tangential relative velocity is set to 'vel_t'. If 'spin' is true, both bodies also rotate.
+static void CheckJacobians(ChSystemSMC::ContactForceModel model,
+                           bool use_mat_props,
+                           double vel_t,
+                           bool spin = false,
+                           float adhesion = 0) {
+    ChSystemSMC sys;
+    sys.UseMaterialProperties(use_mat_props);
+    sys.SetContactForceModel(model);
+    sys.SetTangentialDisplacementModel(ChSystemSMC::OneStep);
+    sys.SetStiffContact(true);
+    sys.SetStep(1e-3);
+    sys.SetAdhesionForceModel(ChSystemSMC::AdhesionForceModel::Constant);
+
+    auto bodyA = chrono_types::make_shared<ChBody>();
+    bodyA->SetMass(1.0);
+    bodyA->SetInertiaXX(ChVector<>(0.1, 0.2, 0.3));
+    bodyA->SetPos(ChVector<>(0, 0, 0));
+    bodyA->SetRot(Q_from_AngAxis(0.3, ChVector<>(1, 2, 3).GetNormalized()));
+    bodyA->SetPos_dt(ChVector<>(0.02, 0, 0));
+    if (spin)
+        bodyA->SetWvel_loc(ChVector<>(0.5, -1.0, 2.0));
+    sys.AddBody(bodyA);
+
+    auto bodyB = chrono_types::make_shared<ChBody>();
+    bodyB->SetMass(2.0);
+    bodyB->SetInertiaXX(ChVector<>(0.3, 0.2, 0.1));
+    bodyB->SetPos(ChVector<>(1.5, 0.2, -0.1));
+    bodyB->SetRot(Q_from_AngAxis(-0.5, ChVector<>(0, 1, 1).GetNormalized()));
+    bodyB->SetPos_dt(ChVector<>(-0.03, vel_t, 0));
+    if (spin)
+        bodyB->SetWvel_loc(ChVector<>(-1.5, 0.3, 0.8));
+    sys.AddBody(bodyB);
+
+    ChMaterialCompositeSMC mat;
+    mat.E_eff = 1e7f;
+    mat.G_eff = 4e6f;
+    mat.cr_eff = 0.3f;
+    mat.mu_eff = 0.4f;
+    mat.adhesion_eff = adhesion;
+    mat.kn = 2e5f;
+    mat.kt = 2e4f;
+    mat.gn = 40;
+    mat.gt = 20;
+
+    double delta = 0.01;
+    collision::ChCollisionInfo cinfo;
+    cinfo.vN = ChVector<>(1, 0.1, 0.05).GetNormalized();
+    cinfo.vpA = ChVector<>(1.0, 0.05, 0.02);
+    cinfo.vpB = cinfo.vpA - delta * cinfo.vN;
+    cinfo.distance = -delta;
+    cinfo.eff_radius = 0.5;
+
+    ContactBodyBody contact(sys.GetContactContainer().get(), bodyA.get(), bodyB.get(), cinfo, mat);
+    ASSERT_TRUE(contact.GetJacobianK() != nullptr);
+    ASSERT_TRUE(contact.GetJacobianR() != nullptr);
+
+    ChMatrixDynamic<> K = *contact.GetJacobianK();
+    ChMatrixDynamic<> R = *contact.GetJacobianR();
+
+    contact.CalculateJacobiansFD(mat);
+    const ChMatrixDynamic<>& K_fd = *contact.GetJacobianK();
+    const ChMatrixDynamic<>& R_fd = *contact.GetJacobianR();
+
+    double tolK = 1e-3 * K_fd.cwiseAbs().maxCoeff();
+    double tolR = 1e-3 * R_fd.cwiseAbs().maxCoeff();
+    ASSERT_GT(tolK, 0.0);
+    ASSERT_GT(tolR, 0.0);
+
+    for (int i = 0; i < K.rows(); i++) {
+        for (int j = 0; j < K.cols(); j++) {
+            ASSERT_NEAR(K(i, j), K_fd(i, j), tolK) << "K(" << i << "," << j << ")";
+            ASSERT_NEAR(R(i, j), R_fd(i, j), tolR) << "R(" << i << "," << j << ")";
+        }
+    }
+}
+
+TEST(ContactJacobianSMC, Hooke_viscous) {
+    CheckJacobians(ChSystemSMC::Hooke, false, 0.1);
+}
+
+TEST(ContactJacobianSMC, Hooke_coulomb) {
+    CheckJacobians(ChSystemSMC::Hooke, false, 2.0);
+}
+
+TEST(ContactJacobianSMC, Hooke_matprops) {
+    CheckJacobians(ChSystemSMC::Hooke, true, 0.1);
+}
+
+TEST(ContactJacobianSMC, Hertz_viscous) {
+    CheckJacobians(ChSystemSMC::Hertz, false, 0.1);
+}
+
+TEST(ContactJacobianSMC, Hertz_coulomb) {
+    CheckJacobians(ChSystemSMC::Hertz, false, 2.0);
+}
+
+TEST(ContactJacobianSMC, Hertz_matprops) {
+    CheckJacobians(ChSystemSMC::Hertz, true, 2.0);
+}
+
+TEST(ContactJacobianSMC, PlainCoulomb) {
+    CheckJacobians(ChSystemSMC::PlainCoulomb, false, 0.1);
+}
+
+TEST(ContactJacobianSMC, PlainCoulomb_matprops) {
+    CheckJacobians(ChSystemSMC::PlainCoulomb, true, 2.0);
+}
+
+TEST(ContactJacobianSMC, Hooke_spin) {
+    CheckJacobians(ChSystemSMC::Hooke, false, 0.1, true);
+}
+
+TEST(ContactJacobianSMC, Hertz_spin_coulomb) {
+    CheckJacobians(ChSystemSMC::Hertz, true, 2.0, true);
+}
+
+TEST(ContactJacobianSMC, PlainCoulomb_spin) {
+    CheckJacobians(ChSystemSMC::PlainCoulomb, false, 0.1, true);
+}
+
+TEST(ContactJacobianSMC, Hooke_adhesion) {
+    CheckJacobians(ChSystemSMC::Hooke, false, 0.1, false, 100);
+}
+
+TEST(ContactJacobianSMC, Hertz_adhesion_spin) {
+    CheckJacobians(ChSystemSMC::Hertz, false, 2.0, true, 20);
+}
+
+TEST(ContactJacobianSMC, PlainCoulomb_adhesion) {
+    CheckJacobians(ChSystemSMC::PlainCoulomb, true, 2.0, false, 100);
+}
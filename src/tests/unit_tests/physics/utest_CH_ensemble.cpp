@@ -0,0 +1,154 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Tests for the ensemble runner and the shared asset cache.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static const char* cube_obj =
+    "v -1 -1 -1\nv 1 -1 -1\nv 1 1 -1\nv -1 1 -1\nv -1 -1 1\nv 1 -1 1\nv 1 1 1\nv -1 1 1\n"
+    "f 1 3 2\nf 1 4 3\nf 5 6 7\nf 5 7 8\nf 1 2 6\nf 1 6 5\nf 2 3 7\nf 2 7 6\nf 3 4 8\nf 3 8 7\nf 4 1 5\nf 4 5 8\n";
+
+// Fixture files in a directory in the system temporary directory
+static std::string TempDirectory(const std::string& name) {
+    const char* tmp = std::getenv("TMPDIR");
+    if (!tmp)
+        tmp = std::getenv("TEMP");
+    return std::string(tmp ? tmp : "/tmp") + "/" + name;
+}
+
+static const std::string fixture_dir = TempDirectory("chrono_utest_ensemble");
+
+static std::string FixtureFile(const std::string& name) {
+    return fixture_dir + "/" + name;
+}
+
+static void WriteFile(const std::string& name, const std::string& contents) {
+    filesystem::create_directory(filesystem::path(fixture_dir));
+    std::ofstream ofs(FixtureFile(name));
+    ofs << contents;
+}
+
+// Remove the fixture files, then the (empty) directory
+static void RemoveOutput() {
+    for (const auto& file : {"utest_cube_a.obj", "utest_cube_b.obj", "utest_hulls.chulls"})
+        filesystem::path(FixtureFile(file)).remove_file();
+    std::remove(fixture_dir.c_str());
+}
+
+TEST(ChAssetCache, content_addressed) {
+    WriteFile("utest_cube_a.obj", cube_obj);
+    WriteFile("utest_cube_b.obj", cube_obj);
+
+    ChAssetCache cache;
+
+    auto mesh_a = cache.GetTriangleMesh(FixtureFile("utest_cube_a.obj"));
+    auto mesh_b = cache.GetTriangleMesh(FixtureFile("utest_cube_b.obj"));
+    ASSERT_TRUE(mesh_a != nullptr);
+    ASSERT_EQ(mesh_a, mesh_b);
+    ASSERT_EQ(mesh_a->getNumTriangles(), 12);
+    ASSERT_EQ(cache.GetNumMisses(), 1);
+    ASSERT_EQ(cache.GetNumHits(), 1);
+
+    // Different load options result in a different asset
+    auto mesh_uv = cache.GetTriangleMesh(FixtureFile("utest_cube_a.obj"), true, true);
+    ASSERT_NE(mesh_a, mesh_uv);
+
+    // Missing files are not cached
+    ASSERT_TRUE(cache.GetTriangleMesh(FixtureFile("utest_missing.obj")) == nullptr);
+    ASSERT_EQ(cache.GetNumAssets(), 2);
+
+    // Copies are independent of the cached mesh
+    auto copy = cache.GetTriangleMeshCopy(FixtureFile("utest_cube_a.obj"));
+    ASSERT_TRUE(copy != nullptr);
+    ASSERT_NE(copy.get(), mesh_a.get());
+    ASSERT_EQ(copy->getNumTriangles(), 12);
+    copy->Transform(ChVector<>(1, 0, 0), ChMatrix33<>(1));
+    ASSERT_DOUBLE_EQ(mesh_a->m_vertices[0].x(), -1.0);
+
+    RemoveOutput();
+}
+
+TEST(ChAssetCache, convex_hulls) {
+    WriteFile("utest_hulls.chulls", "hull\n0 0 0\n1 0 0\n0 1 0\n0 0 1\nhull\n0 0 0\n2 0 0\n0 2 0\n");
+
+    ChAssetCache cache;
+    auto hulls = cache.GetConvexHulls(FixtureFile("utest_hulls.chulls"));
+    ASSERT_TRUE(hulls != nullptr);
+    ASSERT_EQ(hulls->size(), 2);
+    ASSERT_EQ((*hulls)[0].size(), 4);
+    ASSERT_EQ((*hulls)[1].size(), 3);
+    ASSERT_EQ(cache.GetConvexHulls(FixtureFile("utest_hulls.chulls")), hulls);
+
+    RemoveOutput();
+}
+
+TEST(ChEnsembleRunner, runs) {
+    WriteFile("utest_cube_a.obj", cube_obj);
+
+    int num_runs = 32;
+    ChEnsembleRunner runner(4);
+
+    runner.Run(num_runs, [](int index, ChAssetCache& cache, ChEnsembleRunner::RunResult& result) {
+        if (index == 5)
+            throw ChException("expected failure");
+
+        auto mesh = cache.GetTriangleMesh(FixtureFile("utest_cube_a.obj"));
+
+        ChSystemNSC sys;
+        sys.SetNumThreads(1);
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>(0, 0, (double)mesh->getNumTriangles()));
+        sys.AddBody(body);
+
+        while (sys.GetChTime() < 0.1)
+            sys.DoStepDynamics(1e-3);
+
+        result.data.push_back(body->GetPos().z());
+    });
+
+    const auto& results = runner.GetResults();
+    ASSERT_EQ(results.size(), num_runs);
+    ASSERT_EQ(runner.GetNumFailed(), 1);
+    ASSERT_FALSE(results[5].success);
+    ASSERT_EQ(runner.GetAssetCache().GetNumMisses(), 1);
+
+    for (int i = 0; i < num_runs; i++) {
+        ASSERT_EQ(results[i].index, i);
+        if (i == 5)
+            continue;
+        ASSERT_TRUE(results[i].success);
+        ASSERT_EQ(results[i].data.size(), 1);
+        ASSERT_DOUBLE_EQ(results[i].data[0], results[0].data[0]);
+    }
+
+    ASSERT_GT(runner.GetThroughput(), 0);
+
+    RemoveOutput();
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for island decomposition in ChSystemNSC.
+// - piles of boxes on the ground and pendulums attached to the ground form
+//   separate islands (the fixed ground does not connect islands)
+// - with a PSOR solver running a fixed number of iterations, solving islands
+//   separately gives the same results as solving the monolithic problem
+// - with sleeping enabled, a pile at rest is put to sleep as a whole while a
+//   pendulum keeps swinging
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const int num_piles = 4;
+const int num_pendulums = 2;
+
+// Create piles of two boxes on the ground and double pendulums attached to the ground.
+static std::vector<std::shared_ptr<ChBody>> CreateScene(ChSystemNSC& sys, bool islands) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+    sys.SetUseIslands(islands);
+
+    auto solver = chrono_types::make_shared<ChSolverPSOR>();
+    solver->SetMaxIterations(50);
+    solver->SetTolerance(0);
+    sys.SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 20, 1, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, 0, -0.5));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+
+    for (int i = 0; i < num_piles; i++) {
+        for (int j = 0; j < 2; j++) {
+            auto box = chrono_types::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.2, 1000, false, true, mat);
+            box->SetPos(ChVector<>(2.0 * i - 4, 2 + 0.1 * j, 0.1 + 0.21 * j));
+            sys.AddBody(box);
+            bodies.push_back(box);
+        }
+    }
+
+    for (int i = 0; i < num_pendulums; i++) {
+        ChVector<> pivot(2.0 * i - 4, -3, 2);
+        auto link1 = chrono_types::make_shared<ChBodyEasyBox>(0.1, 0.1, 0.5, 1000, false, false);
+        link1->SetPos(pivot + ChVector<>(0.25, 0, 0));
+        link1->SetRot(Q_from_AngY(CH_C_PI_2));
+        sys.AddBody(link1);
+        auto link2 = chrono_types::make_shared<ChBodyEasyBox>(0.1, 0.1, 0.5, 1000, false, false);
+        link2->SetPos(pivot + ChVector<>(0.75, 0, 0));
+        link2->SetRot(Q_from_AngY(CH_C_PI_2));
+        sys.AddBody(link2);
+        bodies.push_back(link1);
+        bodies.push_back(link2);
+
+        auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev1->Initialize(ground, link1, ChCoordsys<>(pivot, Q_from_AngX(CH_C_PI_2)));
+        sys.AddLink(rev1);
+        auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev2->Initialize(link1, link2, ChCoordsys<>(pivot + ChVector<>(0.5, 0, 0), Q_from_AngX(CH_C_PI_2)));
+        sys.AddLink(rev2);
+    }
+
+    return bodies;
+}
+
+TEST(ChSystemNSC, islands) {
+    ChSystemNSC sys_ref;
+    auto bodies_ref = CreateScene(sys_ref, false);
+
+    ChSystemNSC sys;
+    auto bodies = CreateScene(sys, true);
+
+    while (sys.GetChTime() < 0.5) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys.DoStepDynamics(1e-3);
+    }
+
+    // One island per pile (the two boxes are in contact) and one island per pendulum
+    ASSERT_EQ(sys_ref.GetNumIslands(), 0);
+    ASSERT_EQ(sys.GetNumIslands(), num_piles + num_pendulums);
+
+    // Same sequence of PSOR updates in each island
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0, 1e-12);
+        ASSERT_NEAR((bodies[i]->GetPos_dt() - bodies_ref[i]->GetPos_dt()).Length(), 0, 1e-12);
+    }
+}
+
+TEST(ChSystemNSC, islands_sleeping) {
+    ChSystemNSC sys;
+    auto bodies = CreateScene(sys, true);
+    sys.SetUseSleeping(true);
+    for (auto& body : bodies) {
+        body->SetUseSleeping(true);
+        body->SetSleepTime(0.1f);
+    }
+
+    while (sys.GetChTime() < 1.0)
+        sys.DoStepDynamics(1e-3);
+
+    // The piles are at rest and sleep; the pendulums are still swinging
+    for (int i = 0; i < 2 * num_piles; i++)
+        ASSERT_TRUE(bodies[i]->GetSleeping());
+    for (int i = 2 * num_piles; i < (int)bodies.size(); i++)
+        ASSERT_FALSE(bodies[i]->GetSleeping());
+    ASSERT_EQ(sys.GetNumIslands(), num_pendulums);
+}
@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the ChLinkLock kernels specialized for the standard joint types.
+// Each joint type (free and locked) is compared against a link with the same
+// lock mask which uses the generic lock formulation. The constraint violations,
+// jacobians, and right-hand sides must match (up to round-off).
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Link with a given lock mask, using the generic lock formulation (link type not set through ChangeLinkType).
+class GenericLock : public ChLinkLock {
+  public:
+    GenericLock(ChLinkMask& m) {
+        BuildLink(m.Constr_N(0).IsActive(), m.Constr_N(1).IsActive(), m.Constr_N(2).IsActive(), false,
+                  m.Constr_N(4).IsActive(), m.Constr_N(5).IsActive(), m.Constr_N(6).IsActive());
+    }
+};
+
+static std::shared_ptr<ChBody> CreateBody(ChSystem& sys, std::mt19937& gen) {
+    std::uniform_real_distribution<double> unif(-1, 1);
+    auto rand3 = [&]() { return ChVector<>(unif(gen), unif(gen), unif(gen)); };
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(rand3());
+    body->SetRot(Q_from_AngAxis(3 * unif(gen), rand3().GetNormalized()));
+    body->SetPos_dt(rand3());
+    body->SetWvel_loc(rand3());
+    body->SetPos_dtdt(rand3());
+    body->SetWacc_loc(rand3());
+    sys.AddBody(body);
+    return body;
+}
+
+template <typename T>
+static void Check(const T& a, const T& b) {
+    ASSERT_EQ(a.rows(), b.rows());
+    ASSERT_EQ(a.cols(), b.cols());
+    for (int i = 0; i < a.rows(); i++)
+        for (int j = 0; j < a.cols(); j++)
+            ASSERT_NEAR(a(i, j), b(i, j), 1e-14 * (1 + std::abs(b(i, j)))) << "row " << i << " col " << j;
+}
+
+template <typename JOINT>
+static void CompareJoint(bool lock) {
+    ChSystemNSC sys;
+    std::mt19937 gen(17);
+    std::uniform_real_distribution<double> unif(-1, 1);
+
+    for (int i = 0; i < 10; i++) {
+        auto body1 = CreateBody(sys, gen);
+        auto body2 = CreateBody(sys, gen);
+        ChCoordsys<> csys1(ChVector<>(unif(gen), unif(gen), unif(gen)),
+                           Q_from_AngAxis(unif(gen), ChVector<>(unif(gen), 1, unif(gen)).GetNormalized()));
+        ChCoordsys<> csys2(ChVector<>(unif(gen), unif(gen), unif(gen)),
+                           Q_from_AngAxis(unif(gen), ChVector<>(1, unif(gen), unif(gen)).GetNormalized()));
+
+        auto joint = chrono_types::make_shared<JOINT>();
+        joint->Initialize(body1, body2, true, csys1, csys2);
+        joint->Lock(lock);
+        sys.AddLink(joint);
+
+        auto generic = chrono_types::make_shared<GenericLock>(joint->GetMask());
+        generic->Initialize(body1, body2, true, csys1, csys2);
+        sys.AddLink(generic);
+
+        ASSERT_EQ(joint->GetDOC_c(), generic->GetDOC_c());
+
+        joint->Update(0.5, false);
+        generic->Update(0.5, false);
+
+        Check(joint->GetConstraintViolation(), generic->GetConstraintViolation());
+        Check(joint->GetConstraintViolation_dt(), generic->GetConstraintViolation_dt());
+        Check(joint->GetConstraintViolation_dtdt(), generic->GetConstraintViolation_dtdt());
+        Check(joint->GetCq1(), generic->GetCq1());
+        Check(joint->GetCq2(), generic->GetCq2());
+        Check(joint->GetCqw1(), generic->GetCqw1());
+        Check(joint->GetCqw2(), generic->GetCqw2());
+        Check(joint->GetQc(), generic->GetQc());
+        Check(joint->GetCt(), generic->GetCt());
+    }
+}
+
+template <typename JOINT>
+static void CompareJoint() {
+    CompareJoint<JOINT>(false);
+    CompareJoint<JOINT>(true);
+}
+
+TEST(ChLinkLockKernels, revolute) {
+    CompareJoint<ChLinkLockRevolute>();
+}
+
+TEST(ChLinkLockKernels, spherical) {
+    CompareJoint<ChLinkLockSpherical>();
+}
+
+TEST(ChLinkLockKernels, cylindrical) {
+    CompareJoint<ChLinkLockCylindrical>();
+}
+
+TEST(ChLinkLockKernels, prismatic) {
+    CompareJoint<ChLinkLockPrismatic>();
+}
+
+TEST(ChLinkLockKernels, point_plane) {
+    CompareJoint<ChLinkLockPointPlane>();
+}
+
+TEST(ChLinkLockKernels, point_line) {
+    CompareJoint<ChLinkLockPointLine>();
+}
+
+TEST(ChLinkLockKernels, plane_plane) {
+    CompareJoint<ChLinkLockPlanePlane>();
+}
+
+TEST(ChLinkLockKernels, oldham) {
+    CompareJoint<ChLinkLockOldham>();
+}
+
+TEST(ChLinkLockKernels, free) {
+    CompareJoint<ChLinkLockFree>();
+}
+
+TEST(ChLinkLockKernels, align) {
+    CompareJoint<ChLinkLockAlign>();
+}
+
+TEST(ChLinkLockKernels, parallel) {
+    CompareJoint<ChLinkLockParallel>();
+}
+
+TEST(ChLinkLockKernels, perpend) {
+    CompareJoint<ChLinkLockPerpend>();
+}
+
+TEST(ChLinkLockKernels, revolute_prismatic) {
+    CompareJoint<ChLinkLockRevolutePrismatic>();
+}
+
+// A joint with limits uses the generic formulation (the limits need the full lock jacobians).
+TEST(ChLinkLockKernels, limits) {
+    ChSystemNSC sys;
+    std::mt19937 gen(3);
+    auto body1 = CreateBody(sys, gen);
+    auto body2 = CreateBody(sys, gen);
+
+    auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(body1, body2, ChCoordsys<>(ChVector<>(0.1, 0.2, 0.3), QUNIT));
+    joint->GetLimit_Rz().SetActive(true);
+    joint->GetLimit_Rz().SetMin(-0.1);
+    joint->GetLimit_Rz().SetMax(0.1);
+    sys.AddLink(joint);
+
+    auto generic = chrono_types::make_shared<GenericLock>(joint->GetMask());
+    generic->Initialize(body1, body2, ChCoordsys<>(ChVector<>(0.1, 0.2, 0.3), QUNIT));
+    sys.AddLink(generic);
+
+    joint->Update(0, false);
+    generic->Update(0, false);
+    Check(joint->GetCq1(), generic->GetCq1());
+    Check(joint->GetCqw2(), generic->GetCqw2());
+    Check(joint->GetQc(), generic->GetQc());
+}
@@ -0,0 +1,88 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the quadrature of distributed volume loads over a triangle
+// prism (triangle in u,v and thickness w in [-1,+1]). A mock loadable returns
+// N'*F with N = (w^2, u), whose integrals over the prism are known in closed form.
+//
+// =============================================================================
+
+#include "chrono/physics/ChLoad.h"
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class PrismLoadable : public ChLoadableUVW {
+  public:
+    virtual int LoadableGet_ndof_x() override { return 2; }
+    virtual int LoadableGet_ndof_w() override { return 2; }
+    virtual void LoadableGetStateBlock_x(int block_offset, ChState& mD) override {}
+    virtual void LoadableGetStateBlock_w(int block_offset, ChStateDelta& mD) override {}
+    virtual void LoadableStateIncrement(const unsigned int off_x,
+                                        ChState& x_new,
+                                        const ChState& x,
+                                        const unsigned int off_v,
+                                        const ChStateDelta& Dv) override {}
+    virtual int Get_field_ncoords() override { return 1; }
+    virtual int GetSubBlocks() override { return 1; }
+    virtual unsigned int GetSubBlockOffset(int nblock) override { return 0; }
+    virtual unsigned int GetSubBlockSize(int nblock) override { return 2; }
+    virtual bool IsSubBlockActive(int nblock) const override { return true; }
+    virtual void LoadableGetVariables(std::vector<ChVariables*>& mvars) override {}
+
+    virtual void ComputeNF(const double U,
+                           const double V,
+                           const double W,
+                           ChVectorDynamic<>& Qi,
+                           double& detJ,
+                           const ChVectorDynamic<>& F,
+                           ChVectorDynamic<>* state_x,
+                           ChVectorDynamic<>* state_w) override {
+        Qi(0) = W * W * F(0);
+        Qi(1) = U * F(0);
+        detJ = 1;
+    }
+
+    virtual double GetDensity() override { return 1; }
+    virtual bool IsTrianglePrismIntegrationNeeded() override { return true; }
+};
+
+class UnitLoader : public ChLoaderUVWdistributed {
+  public:
+    UnitLoader(std::shared_ptr<ChLoadableUVW> loadable) : ChLoaderUVWdistributed(loadable) {}
+
+    virtual void ComputeF(const double U,
+                          const double V,
+                          const double W,
+                          ChVectorDynamic<>& F,
+                          ChVectorDynamic<>* state_x,
+                          ChVectorDynamic<>* state_w) override {
+        F(0) = 1;
+    }
+
+    virtual int GetIntegrationPointsU() override { return 2; }
+    virtual int GetIntegrationPointsV() override { return 2; }
+    virtual int GetIntegrationPointsW() override { return 2; }
+};
+
+TEST(LoaderQuadrature, triangle_prism) {
+    auto loadable = chrono_types::make_shared<PrismLoadable>();
+    UnitLoader loader(loadable);
+    loader.ComputeQ(nullptr, nullptr);
+
+    // Integral of w^2 over the prism: area(triangle) * 2/3
+    ASSERT_NEAR(loader.Q(0), 1.0 / 3, 1e-10);
+    // Integral of u over the prism: (1/6) * 2
+    ASSERT_NEAR(loader.Q(1), 1.0 / 3, 1e-10);
+}
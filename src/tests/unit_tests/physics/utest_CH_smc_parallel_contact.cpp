@@ -0,0 +1,159 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the multi-threaded evaluation of SMC contact forces.
+// A pile of spheres (with two different materials) settling on a box is
+// simulated with 1 and with 4 threads (ChSystem::SetNumThreads). The contact
+// forces and the body states must match, with and without stiff contact.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+struct ContactData {
+    ChVector<> p1;
+    ChVector<> force;
+};
+
+class ContactCollector : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        contacts.push_back({pA, plane_coord * react_forces});
+        return true;
+    }
+
+    std::vector<ContactData> contacts;
+};
+
+struct SimulationResult {
+    std::vector<ChVector<>> pos;
+    std::vector<ChVector<>> vel;
+    std::vector<ContactData> contacts;
+};
+
+static SimulationResult Simulate(int num_threads, bool stiff_contact) {
+    ChSystemSMC sys;
+    sys.SetNumThreads(num_threads, 1, 1);
+    sys.SetStiffContact(stiff_contact);
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto mat_ground = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat_ground->SetFriction(0.6f);
+    mat_ground->SetYoungModulus(1e7f);
+
+    auto mat_a = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat_a->SetFriction(0.3f);
+    mat_a->SetRestitution(0.2f);
+    mat_a->SetYoungModulus(1e7f);
+
+    auto mat_b = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat_b->SetFriction(0.5f);
+    mat_b->SetRestitution(0.4f);
+    mat_b->SetYoungModulus(2e7f);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), mat_ground, ChVector<>(4, 4, 0.2), ChVector<>(0, 0, -0.1));
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    // Overlapping layers of spheres, so that there are sphere-sphere and sphere-ground contacts from the start
+    double radius = 0.1;
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int k = 0; k < 3; k++) {
+        for (int i = 0; i < 8; i++) {
+            for (int j = 0; j < 8; j++) {
+                auto ball = chrono_types::make_shared<ChBody>();
+                ball->SetMass(1);
+                ball->SetInertiaXX(ChVector<>(0.004, 0.004, 0.004));
+                ball->SetPos(ChVector<>((i - 3.5) * 1.9 * radius + 0.01 * k, (j - 3.5) * 1.9 * radius,
+                                        0.95 * radius + k * 1.9 * radius));
+                ball->SetCollide(true);
+                ball->GetCollisionModel()->ClearModel();
+                utils::AddSphereGeometry(ball.get(), (i + j + k) % 2 ? mat_a : mat_b, radius);
+                ball->GetCollisionModel()->BuildModel();
+                sys.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    for (int n = 0; n < 50; n++)
+        sys.DoStepDynamics(1e-4);
+
+    SimulationResult result;
+    for (const auto& ball : balls) {
+        result.pos.push_back(ball->GetPos());
+        result.vel.push_back(ball->GetPos_dt());
+    }
+
+    auto collector = chrono_types::make_shared<ContactCollector>();
+    sys.GetContactContainer()->ReportAllContacts(collector);
+    result.contacts = collector->contacts;
+    std::sort(result.contacts.begin(), result.contacts.end(), [](const ContactData& a, const ContactData& b) {
+        if (a.p1.x() != b.p1.x())
+            return a.p1.x() < b.p1.x();
+        if (a.p1.y() != b.p1.y())
+            return a.p1.y() < b.p1.y();
+        return a.p1.z() < b.p1.z();
+    });
+
+    return result;
+}
+
+static void Compare(const SimulationResult& serial, const SimulationResult& parallel) {
+    ASSERT_GT(serial.contacts.size(), 100u);
+    ASSERT_EQ(serial.contacts.size(), parallel.contacts.size());
+    for (size_t i = 0; i < serial.contacts.size(); i++) {
+        ASSERT_NEAR((serial.contacts[i].p1 - parallel.contacts[i].p1).Length(), 0.0, 1e-9);
+        ASSERT_NEAR((serial.contacts[i].force - parallel.contacts[i].force).Length(), 0.0,
+                    1e-6 * (1 + serial.contacts[i].force.Length()));
+    }
+
+    ASSERT_EQ(serial.pos.size(), parallel.pos.size());
+    for (size_t i = 0; i < serial.pos.size(); i++) {
+        ASSERT_NEAR((serial.pos[i] - parallel.pos[i]).Length(), 0.0, 1e-9);
+        ASSERT_NEAR((serial.vel[i] - parallel.vel[i]).Length(), 0.0, 1e-6);
+    }
+}
+
+TEST(SMCParallelContact, forces) {
+    auto serial = Simulate(1, false);
+    auto parallel = Simulate(4, false);
+    Compare(serial, parallel);
+}
+
+TEST(SMCParallelContact, stiff_contact) {
+    auto serial = Simulate(1, true);
+    auto parallel = Simulate(4, true);
+    Compare(serial, parallel);
+}
@@ -0,0 +1,123 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the linear-time tree solver (ChSolverTree).
+// - a branched mechanism (no loops) is solved with tree elimination and gives
+//   the same results as the sparse LU solver
+// - a mechanism with a closed loop falls back to sparse LU
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChSolverTree.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChBody> AddLink(ChSystem& sys, const ChVector<>& center) {
+    auto link = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.1, 0.1, 1000, false, false);
+    link->SetPos(center);
+    sys.AddBody(link);
+    return link;
+}
+
+static void AddRevolute(ChSystem& sys, std::shared_ptr<ChBody> b1, std::shared_ptr<ChBody> b2, const ChVector<>& loc) {
+    auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev->Initialize(b1, b2, ChCoordsys<>(loc, QUNIT));
+    sys.AddLink(rev);
+}
+
+// Create a mechanism with a base link attached to the ground and two branches of 3 links each.
+// Optionally, close a loop by connecting the tips of the two branches.
+static std::vector<std::shared_ptr<ChBody>> CreateMechanism(ChSystem& sys, bool loop) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+
+    auto base = AddLink(sys, ChVector<>(0.25, 0, 0));
+    AddRevolute(sys, ground, base, ChVector<>(0, 0, 0));
+    bodies.push_back(base);
+
+    for (int side = -1; side <= 1; side += 2) {
+        auto prev = base;
+        ChVector<> joint(0.5, 0, 0);
+        for (int i = 0; i < 3; i++) {
+            auto link = AddLink(sys, joint + ChVector<>(0.25, 0, 0.2 * side));
+            if (i == 1) {
+                // Use a mate joint (spherical) in the middle of each branch
+                auto sph = chrono_types::make_shared<ChLinkMateSpherical>();
+                sph->Initialize(prev, link, false, ChVector<>(joint.x(), 0, 0.2 * side),
+                                ChVector<>(joint.x(), 0, 0.2 * side));
+                sys.AddLink(sph);
+            } else {
+                AddRevolute(sys, prev, link, joint + ChVector<>(0, 0, 0.1 * side));
+            }
+            bodies.push_back(link);
+            prev = link;
+            joint += ChVector<>(0.5, 0, 0);
+        }
+    }
+
+    if (loop) {
+        auto dist = chrono_types::make_shared<ChLinkDistance>();
+        dist->Initialize(bodies[3], bodies[6], true, ChVector<>(0.25, 0, 0), ChVector<>(0.25, 0, 0));
+        sys.AddLink(dist);
+    }
+
+    return bodies;
+}
+
+static void Check(bool loop) {
+    ChSystemSMC sys_ref;
+    auto bodies_ref = CreateMechanism(sys_ref, loop);
+    sys_ref.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+
+    ChSystemSMC sys;
+    auto bodies = CreateMechanism(sys, loop);
+    auto solver = chrono_types::make_shared<ChSolverTree>();
+    sys.SetSolver(solver);
+
+    while (sys.GetChTime() < 0.5) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys.DoStepDynamics(1e-3);
+    }
+
+    // Tree elimination is used only in the absence of loops
+    ASSERT_EQ(solver->IsTree(), !loop);
+
+    // 7 bodies and 6 joints between bodies (the joint to ground is merged with the base link block)
+    if (!loop)
+        ASSERT_EQ(solver->GetNumBlocks(), 13);
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ASSERT_NEAR((bodies[i]->GetPos() - bodies_ref[i]->GetPos()).Length(), 0, 1e-8);
+        ASSERT_NEAR((bodies[i]->GetPos_dt() - bodies_ref[i]->GetPos_dt()).Length(), 0, 1e-8);
+    }
+}
+
+TEST(ChSolverTree, tree) {
+    Check(false);
+}
+
+TEST(ChSolverTree, loop) {
+    Check(true);
+}
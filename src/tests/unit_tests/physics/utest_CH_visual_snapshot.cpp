@@ -0,0 +1,173 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2022 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for decoupled visualization through snapshots.
+// - with snapshots disabled, the visual system is updated at every step
+// - with snapshots enabled, OnUpdate is never called and snapshots are recorded
+//   at the requested rate
+// - snapshots consumed on a separate thread are always consistent
+//
+// =============================================================================
+
+#include <atomic>
+#include <thread>
+
+#include "chrono/assets/ChVisualSystem.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Headless visual system, counting the update calls from the associated system.
+class ChVisualSystemHeadless : public ChVisualSystem {
+  public:
+    ChVisualSystemHeadless() : num_updates(0) {}
+    virtual bool Run() override { return true; }
+    virtual void BeginScene() override {}
+    virtual void Render() override {}
+    virtual void EndScene() override {}
+
+    int num_updates;
+
+  private:
+    virtual void OnUpdate(ChSystem* sys) override { num_updates++; }
+};
+
+// Two falling bodies with a vertical offset of 1 and a falling particle cloud.
+static void CreateModel(ChSystemNSC& sys,
+                        std::shared_ptr<ChBody>& body1,
+                        std::shared_ptr<ChBody>& body2,
+                        std::shared_ptr<ChParticleCloud>& cloud) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    body1 = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, true, false);
+    body1->SetPos(ChVector<>(0, 0, 2));
+    sys.AddBody(body1);
+
+    body2 = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, true, false);
+    body2->SetPos(ChVector<>(0, 0, 1));
+    sys.AddBody(body2);
+
+    cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->SetMass(0.1);
+    for (int i = 0; i < 10; i++)
+        cloud->AddParticle(ChCoordsys<>(ChVector<>(i, 0, 0)));
+    sys.Add(cloud);
+}
+
+TEST(ChVisualSnapshot, disabled) {
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> body1, body2;
+    std::shared_ptr<ChParticleCloud> cloud;
+    CreateModel(sys, body1, body2, cloud);
+
+    ChVisualSystemHeadless vis;
+    vis.AttachSystem(&sys);
+
+    int num_steps = 100;
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(1e-3);
+
+    ASSERT_EQ(vis.num_updates, num_steps);
+    ASSERT_EQ(vis.GetSnapshotRing().GetNumPublished(), 0);
+    ASSERT_EQ(vis.AcquireSnapshot(), nullptr);
+}
+
+TEST(ChVisualSnapshot, rate) {
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> body1, body2;
+    std::shared_ptr<ChParticleCloud> cloud;
+    CreateModel(sys, body1, body2, cloud);
+
+    ChVisualSystemHeadless vis;
+    vis.AttachSystem(&sys);
+    vis.EnableSnapshots(true, 50);
+
+    for (int i = 0; i < 1000; i++)
+        sys.DoStepDynamics(1e-3);
+
+    // One snapshot at the first step, then one every 0.02 s of simulated time
+    ASSERT_EQ(vis.num_updates, 0);
+    ASSERT_EQ(vis.GetSnapshotRing().GetNumPublished(), 51);
+
+    // The last snapshot was recorded at the last step
+    auto snapshot = vis.AcquireSnapshot();
+    ASSERT_NE(snapshot, nullptr);
+    ASSERT_DOUBLE_EQ(snapshot->GetTime(), sys.GetChTime());
+    ASSERT_EQ(snapshot->GetNumBodies(), 2);
+    ASSERT_NEAR((snapshot->GetBodyFrame(body1.get())->GetPos() - body1->GetPos()).Length(), 0, 1e-12);
+    ASSERT_NEAR((snapshot->GetBodyCOGFrame(body2.get())->GetPos() - body2->GetPos()).Length(), 0, 1e-12);
+
+    auto data = snapshot->GetParticleCloud(cloud.get());
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(data->positions.size(), 10);
+    ASSERT_TRUE(data->colors.empty());
+    for (unsigned int k = 0; k < 10; k++)
+        ASSERT_NEAR((data->positions[k] - cloud->GetParticle(k).GetPos()).Length(), 0, 1e-12);
+
+    // No new snapshot: the same one is returned
+    ASSERT_EQ(vis.AcquireSnapshot(), snapshot);
+}
+
+TEST(ChVisualSnapshot, threaded) {
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> body1, body2;
+    std::shared_ptr<ChParticleCloud> cloud;
+    CreateModel(sys, body1, body2, cloud);
+
+    ChVisualSystemHeadless vis;
+    vis.AttachSystem(&sys);
+    vis.EnableSnapshots(true, 0);
+
+    // Render loop on a separate thread: each snapshot must be internally consistent and time must not decrease
+    std::atomic<bool> done(false);
+    int num_frames = 0;
+    bool consistent = true;
+    std::thread render([&]() {
+        double time = -1;
+        while (!done) {
+            auto snapshot = vis.AcquireSnapshot();
+            if (!snapshot)
+                continue;
+            if (snapshot->GetTime() < time)
+                consistent = false;
+            double dz = snapshot->GetBodyFrame(body1.get())->GetPos().z() -
+                        snapshot->GetBodyFrame(body2.get())->GetPos().z();
+            double z1 = snapshot->GetBodyFrame(body1.get())->GetPos().z();
+            double zp = snapshot->GetParticleCloud(cloud.get())->positions[5].z();
+            if (std::abs(dz - 1) > 1e-10 || std::abs(z1 - zp - 2) > 1e-10)
+                consistent = false;
+            if (snapshot->GetTime() > time)
+                num_frames++;
+            time = snapshot->GetTime();
+        }
+    });
+
+    int num_steps = 2000;
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(1e-4);
+
+    done = true;
+    render.join();
+
+    const auto& ring = vis.GetSnapshotRing();
+    ASSERT_TRUE(consistent);
+    ASSERT_EQ(vis.num_updates, 0);
+    ASSERT_EQ(ring.GetNumPublished(), num_steps);
+    ASSERT_GT(num_frames, 0);
+    ASSERT_LE(num_frames + ring.GetNumDropped(), num_steps);
+}
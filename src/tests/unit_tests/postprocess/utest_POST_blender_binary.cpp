@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the binary state files of the Blender exporter.
+// Body poses and per-body fields are written with ChBlender::ExportData and read
+// back with ChBlender::ReadBinaryState. Positions far from the origin must be
+// recovered exactly (double precision).
+//
+// =============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "chrono/assets/ChBoxShape.h"
+#include "chrono/assets/ChSphereShape.h"
+#include "chrono/core/ChException.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_postprocess/ChBlender.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::postprocess;
+
+// Output directory in the system temporary directory
+static std::string TempDirectory(const std::string& name) {
+    const char* tmp = std::getenv("TMPDIR");
+    if (!tmp)
+        tmp = std::getenv("TEMP");
+    return std::string(tmp ? tmp : "/tmp") + "/" + name;
+}
+
+// Remove the files written by the exporter, then the (empty) directories
+static void RemoveOutput(const std::string& dir) {
+    for (const auto& file : {"/binary_test.assets.py", "/binary_test.instances.py", "/output/state00000.py",
+                             "/output/state00000.dat", "/output/state00000.bin"})
+        filesystem::path(dir + file).remove_file();
+    for (const auto& subdir : {"/output", "/anim", ""})
+        std::remove((dir + subdir).c_str());
+}
+
+class BodyFields : public ChBlender::BinaryFieldCallback {
+  public:
+    virtual bool HasColor() const override { return true; }
+    virtual bool HasScalar() const override { return true; }
+    virtual ChColor GetColor(const ChBody& body) override { return ChColor(0.25f, 0.5f, 0.75f); }
+    virtual double GetScalar(const ChBody& body) override { return body.GetIdentifier(); }
+};
+
+TEST(BlenderBinary, round_trip) {
+    std::string dir = TempDirectory("chrono_utest_blender_binary");
+    RemoveOutput(dir);
+
+    ChSystemNSC sys;
+
+    // Two bodies sharing a visual model, one body with its own visual model.
+    // Positions are far from the origin, where single precision would lose the millimeters.
+    auto box = chrono_types::make_shared<ChBoxShape>(1, 2, 3);
+    box->SetMutable(false);
+    auto shared_model = chrono_types::make_shared<ChVisualModel>();
+    shared_model->AddShape(box);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 3; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetPos(ChVector<>(1e5 + 0.123456789 * i, -2e4 + 0.001 * i, 3.5));
+        body->SetRot(Q_from_AngAxis(0.3 * (i + 1), ChVector<>(1, 2, 3).GetNormalized()));
+        body->SetIdentifier(i);
+        if (i < 2)
+            body->AddVisualModel(shared_model);
+        else {
+            auto sphere = chrono_types::make_shared<ChSphereShape>(0.5);
+            sphere->SetMutable(false);
+            body->AddVisualShape(sphere);
+        }
+        sys.AddBody(body);
+        bodies.push_back(body);
+    }
+
+    ChBlender blender(&sys);
+    blender.SetBasePath(dir);
+    blender.SetOutputScriptFile("binary_test");
+    blender.SetBlenderUp_is_ChronoZ();
+    blender.SetBinaryStateOutput(true);
+    blender.SetBinaryFieldCallback(chrono_types::make_shared<BodyFields>());
+    blender.AddAll();
+    blender.ExportScript();
+    blender.ExportData();
+    blender.WaitForBinaryStateOutput();
+
+    ChBlender::BinaryState state;
+    ASSERT_TRUE(ChBlender::ReadBinaryState(dir + "/output/state00000.bin", state));
+
+    EXPECT_EQ(state.frame, 0u);
+    EXPECT_DOUBLE_EQ(state.time, sys.GetChTime());
+    EXPECT_TRUE(state.has_color);
+    EXPECT_TRUE(state.has_scalar);
+    ASSERT_EQ(state.records.size(), bodies.size());
+
+    // Records are keyed by item ID (assigned in order of first export), so match them by body identifier
+    std::vector<unsigned int> instances(bodies.size());
+    for (const auto& record : state.records) {
+        int i = (int)record.scalar;
+        ASSERT_GE(i, 0);
+        ASSERT_LT(i, (int)bodies.size());
+        EXPECT_DOUBLE_EQ(record.pos.x(), bodies[i]->GetPos().x());
+        EXPECT_DOUBLE_EQ(record.pos.y(), bodies[i]->GetPos().y());
+        EXPECT_DOUBLE_EQ(record.pos.z(), bodies[i]->GetPos().z());
+        EXPECT_NEAR(record.rot.e0(), bodies[i]->GetRot().e0(), 1e-6);
+        EXPECT_NEAR(record.rot.e1(), bodies[i]->GetRot().e1(), 1e-6);
+        EXPECT_NEAR(record.rot.e2(), bodies[i]->GetRot().e2(), 1e-6);
+        EXPECT_NEAR(record.rot.e3(), bodies[i]->GetRot().e3(), 1e-6);
+        EXPECT_FLOAT_EQ(record.color.R, 0.25f);
+        EXPECT_FLOAT_EQ(record.color.G, 0.5f);
+        EXPECT_FLOAT_EQ(record.color.B, 0.75f);
+        instances[i] = record.instance;
+    }
+
+    // Bodies with the same visual model share the instance
+    EXPECT_EQ(instances[0], instances[1]);
+    EXPECT_NE(instances[0], instances[2]);
+
+    RemoveOutput(dir);
+}
+
+TEST(BlenderBinary, requires_single_asset_file) {
+    ChSystemNSC sys;
+    ChBlender blender(&sys);
+    blender.SetBasePath(TempDirectory("chrono_utest_blender_binary_multi"));
+    blender.SetUseSingleAssetFile(false);
+    blender.SetBinaryStateOutput(true);
+    EXPECT_THROW(blender.ExportScript(), ChException);
+}
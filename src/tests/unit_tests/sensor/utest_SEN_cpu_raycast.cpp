@@ -0,0 +1,171 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2019 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Radu Serban
+// =============================================================================
+//
+// Unit test for the ray casting scene of the CPU sensor backend.
+// Hit distances and normals are checked against the analytic values for a
+// plane (represented by a flat box and by a two-triangle mesh) and a sphere.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/assets/ChBoxShape.h"
+#include "chrono/assets/ChSphereShape.h"
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_sensor/cpu/ChCPURayScene.h"
+
+using namespace chrono;
+using namespace chrono::sensor;
+
+const double ABS_ERR = 1e-9;
+
+// Fixed body with a single visual shape at the given position
+static std::shared_ptr<ChBody> AddFixedBody(ChSystem& sys,
+                                            std::shared_ptr<ChVisualShape> shape,
+                                            const ChVector<>& pos,
+                                            const ChQuaternion<>& rot = QUNIT) {
+    shape->SetMutable(false);
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetBodyFixed(true);
+    body->SetPos(pos);
+    body->SetRot(rot);
+    body->AddVisualShape(shape);
+    sys.AddBody(body);
+    return body;
+}
+
+// Ground plane z = 0, as the top face of a thin box
+TEST(ChCPURayScene, box_plane) {
+    ChSystemNSC sys;
+    AddFixedBody(sys, chrono_types::make_shared<ChBoxShape>(100, 100, 1), ChVector<>(0, 0, -0.5));
+
+    ChCPURayScene scene(&sys);
+    scene.Construct();
+    scene.Update();
+    ASSERT_EQ(scene.GetNumInstances(), 1u);
+
+    ChVector<> origin(0.3, -0.7, 2.5);
+    for (double angle : {0.0, 0.2, 0.6, 1.0}) {
+        // distance to the plane along a ray at 'angle' from the downward vertical
+        ChVector<> dir(std::sin(angle), 0, -std::cos(angle));
+        ChCPURayScene::Hit hit;
+        ASSERT_TRUE(scene.Intersect(origin, dir, 0, 1e3, hit));
+        EXPECT_NEAR(hit.distance, origin.z() / std::cos(angle), ABS_ERR);
+        EXPECT_NEAR(hit.normal.z(), 1.0, ABS_ERR);
+    }
+
+    // ray pointing away from the plane and ray too short to reach it
+    ChCPURayScene::Hit hit;
+    EXPECT_FALSE(scene.Intersect(origin, ChVector<>(0, 0, 1), 0, 1e3, hit));
+    EXPECT_FALSE(scene.Intersect(origin, ChVector<>(0, 0, -1), 0, 2.0, hit));
+}
+
+// Tilted plane given as a two-triangle mesh
+TEST(ChCPURayScene, mesh_plane) {
+    auto trimesh = chrono_types::make_shared<geometry::ChTriangleMeshConnected>();
+    trimesh->getCoordsVertices() = {ChVector<>(-10, -10, 0), ChVector<>(10, -10, 0), ChVector<>(10, 10, 0),
+                                    ChVector<>(-10, 10, 0)};
+    trimesh->getIndicesVertexes() = {ChVector<int>(0, 1, 2), ChVector<int>(0, 2, 3)};
+    auto mesh_shape = chrono_types::make_shared<ChTriangleMeshShape>();
+    mesh_shape->SetMesh(trimesh);
+
+    // plane through p0 with normal n
+    ChQuaternion<> rot = Q_from_AngX(0.4);
+    ChVector<> p0(1, 2, 3);
+    ChVector<> n = rot.Rotate(ChVector<>(0, 0, 1));
+
+    ChSystemNSC sys;
+    AddFixedBody(sys, mesh_shape, p0, rot);
+
+    ChCPURayScene scene(&sys);
+    scene.Construct();
+    scene.Update();
+
+    ChVector<> origin = p0 + ChVector<>(0.5, -0.25, 0) + n * 4;
+    for (const auto& d : {ChVector<>(0, 0, -1), ChVector<>(0.3, 0.2, -1), ChVector<>(-0.5, 0.1, -1)}) {
+        ChVector<> dir = d.GetNormalized();
+        double expected = Vdot(p0 - origin, n) / Vdot(dir, n);
+        ChCPURayScene::Hit hit;
+        ASSERT_TRUE(scene.Intersect(origin, dir, 0, 1e3, hit));
+        EXPECT_NEAR(hit.distance, expected, ABS_ERR);
+        EXPECT_NEAR(std::abs(Vdot(hit.normal, n)), 1.0, ABS_ERR);
+    }
+
+    // ray parallel to the plane
+    ChCPURayScene::Hit hit;
+    EXPECT_FALSE(scene.Intersect(origin, rot.Rotate(ChVector<>(1, 0, 0)), 0, 1e3, hit));
+}
+
+// Sphere: distance |c - o| - r along the ray through the center; general chord otherwise
+TEST(ChCPURayScene, sphere) {
+    const double radius = 1.5;
+    ChVector<> center(4, -1, 2);
+
+    ChSystemNSC sys;
+    AddFixedBody(sys, chrono_types::make_shared<ChSphereShape>(radius), center);
+
+    ChCPURayScene scene(&sys);
+    scene.Construct();
+    scene.Update();
+
+    ChVector<> origin(-3, 2, 0.5);
+    ChCPURayScene::Hit hit;
+
+    ChVector<> dir = (center - origin).GetNormalized();
+    ASSERT_TRUE(scene.Intersect(origin, dir, 0, 1e3, hit));
+    EXPECT_NEAR(hit.distance, (center - origin).Length() - radius, ABS_ERR);
+    EXPECT_NEAR(Vdot(hit.normal, -dir), 1.0, ABS_ERR);
+
+    // off-center ray: t = b - sqrt(b^2 - |oc|^2 + r^2), with b = dir.(c - o)
+    ChVector<> offset = Vcross(dir, ChVector<>(0, 0, 1)).GetNormalized() * (0.8 * radius);
+    ChVector<> dir2 = (center + offset - origin).GetNormalized();
+    double b = Vdot(dir2, center - origin);
+    double expected = b - std::sqrt(b * b - (center - origin).Length2() + radius * radius);
+    ASSERT_TRUE(scene.Intersect(origin, dir2, 0, 1e3, hit));
+    EXPECT_NEAR(hit.distance, expected, ABS_ERR);
+    ChVector<> point = origin + dir2 * hit.distance;
+    EXPECT_NEAR((point - center).Length(), radius, ABS_ERR);
+    EXPECT_NEAR(Vdot(hit.normal, (point - center) / radius), 1.0, ABS_ERR);
+
+    // ray passing beside the sphere
+    ChVector<> miss = Vcross(dir, ChVector<>(0, 0, 1)).GetNormalized() * (1.2 * radius);
+    EXPECT_FALSE(scene.Intersect(origin, (center + miss - origin).GetNormalized(), 0, 1e3, hit));
+}
+
+// Closest hit among several shapes, and hits following body motion after Update
+TEST(ChCPURayScene, closest_hit) {
+    ChSystemNSC sys;
+    AddFixedBody(sys, chrono_types::make_shared<ChBoxShape>(100, 100, 1), ChVector<>(0, 0, -0.5));
+    auto ball = AddFixedBody(sys, chrono_types::make_shared<ChSphereShape>(0.5), ChVector<>(0, 0, 1));
+
+    ChCPURayScene scene(&sys);
+    scene.Construct();
+    scene.Update();
+
+    ChVector<> origin(0, 0, 5);
+    ChVector<> dir(0, 0, -1);
+    ChCPURayScene::Hit hit;
+    ASSERT_TRUE(scene.Intersect(origin, dir, 0, 1e3, hit));
+    EXPECT_NEAR(hit.distance, 3.5, ABS_ERR);
+
+    // move the sphere out of the way
+    ball->SetPos(ChVector<>(10, 0, 1));
+    scene.Update();
+    ASSERT_TRUE(scene.Intersect(origin, dir, 0, 1e3, hit));
+    EXPECT_NEAR(hit.distance, 5.0, ABS_ERR);
+}